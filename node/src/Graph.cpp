@@ -39,7 +39,10 @@ namespace node {
         ml::Input mInput;
     };
 
-    bool GetNamedInputs(const Napi::Value& jsValue, std::map<std::string, Input>& namedInputs) {
+    // The typed arrays of the resources are appended to |resources| if it isn't null.
+    bool GetNamedInputs(const Napi::Value& jsValue,
+                        std::map<std::string, Input>& namedInputs,
+                        std::vector<Napi::Value>* resources = nullptr) {
         if (!jsValue.IsObject()) {
             return false;
         }
@@ -82,13 +85,17 @@ namespace node {
             if (!GetArrayBufferView(jsTypedArray, input.bufferView)) {
                 return false;
             }
+            if (resources != nullptr) {
+                resources->push_back(jsTypedArray);
+            }
             namedInputs[name] = input;
         }
         return true;
     }
 
     bool GetNamedOutputs(const Napi::Value& jsValue,
-                         std::map<std::string, ml::ArrayBufferView>& namedOutputs) {
+                         std::map<std::string, ml::ArrayBufferView>& namedOutputs,
+                         std::vector<Napi::Value>* resources = nullptr) {
         if (!jsValue.IsObject()) {
             return false;
         }
@@ -105,11 +112,65 @@ namespace node {
             if (!GetArrayBufferView(jsNamedOutputs.Get(name), arrayBuffer)) {
                 return false;
             }
+            if (resources != nullptr) {
+                resources->push_back(jsNamedOutputs.Get(name));
+            }
             namedOutputs[name] = arrayBuffer;
         }
         return true;
     }
 
+    // Compute the graph on the thread pool of libuv, the promise is resolved with the status on
+    // the main thread.
+    class ComputeGraphWorker : public Napi::AsyncWorker {
+      public:
+        ComputeGraphWorker(Napi::Env env,
+                           Napi::Promise::Deferred deferred,
+                           ml::Graph graph,
+                           std::map<std::string, Input> inputs,
+                           std::map<std::string, ml::ArrayBufferView> outputs,
+                           const std::vector<Napi::Value>& resources)
+            : Napi::AsyncWorker(env),
+              mDeferred(deferred),
+              mGraph(graph),
+              mInputs(std::move(inputs)),
+              mOutputs(std::move(outputs)),
+              mStatus(ml::ComputeGraphStatus::Error) {
+            // Hold the typed arrays so that their buffers aren't collected during the compute.
+            for (auto& resource : resources) {
+                mResources.push_back(Napi::Persistent(resource.As<Napi::Object>()));
+            }
+            mNamedInputs = ml::CreateNamedInputs();
+            for (auto& input : mInputs) {
+                mNamedInputs.Set(input.first.data(), input.second.AsPtr());
+            }
+            mNamedOutputs = ml::CreateNamedOutputs();
+            for (auto& output : mOutputs) {
+                mNamedOutputs.Set(output.first.data(), &output.second);
+            }
+        }
+
+        ~ComputeGraphWorker() = default;
+
+        void Execute() override {
+            mStatus = mGraph.Compute(mNamedInputs, mNamedOutputs);
+        }
+
+        void OnOK() override {
+            mDeferred.Resolve(Napi::Number::New(Env(), static_cast<uint32_t>(mStatus)));
+        }
+
+      private:
+        Napi::Promise::Deferred mDeferred;
+        ml::Graph mGraph;
+        std::map<std::string, Input> mInputs;
+        std::map<std::string, ml::ArrayBufferView> mOutputs;
+        std::vector<Napi::ObjectReference> mResources;
+        ml::NamedInputs mNamedInputs;
+        ml::NamedOutputs mNamedOutputs;
+        ml::ComputeGraphStatus mStatus;
+    };
+
     Napi::FunctionReference Graph::constructor;
 
     Graph::Graph(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Graph>(info) {
@@ -137,10 +198,31 @@ namespace node {
         return Napi::Number::New(info.Env(), static_cast<uint32_t>(status));
     }
 
+    Napi::Value Graph::ComputeAsync(const Napi::CallbackInfo& info) {
+        // Promise<status> computeAsync(NamedInputs inputs, NamedOutputs outputs);
+        WEBNN_NODE_ASSERT(info.Length() == 2, "The number of arguments is invalid.");
+        std::vector<Napi::Value> resources;
+        std::map<std::string, Input> inputs;
+        WEBNN_NODE_ASSERT(GetNamedInputs(info[0], inputs, &resources),
+                          "The inputs parameter is invalid.");
+
+        std::map<std::string, ml::ArrayBufferView> outputs;
+        WEBNN_NODE_ASSERT(GetNamedOutputs(info[1], outputs, &resources),
+                          "The outputs parameter is invalid.");
+
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+        ComputeGraphWorker* worker = new ComputeGraphWorker(
+            info.Env(), deferred, mImpl, std::move(inputs), std::move(outputs), resources);
+        worker->Queue();
+        return deferred.Promise();
+    }
+
     Napi::Object Graph::Initialize(Napi::Env env, Napi::Object exports) {
         Napi::HandleScope scope(env);
         Napi::Function func = DefineClass(
-            env, "MLGraph", {InstanceMethod("compute", &Graph::Compute, napi_enumerable)});
+            env, "MLGraph",
+            {InstanceMethod("compute", &Graph::Compute, napi_enumerable),
+             InstanceMethod("computeAsync", &Graph::ComputeAsync, napi_enumerable)});
         constructor = Napi::Persistent(func);
         constructor.SuppressDestruct();
         exports.Set("MLGraph", func);
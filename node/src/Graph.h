@@ -18,6 +18,7 @@
 #include <napi.h>
 #include <webnn/webnn_cpp.h>
 #include <string>
+#include <vector>
 
 namespace node {
 
@@ -37,6 +38,7 @@ namespace node {
         friend GraphBuilder;
 
         Napi::Value Compute(const Napi::CallbackInfo& info);
+        Napi::Value ComputeAsync(const Napi::CallbackInfo& info);
 
         ml::Graph mImpl;
         std::vector<std::string> mOutputNames;
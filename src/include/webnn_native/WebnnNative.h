@@ -27,8 +27,13 @@ namespace webnn_native {
     // Backend-agnostic API for webnn_native
     WEBNN_NATIVE_EXPORT const WebnnProcTable& GetProcs();
 
+    // The backend is named by the options, or selected by the device preference among the
+    // backends enabled in the build.
     WEBNN_NATIVE_EXPORT MLContext CreateContext(MLContextOptions const* options = nullptr);
 
+    // The backends enabled in the build, in the order of the automatic selection.
+    WEBNN_NATIVE_EXPORT std::vector<MLBackendType> GetAvailableBackends();
+
 }  // namespace webnn_native
 
 #endif  // WEBNN_NATIVE_WEBNN_NATIVE_H_
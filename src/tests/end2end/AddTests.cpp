@@ -135,3 +135,53 @@ TEST_F(AddTests, AddBroadcast) {
          2.79817,     -1.3517822,  -0.12901783, 2.1257153});
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+TEST_F(AddTests, AddConstantSubgraph) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    // The constant-only subgraph is folded into one constant at build time.
+    const std::vector<float> xData = {1, 2, 3};
+    const ml::Operand x =
+        utils::BuildConstant(builder, {3}, xData.data(), xData.size() * sizeof(float));
+    const std::vector<float> yData = {10};
+    const ml::Operand y =
+        utils::BuildConstant(builder, {1}, yData.data(), yData.size() * sizeof(float));
+    const std::vector<int32_t> newShape = {1, 3};
+    const ml::Operand b = builder.Reshape(builder.Add(x, y), newShape.data(), newShape.size());
+    const ml::Operand c = builder.Add(a, b);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataA = {1, 2, 3, 4, 5, 6};
+    std::vector<float> result(utils::SizeOfShape({2, 3}));
+    utils::Compute(graph, {{"a", dataA}}, {{"c", result}});
+    const std::vector<float> expectedValue({12, 14, 16, 15, 17, 19});
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+TEST_F(AddTests, AddConstantSubgraphBuiltTwice) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const std::vector<float> xData = {1, 2, 3};
+    const ml::Operand x =
+        utils::BuildConstant(builder, {3}, xData.data(), xData.size() * sizeof(float));
+    const std::vector<float> yData = {10};
+    const ml::Operand y =
+        utils::BuildConstant(builder, {1}, yData.data(), yData.size() * sizeof(float));
+    const ml::Operand b = builder.Add(x, y);
+    const ml::Operand c = builder.Add(a, b);
+    // The constant is folded in the first graph only, the second graph still reads x.
+    const ml::Graph graph0 = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph0);
+    const ml::Graph graph1 = utils::Build(builder, {{"c", c}, {"d", builder.Sub(a, x)}});
+    ASSERT_TRUE(graph1);
+    const std::vector<float> dataA = {1, 2, 3, 4, 5, 6};
+    std::vector<float> result0(utils::SizeOfShape({2, 3}));
+    utils::Compute(graph0, {{"a", dataA}}, {{"c", result0}});
+    const std::vector<float> expectedValue({12, 14, 16, 15, 17, 19});
+    EXPECT_TRUE(utils::CheckValue(result0, expectedValue));
+    std::vector<float> result1(utils::SizeOfShape({2, 3}));
+    std::vector<float> result2(utils::SizeOfShape({2, 3}));
+    utils::Compute(graph1, {{"a", dataA}}, {{"c", result1}, {"d", result2}});
+    EXPECT_TRUE(utils::CheckValue(result1, expectedValue));
+    EXPECT_TRUE(utils::CheckValue(result2, std::vector<float>({0, 0, 0, 3, 3, 3})));
+}
@@ -57,6 +57,50 @@ class BatchNormTests : public WebnnTest {
         EXPECT_TRUE(utils::CheckValue(result, expectedValue));
     }
 
+    // Fold the batchNorm into a 2x2 conv2d of 2 input and 2 output channels whose filter in
+    // the oihw layout is 1 to 16, so a filter scaled along a wrong axis changes the result.
+    void CheckFoldedConv2d(ml::InputOperandLayout inputLayout,
+                           ml::FilterOperandLayout filterLayout,
+                           const std::vector<float>& filterData) {
+        const bool nchw = inputLayout == ml::InputOperandLayout::Nchw;
+        // The input shape is the same in both layouts.
+        const ml::Operand x = utils::BuildInput(builder, "input", {1, 2, 2, 2});
+        const ml::Operand w = utils::BuildConstant(builder, {2, 2, 2, 2}, filterData.data(),
+                                                   filterData.size() * sizeof(float));
+        utils::Conv2dOptions convOptions;
+        convOptions.inputLayout = inputLayout;
+        convOptions.filterLayout = filterLayout;
+        const ml::Operand conv = builder.Conv2d(x, w, convOptions.AsPtr());
+        const std::vector<float> meanData = {1, 2};
+        const std::vector<float> varianceData = {4, 16};
+        const std::vector<float> scaleData = {2, 1};
+        const std::vector<float> biasData = {1, 0};
+        const ml::Operand mean = utils::BuildConstant(builder, {2}, meanData.data(),
+                                                      meanData.size() * sizeof(float));
+        const ml::Operand variance = utils::BuildConstant(
+            builder, {2}, varianceData.data(), varianceData.size() * sizeof(float));
+        ml::BatchNormOptions options;
+        options.scale = utils::BuildConstant(builder, {2}, scaleData.data(),
+                                             scaleData.size() * sizeof(float));
+        options.bias =
+            utils::BuildConstant(builder, {2}, biasData.data(), biasData.size() * sizeof(float));
+        options.axis = nchw ? 1 : 3;
+        options.epsilon = 0;
+        // The batchNorm of a named output isn't folded, so it's followed by a relu.
+        const ml::Operand output = builder.Relu(builder.BatchNorm(conv, mean, variance, &options));
+        const ml::Graph graph = utils::Build(builder, {{"output", output}});
+        ASSERT_TRUE(graph);
+        // The input is 1 to 8 in the nchw layout.
+        const std::vector<float> inputData =
+            nchw ? std::vector<float>{1, 2, 3, 4, 5, 6, 7, 8}
+                 : std::vector<float>{1, 5, 2, 6, 3, 7, 4, 8};
+        std::vector<float> result(2);
+        utils::Compute(graph, {{"input", inputData}}, {{"output", result}});
+        // The conv2d computes {204, 492}, which the batchNorm scales by {1, 0.25} and shifts by
+        // {0, -0.5}.
+        EXPECT_TRUE(utils::CheckValue(result, {204, 122.5}));
+    }
+
     ml::GraphBuilder builder;
 };
 
@@ -184,3 +228,76 @@ TEST_F(BatchNormTests, BatchNormWithEpsilon) {
         -3.7675196e-01, -3.5137540e-01, -1.3970569e-02, 3.7042797e-04,  -3.5802066e-01};
     CheckBatchNorm(input, mean, variance, expectedValue, scale, bias, options);
 }
+
+TEST_F(BatchNormTests, BatchNormAfterConv2d) {
+    const ml::Operand input = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData = {1, 2};
+    const ml::Operand filter = utils::BuildConstant(builder, {2, 1, 1, 1}, filterData.data(),
+                                                    filterData.size() * sizeof(float));
+    const ml::Operand conv = builder.Conv2d(input, filter);
+    const std::vector<float> meanData = {1, 2};
+    const ml::Operand mean = utils::BuildConstant(builder, {2}, meanData.data(),
+                                                  meanData.size() * sizeof(float));
+    const std::vector<float> varianceData = {4, 16};
+    const ml::Operand variance = utils::BuildConstant(builder, {2}, varianceData.data(),
+                                                      varianceData.size() * sizeof(float));
+    const std::vector<float> scaleData = {2, 1};
+    const std::vector<float> biasData = {1, 0};
+    ml::BatchNormOptions options;
+    options.scale = utils::BuildConstant(builder, {2}, scaleData.data(),
+                                         scaleData.size() * sizeof(float));
+    options.bias =
+        utils::BuildConstant(builder, {2}, biasData.data(), biasData.size() * sizeof(float));
+    options.epsilon = 0;
+    const ml::Operand output = builder.BatchNorm(conv, mean, variance, &options);
+    const ml::Graph graph = utils::Build(builder, {{"output", output}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(8);
+    utils::Compute(graph, {{"input", {1, 2, 3, 4}}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {1, 2, 3, 4, 0, 0.5, 1, 1.5}));
+}
+
+TEST_F(BatchNormTests, BatchNormFoldedIntoConv2dOihw) {
+    CheckFoldedConv2d(ml::InputOperandLayout::Nchw, ml::FilterOperandLayout::Oihw,
+                      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+}
+
+TEST_F(BatchNormTests, BatchNormFoldedIntoConv2dHwio) {
+    CheckFoldedConv2d(ml::InputOperandLayout::Nhwc, ml::FilterOperandLayout::Hwio,
+                      {1, 9, 5, 13, 2, 10, 6, 14, 3, 11, 7, 15, 4, 12, 8, 16});
+}
+
+TEST_F(BatchNormTests, BatchNormFoldedIntoConv2dOhwi) {
+    CheckFoldedConv2d(ml::InputOperandLayout::Nhwc, ml::FilterOperandLayout::Ohwi,
+                      {1, 5, 2, 6, 3, 7, 4, 8, 9, 13, 10, 14, 11, 15, 12, 16});
+}
+
+TEST_F(BatchNormTests, BatchNormFoldedIntoConv2dIhwo) {
+    CheckFoldedConv2d(ml::InputOperandLayout::Nhwc, ml::FilterOperandLayout::Ihwo,
+                      {1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 8, 16});
+}
+
+// The Mul and the Add of the per-channel constants after the conv2d are folded as a batchNorm,
+// the Add takes the conv2d as its second operand and is followed by a relu to be folded.
+TEST_F(BatchNormTests, MulAddFoldedIntoConv2d) {
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 2, 2, 2});
+    std::vector<float> filterData(16);
+    for (size_t i = 0; i < filterData.size(); ++i) {
+        filterData[i] = i + 1;
+    }
+    const ml::Operand w = utils::BuildConstant(builder, {2, 2, 2, 2}, filterData.data(),
+                                               filterData.size() * sizeof(float));
+    const ml::Operand conv = builder.Conv2d(x, w);
+    const std::vector<float> scaleData = {2, 0.5};
+    const std::vector<float> shiftData = {1, -1};
+    const ml::Operand scale = utils::BuildConstant(builder, {1, 2, 1, 1}, scaleData.data(),
+                                                   scaleData.size() * sizeof(float));
+    const ml::Operand shift = utils::BuildConstant(builder, {1, 2, 1, 1}, shiftData.data(),
+                                                   shiftData.size() * sizeof(float));
+    const ml::Operand output = builder.Relu(builder.Add(shift, builder.Mul(conv, scale)));
+    const ml::Graph graph = utils::Build(builder, {{"output", output}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(2);
+    utils::Compute(graph, {{"input", {1, 2, 3, 4, 5, 6, 7, 8}}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {409, 245}));
+}
@@ -0,0 +1,60 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+class BindingsTests : public WebnnTest {};
+
+TEST_F(BindingsTests, ReluComputedRepeatedly) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const ml::Operand b = builder.Relu(a);
+    const ml::Graph graph = utils::Build(builder, {{"b", b}});
+    ASSERT_TRUE(graph);
+    // The buffers are bound once and their content is updated between the computes.
+    std::vector<float> inputData = {-1.5, 0.5, -0.25, 2, 0, -3};
+    std::vector<float> result(utils::SizeOfShape({2, 3}));
+    const ml::Input input = {{inputData.data(), inputData.size() * sizeof(float)}};
+    const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+    ml::Bindings bindings = graph.CreateBindings();
+    bindings.SetInput("a", &input);
+    bindings.SetOutput("b", &output);
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {0, 0.5, 0, 2, 0, 0}));
+    inputData = {4, -4, 5, -5, 6, -6};
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {4, 0, 5, 0, 6, 0}));
+}
+
+TEST_F(BindingsTests, UnboundInput) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const ml::Operand b = utils::BuildInput(builder, "b", {2, 3});
+    const ml::Operand c = builder.Add(a, b);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    std::vector<float> inputData(utils::SizeOfShape({2, 3}), 1);
+    std::vector<float> result(utils::SizeOfShape({2, 3}));
+    const ml::Input input = {{inputData.data(), inputData.size() * sizeof(float)}};
+    const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+    ml::Bindings bindings = graph.CreateBindings();
+    bindings.SetInput("a", &input);
+    bindings.SetOutput("c", &output);
+    StartExpectContextError();
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Error);
+    EXPECT_TRUE(EndExpectContextError());
+    bindings.SetInput("b", &input);
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {2, 2, 2, 2, 2, 2}));
+}
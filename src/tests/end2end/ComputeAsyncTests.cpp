@@ -0,0 +1,70 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+#include <future>
+
+class ComputeAsyncTests : public WebnnTest {
+  protected:
+    static void OnComputed(MLComputeGraphStatus status, void* userdata) {
+        static_cast<std::promise<MLComputeGraphStatus>*>(userdata)->set_value(status);
+    }
+
+    // Compute the graph of relu asynchronously, the named records and the buffers are kept
+    // alive until the callback is called.
+    MLComputeGraphStatus ComputeRelu(const ml::Graph& graph,
+                                     const std::vector<float>& inputData,
+                                     std::vector<float>& result) {
+        const ml::Input input = {{const_cast<float*>(inputData.data()),
+                                  inputData.size() * sizeof(float)}};
+        ml::NamedInputs namedInputs = ml::CreateNamedInputs();
+        namedInputs.Set("a", &input);
+        const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+        ml::NamedOutputs namedOutputs = ml::CreateNamedOutputs();
+        namedOutputs.Set("b", &output);
+        std::promise<MLComputeGraphStatus> promise;
+        std::future<MLComputeGraphStatus> future = promise.get_future();
+        graph.ComputeAsync(namedInputs, namedOutputs, OnComputed, &promise);
+        return future.get();
+    }
+};
+
+TEST_F(ComputeAsyncTests, Relu) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const ml::Operand b = builder.Relu(a);
+    const ml::Graph graph = utils::Build(builder, {{"b", b}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {-1.5, 0.5, -0.25, 2, 0, -3};
+    std::vector<float> result(utils::SizeOfShape({2, 3}));
+    EXPECT_EQ(ComputeRelu(graph, inputData, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {0, 0.5, 0, 2, 0, 0}));
+}
+
+TEST_F(ComputeAsyncTests, ReluComputedRepeatedly) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const ml::Operand b = builder.Relu(a);
+    const ml::Graph graph = utils::Build(builder, {{"b", b}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(utils::SizeOfShape({2, 3}));
+    EXPECT_EQ(ComputeRelu(graph, {-1, 1, -2, 2, -3, 3}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {0, 1, 0, 2, 0, 3}));
+    EXPECT_EQ(ComputeRelu(graph, {4, -4, 5, -5, 6, -6}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {4, 0, 5, 0, 6, 0}));
+    // The synchronous compute is serialized with the asynchronous ones.
+    utils::Compute(graph, {{"a", {-7, 7, -8, 8, -9, 9}}}, {{"b", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {0, 7, 0, 8, 0, 9}));
+}
@@ -1252,4 +1252,123 @@ TEST_F(Conv2dTests, Conv2dWithAutoPadSameUpperNhwcIhwo) {
     options.inputLayout = ml::InputOperandLayout::Nhwc;
     options.filterLayout = ml::FilterOperandLayout::Ihwo;
     CheckConv2d(input, filter, expected, options);
+}
+
+TEST_F(Conv2dTests, Conv2dFusedReluBuiltTwice) {
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData = {1};
+    const ml::Operand w = utils::BuildConstant(builder, {1, 1, 1, 1}, filterData.data(),
+                                               filterData.size() * sizeof(float));
+    const ml::Operand y = builder.Conv2d(x, w);
+    // The relu is fused into the conv of the first graph only.
+    const ml::Graph graph0 = utils::Build(builder, {{"output", builder.Relu(y)}});
+    ASSERT_TRUE(graph0);
+    const ml::Graph graph1 = utils::Build(builder, {{"output", y}});
+    ASSERT_TRUE(graph1);
+    const std::vector<float> inputData = {-2, -1, 1, 2};
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph0, {{"input", inputData}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<float>({0, 0, 1, 2})));
+    utils::Compute(graph1, {{"input", inputData}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, inputData));
+}
+
+// The blocked formats of the primitives flow through the chain, the output is read in the plain
+// format.
+TEST_F(Conv2dTests, Conv2dChainWithPool) {
+    std::vector<float> inputData(18);
+    for (size_t i = 0; i < inputData.size(); ++i) {
+        inputData[i] = i;
+    }
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 2, 3, 3});
+    std::vector<float> filterData0;
+    for (int32_t o = 0; o < 8; ++o) {
+        filterData0.insert(filterData0.end(), {static_cast<float>(o + 1), -1});
+    }
+    const ml::Operand w0 = utils::BuildConstant(builder, {8, 2, 1, 1}, filterData0.data(),
+                                                filterData0.size() * sizeof(float));
+    const std::vector<float> filterData1(32, 0.125);
+    const ml::Operand w1 = utils::BuildConstant(builder, {4, 8, 1, 1}, filterData1.data(),
+                                                filterData1.size() * sizeof(float));
+    const ml::Operand y = builder.Conv2d(builder.Relu(builder.Conv2d(x, w0)), w1);
+    utils::Pool2dOptions options;
+    options.windowDimensions = {2, 2};
+    const ml::Operand z = builder.MaxPool2d(y, options.AsPtr());
+    const ml::Graph graph = utils::Build(builder, {{"output", z}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(utils::SizeOfShape({1, 4, 2, 2}));
+    utils::Compute(graph, {{"input", inputData}}, {{"output", result}});
+    const std::vector<float> expectedValue = {
+        6.875, 10.125, 16.875, 20.25, 6.875, 10.125, 16.875, 20.25,
+        6.875, 10.125, 16.875, 20.25, 6.875, 10.125, 16.875, 20.25,
+    };
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+// The residual add of another operand with more uses is fused as a sum into a copy of it.
+TEST_F(Conv2dTests, Conv2dResidualAddWithOtherUses) {
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData0 = {1};
+    const ml::Operand w0 = utils::BuildConstant(builder, {1, 1, 1, 1}, filterData0.data(),
+                                                filterData0.size() * sizeof(float));
+    const std::vector<float> filterData1 = {2};
+    const ml::Operand w1 = utils::BuildConstant(builder, {1, 1, 1, 1}, filterData1.data(),
+                                                filterData1.size() * sizeof(float));
+    const ml::Operand y = builder.Conv2d(x, w1);
+    const ml::Operand z = builder.Add(builder.Conv2d(x, w0), y);
+    const ml::Graph graph = utils::Build(builder, {{"z", z}, {"relu", builder.Relu(y)}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {-2, -1, 1, 2};
+    std::vector<float> result0(utils::SizeOfShape({1, 1, 2, 2}));
+    std::vector<float> result1(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"input", inputData}}, {{"z", result0}, {"relu", result1}});
+    EXPECT_TRUE(utils::CheckValue(result0, {-6, -3, 3, 6}));
+    EXPECT_TRUE(utils::CheckValue(result1, {0, 0, 2, 4}));
+}
+
+// The other operand of the residual add is a named output, so it isn't overwritten by the sum.
+TEST_F(Conv2dTests, Conv2dResidualAddOfOutput) {
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData0 = {1};
+    const ml::Operand w0 = utils::BuildConstant(builder, {1, 1, 1, 1}, filterData0.data(),
+                                                filterData0.size() * sizeof(float));
+    const std::vector<float> filterData1 = {2};
+    const ml::Operand w1 = utils::BuildConstant(builder, {1, 1, 1, 1}, filterData1.data(),
+                                                filterData1.size() * sizeof(float));
+    const ml::Operand y = builder.Conv2d(x, w1);
+    const ml::Operand z = builder.Add(y, builder.Conv2d(x, w0));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}, {"z", z}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {-2, -1, 1, 2};
+    std::vector<float> result0(utils::SizeOfShape({1, 1, 2, 2}));
+    std::vector<float> result1(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"input", inputData}}, {{"y", result0}, {"z", result1}});
+    EXPECT_TRUE(utils::CheckValue(result0, {-4, -2, 2, 4}));
+    EXPECT_TRUE(utils::CheckValue(result1, {-6, -3, 3, 6}));
+}
+
+// The per-channel add and mul are fused as the binary post-ops.
+TEST_F(Conv2dTests, Conv2dPerChannelAddAndMul) {
+    const ml::Operand x = utils::BuildInput(builder, "input", {1, 2, 2, 2});
+    const std::vector<float> filterData = {1, 0, 0, 1};
+    const ml::Operand w0 = utils::BuildConstant(builder, {2, 2, 1, 1}, filterData.data(),
+                                                filterData.size() * sizeof(float));
+    const ml::Operand w1 = utils::BuildConstant(builder, {2, 2, 1, 1}, filterData.data(),
+                                                filterData.size() * sizeof(float));
+    const std::vector<float> addData = {10, 20};
+    const ml::Operand b = utils::BuildConstant(builder, {2, 1, 1}, addData.data(),
+                                               addData.size() * sizeof(float));
+    const std::vector<float> mulData = {2, -1};
+    const ml::Operand s = utils::BuildConstant(builder, {1, 2, 1, 1}, mulData.data(),
+                                               mulData.size() * sizeof(float));
+    const ml::Operand y = builder.Add(builder.Conv2d(x, w0), b);
+    const ml::Operand z = builder.Relu(builder.Mul(builder.Conv2d(x, w1), s));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}, {"z", z}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {-2, -1, 1, 2, -4, -3, 3, 4};
+    std::vector<float> result0(utils::SizeOfShape({1, 2, 2, 2}));
+    std::vector<float> result1(utils::SizeOfShape({1, 2, 2, 2}));
+    utils::Compute(graph, {{"input", inputData}}, {{"y", result0}, {"z", result1}});
+    EXPECT_TRUE(utils::CheckValue(result0, {8, 9, 11, 12, 16, 17, 23, 24}));
+    EXPECT_TRUE(utils::CheckValue(result1, {0, 0, 2, 4, 4, 3, 0, 0}));
 }
\ No newline at end of file
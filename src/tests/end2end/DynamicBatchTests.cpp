@@ -0,0 +1,132 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+class DynamicBatchTests : public WebnnTest {
+  protected:
+    void SetUp() override {
+        WebnnTest::SetUp();
+        ml::ContextOptions options;
+        options.dynamicBatch = true;
+        mContext = CreateCppContext(&options);
+        ASSERT_TRUE(mContext);
+    }
+
+    // Compute a + b with the dimensions of a set to the batch size.
+    MLComputeGraphStatus ComputeAdd(const ml::Graph& graph,
+                                    int32_t batchSize,
+                                    const std::vector<float>& inputData,
+                                    std::vector<float>& result) {
+        const std::vector<int32_t> dimensions = {batchSize, 3};
+        const ml::Input input = {{const_cast<float*>(inputData.data()),
+                                  inputData.size() * sizeof(float)},
+                                 dimensions.data(),
+                                 static_cast<uint32_t>(dimensions.size())};
+        ml::NamedInputs namedInputs = ml::CreateNamedInputs();
+        namedInputs.Set("a", &input);
+        const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+        ml::NamedOutputs namedOutputs = ml::CreateNamedOutputs();
+        namedOutputs.Set("c", &output);
+        return static_cast<MLComputeGraphStatus>(graph.Compute(namedInputs, namedOutputs));
+    }
+
+    ml::Context mContext;
+};
+
+TEST_F(DynamicBatchTests, AddWithBatchSizes) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const std::vector<float> bData = {1, 2, 3};
+    const ml::Operand b =
+        utils::BuildConstant(builder, {3}, bData.data(), bData.size() * sizeof(float));
+    const ml::Operand c = builder.Add(a, b);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+
+    std::vector<float> result(3);
+    EXPECT_EQ(ComputeAdd(graph, 1, {1, 1, 1}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {2, 3, 4}));
+
+    result.resize(6);
+    EXPECT_EQ(ComputeAdd(graph, 2, {1, 1, 1, 2, 2, 2}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {2, 3, 4, 3, 4, 5}));
+
+    result.resize(9);
+    EXPECT_EQ(ComputeAdd(graph, 3, {0, 0, 0, 1, 1, 1, 2, 2, 2}, result),
+              MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {1, 2, 3, 2, 3, 4, 3, 4, 5}));
+
+    // The graph of a batch size is cached.
+    result.resize(3);
+    EXPECT_EQ(ComputeAdd(graph, 1, {-1, -2, -3}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {0, 0, 0}));
+}
+
+TEST_F(DynamicBatchTests, RebindInputWithoutDimensions) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const ml::Operand c = builder.Relu(a);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+
+    std::vector<float> inputData = {-1, 2, -3};
+    std::vector<float> result(3);
+    const std::vector<int32_t> dimensions = {1, 3};
+    ml::Input input = {{inputData.data(), inputData.size() * sizeof(float)},
+                       dimensions.data(),
+                       static_cast<uint32_t>(dimensions.size())};
+    ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+    ml::Bindings bindings = graph.CreateBindings();
+    bindings.SetInput("a", &input);
+    bindings.SetOutput("c", &output);
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {0, 2, 0}));
+
+    // The input bound again without dimensions is computed with the built batch size, the
+    // output of the smaller batch size is too small for it.
+    inputData = {1, -2, 3, -4, 5, -6};
+    input = {{inputData.data(), inputData.size() * sizeof(float)}};
+    bindings.SetInput("a", &input);
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Error);
+    result.resize(6);
+    output = {result.data(), result.size() * sizeof(float)};
+    bindings.SetOutput("c", &output);
+    EXPECT_EQ(graph.ComputeBindings(bindings), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {1, 0, 3, 0, 5, 0}));
+}
+
+TEST_F(DynamicBatchTests, ReleaseConstantAfterBuild) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    std::vector<float> bData = {1, 2, 3};
+    const ml::Operand b =
+        utils::BuildConstant(builder, {3}, bData.data(), bData.size() * sizeof(float));
+    const ml::Operand c = builder.Add(a, b);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    // The graphs of the other batch sizes are built from a copy of the constant.
+    bData.assign(bData.size(), 0);
+
+    std::vector<float> result(3);
+    EXPECT_EQ(ComputeAdd(graph, 1, {1, 1, 1}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {2, 3, 4}));
+
+    // The operators of the builder keep the built batch size.
+    const ml::Graph graph1 = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph1);
+    result.resize(6);
+    EXPECT_EQ(ComputeAdd(graph1, 2, {1, 1, 1, 2, 2, 2}, result), MLComputeGraphStatus_Success);
+    EXPECT_TRUE(utils::CheckValue(result, {1, 1, 1, 2, 2, 2}));
+}
@@ -0,0 +1,74 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+class Float16Tests : public WebnnTest {
+  protected:
+    // Compute the graph of the float16 input x and output y, the values are the bits of the
+    // half precision floats.
+    MLComputeGraphStatus Compute(const ml::Graph& graph,
+                                 const std::vector<uint16_t>& inputData,
+                                 std::vector<uint16_t>& result) {
+        const ml::Input input = {{const_cast<uint16_t*>(inputData.data()),
+                                  inputData.size() * sizeof(uint16_t)}};
+        ml::NamedInputs namedInputs = ml::CreateNamedInputs();
+        namedInputs.Set("x", &input);
+        const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(uint16_t)};
+        ml::NamedOutputs namedOutputs = ml::CreateNamedOutputs();
+        namedOutputs.Set("y", &output);
+        return static_cast<MLComputeGraphStatus>(graph.Compute(namedInputs, namedOutputs));
+    }
+};
+
+TEST_F(Float16Tests, AddRelu) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand x = utils::BuildInput(builder, "x", {2, 3}, ml::OperandType::Float16);
+    // {1, 1, 1, 0.5, 0.5, 0.5}
+    const std::vector<uint16_t> bData = {0x3C00, 0x3C00, 0x3C00, 0x3800, 0x3800, 0x3800};
+    const ml::Operand b = utils::BuildConstant(builder, {2, 3}, bData.data(),
+                                               bData.size() * sizeof(uint16_t),
+                                               ml::OperandType::Float16);
+    const ml::Operand y = builder.Relu(builder.Add(x, b));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    // {1, -2, 0.5, 3, -4, 2}
+    const std::vector<uint16_t> input = {0x3C00, 0xC000, 0x3800, 0x4200, 0xC400, 0x4000};
+    std::vector<uint16_t> result(6);
+    EXPECT_EQ(Compute(graph, input, result), MLComputeGraphStatus_Success);
+    // {2, 0, 1.5, 3.5, 0, 2.5}
+    const std::vector<uint16_t> expectedValue = {0x4000, 0x0000, 0x3E00, 0x4300, 0x0000, 0x4100};
+    EXPECT_EQ(result, expectedValue);
+}
+
+// The float32 graph may be computed in a reduced precision, the values here are exact in bf16
+// and fp16.
+TEST_F(Float16Tests, ReducedPrecisionContext) {
+    ml::ContextOptions options;
+    options.reducedPrecision = true;
+    const ml::Context context = CreateCppContext(&options);
+    ASSERT_TRUE(context);
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(context);
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3});
+    const std::vector<float> bData = {1, 2, 3, 0.5, 0.25, -1};
+    const ml::Operand b =
+        utils::BuildConstant(builder, {2, 3}, bData.data(), bData.size() * sizeof(float));
+    const ml::Operand c = builder.Add(a, b);
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> input = {1, 1, 1, 2, 2, 2};
+    std::vector<float> result(6);
+    utils::Compute(graph, {{"a", input}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {2, 3, 4, 2.5, 2.25, 1}));
+}
@@ -287,3 +287,17 @@ TEST_F(GemmTests, bTranspose) {
     TestGemm(inputAShape, inputAData, inputBShape, inputBData, expectedShape, expectedValue,
              &options);
 }
+
+TEST_F(GemmTests, GemmWithRelu) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> bData = {1, 0, 0, 1};
+    const ml::Operand b =
+        utils::BuildConstant(builder, {2, 2}, bData.data(), bData.size() * sizeof(float));
+    const ml::Operand output = builder.Relu(builder.Gemm(a, b));
+    const ml::Graph graph = utils::Build(builder, {{"c", output}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(4);
+    utils::Compute(graph, {{"a", {1, -2, 3, -4}}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {1, 0, 3, 0}));
+}
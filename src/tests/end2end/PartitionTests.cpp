@@ -0,0 +1,149 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+// XNNPACK only supports the nhwc pool2d, so the nchw pool2d is computed by a fallback backend
+// and the graph is partitioned.
+class PartitionTests : public WebnnTest {
+  protected:
+    void SetUp() override {
+        WebnnTest::SetUp();
+        ml::ContextOptions options;
+        options.backendType = ml::BackendType::Xnnpack;
+        mContext = CreateCppContext(&options);
+        ASSERT_TRUE(mContext);
+    }
+
+    // Build relu(x) -> nchw maxPool2d -> add 1, the pool2d is computed by the fallback backend
+    // between the two subgraphs of XNNPACK.
+    ml::Operand BuildPoolBetween(const ml::GraphBuilder& builder,
+                                 const std::string& inputName,
+                                 ml::Operand* pool = nullptr) {
+        const ml::Operand x = utils::BuildInput(builder, inputName, {1, 1, 4, 4});
+        const ml::Operand a = builder.Relu(x);
+        utils::Pool2dOptions options;
+        options.windowDimensions = {3, 3};
+        const ml::Operand p = builder.MaxPool2d(a, options.AsPtr());
+        if (pool != nullptr) {
+            *pool = p;
+        }
+        const ml::Operand b = utils::BuildConstant(builder, {1}, mOne.data(), sizeof(float));
+        return builder.Add(p, b);
+    }
+
+    ml::Context mContext;
+    const std::vector<float> mOne = {1};
+    const std::vector<float> mInputData = {1, -2,  3,  -4,  5,  -6,  7,  -8,
+                                           9, -10, 11, -12, 13, -14, 15, -16};
+};
+
+// The operands across the subgraphs are handed across in the boundary buffers.
+TEST_F(PartitionTests, BoundaryHandoff) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    const ml::Operand c = BuildPoolBetween(builder, "x");
+    const ml::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"x", mInputData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {12, 12, 16, 16}));
+
+    // The boundary buffers are reused by the next compute.
+    const std::vector<float> inputData(utils::SizeOfShape({1, 1, 4, 4}), -1);
+    utils::Compute(graph, {{"x", inputData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {1, 1, 1, 1}));
+}
+
+// A named output of a subgraph that is read by a later subgraph is handed across in the buffer
+// of the output, or in an internal buffer if the compute doesn't request it.
+TEST_F(PartitionTests, NamedOutputReadLater) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    ml::Operand p;
+    const ml::Operand c = BuildPoolBetween(builder, "x", &p);
+    const ml::Graph graph = utils::Build(builder, {{"p", p}, {"c", c}});
+    ASSERT_TRUE(graph);
+    std::vector<float> pool(utils::SizeOfShape({1, 1, 2, 2}));
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"x", mInputData}}, {{"p", pool}, {"c", result}});
+    EXPECT_TRUE(utils::CheckValue(pool, {11, 11, 15, 15}));
+    EXPECT_TRUE(utils::CheckValue(result, {12, 12, 16, 16}));
+
+    result.assign(result.size(), 0);
+    utils::Compute(graph, {{"x", mInputData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {12, 12, 16, 16}));
+}
+
+// The boundary buffers are named apart from the inputs and the outputs of the graph.
+TEST_F(PartitionTests, BoundaryNameCollision) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+    const ml::Operand c = BuildPoolBetween(builder, "webnn_partition_0");
+    const ml::Graph graph = utils::Build(builder, {{"webnn_partition_1", c}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"webnn_partition_0", mInputData}}, {{"webnn_partition_1", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {12, 12, 16, 16}));
+}
+
+// The graph of the operators that the context backend doesn't support at all is computed on
+// the created fallback context, which every graph creates for itself.
+TEST_F(PartitionTests, FallbackContext) {
+    auto build = [&]() {
+        const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+        const ml::Operand x = utils::BuildInput(builder, "x", {1, 1, 4, 4});
+        utils::Pool2dOptions options;
+        options.windowDimensions = {3, 3};
+        return utils::Build(builder, {{"y", builder.MaxPool2d(x, options.AsPtr())}});
+    };
+    const ml::Graph graph0 = build();
+    ASSERT_TRUE(graph0);
+    const ml::Graph graph1 = build();
+    ASSERT_TRUE(graph1);
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph0, {{"x", mInputData}}, {{"y", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {11, 11, 15, 15}));
+    result.assign(result.size(), 0);
+    utils::Compute(graph1, {{"x", mInputData}}, {{"y", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {11, 11, 15, 15}));
+}
+
+// The graph of another batch size is partitioned as the built one.
+TEST_F(PartitionTests, DynamicBatch) {
+    ml::ContextOptions options;
+    options.backendType = ml::BackendType::Xnnpack;
+    options.dynamicBatch = true;
+    const ml::Context context = CreateCppContext(&options);
+    ASSERT_TRUE(context);
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(context);
+    const ml::Operand x = utils::BuildInput(builder, "x", {2, 1, 4, 4});
+    utils::Pool2dOptions poolOptions;
+    poolOptions.windowDimensions = {3, 3};
+    const ml::Operand p = builder.MaxPool2d(builder.Relu(x), poolOptions.AsPtr());
+    const ml::Operand b = utils::BuildConstant(builder, {1}, mOne.data(), sizeof(float));
+    const ml::Graph graph = utils::Build(builder, {{"c", builder.Add(p, b)}});
+    ASSERT_TRUE(graph);
+
+    const std::vector<int32_t> dimensions = {1, 1, 4, 4};
+    const ml::Input input = {{const_cast<float*>(mInputData.data()),
+                              mInputData.size() * sizeof(float)},
+                             dimensions.data(),
+                             static_cast<uint32_t>(dimensions.size())};
+    ml::NamedInputs namedInputs = ml::CreateNamedInputs();
+    namedInputs.Set("x", &input);
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+    ml::NamedOutputs namedOutputs = ml::CreateNamedOutputs();
+    namedOutputs.Set("c", &output);
+    EXPECT_EQ(graph.Compute(namedInputs, namedOutputs), ml::ComputeGraphStatus::Success);
+    EXPECT_TRUE(utils::CheckValue(result, {12, 12, 16, 16}));
+}
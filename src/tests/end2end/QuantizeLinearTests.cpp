@@ -0,0 +1,214 @@
+// Copyright 2021 The WebNN-native Authors
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tests/WebnnTest.h"
+
+class QuantizeLinearTests : public WebnnTest {
+  public:
+    ml::OperandDescriptor QuantizedDescriptor(ml::OperandType type,
+                                              const std::vector<int32_t>& dimensions,
+                                              const std::vector<float>& scales,
+                                              const std::vector<int32_t>& zeroPoints,
+                                              int32_t axis = 0) {
+        ml::OperandDescriptor desc = {type, dimensions.data(), (uint32_t)dimensions.size()};
+        desc.scales = scales.data();
+        desc.scalesCount = scales.size();
+        desc.zeroPoints = zeroPoints.data();
+        desc.zeroPointsCount = zeroPoints.size();
+        desc.axis = axis;
+        return desc;
+    }
+};
+
+TEST_F(QuantizeLinearTests, QuantizeDequantize) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> shape = {2, 3};
+    const ml::Operand x = utils::BuildInput(builder, "x", shape);
+    const std::vector<float> scales = {0.5};
+    const std::vector<int32_t> zeroPoints = {1};
+    const ml::OperandDescriptor desc =
+        QuantizedDescriptor(ml::OperandType::Int8, shape, scales, zeroPoints);
+    const ml::Operand y = builder.DequantizeLinear(builder.QuantizeLinear(x, &desc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    // The values are rounded to the nearest even and saturated to [-128, 127].
+    const std::vector<float> input = {-1.2, 0, 0.3, 1.0, 70, -70};
+    std::vector<float> result(utils::SizeOfShape(shape));
+    utils::Compute(graph, {{"x", input}}, {{"y", result}});
+    const std::vector<float> expectedValue = {-1, 0, 0.5, 1, 63, -64.5};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+TEST_F(QuantizeLinearTests, PerChannelConv2d) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> inputShape = {1, 1, 2, 2};
+    const ml::Operand x = utils::BuildInput(builder, "x", inputShape);
+    const std::vector<float> inputScales = {1}, outputScales = {0.25};
+    const std::vector<int32_t> noZeroPoints = {};
+    const ml::OperandDescriptor inputDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, inputShape, inputScales, noZeroPoints);
+    const ml::Operand input = builder.DequantizeLinear(builder.QuantizeLinear(x, &inputDesc));
+
+    // The real weights are {1, -0.75}.
+    const std::vector<int32_t> filterShape = {2, 1, 1, 1};
+    const std::vector<float> filterScales = {0.5, 0.25};
+    const ml::OperandDescriptor filterDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, filterShape, filterScales, noZeroPoints);
+    const std::vector<int8_t> filterData = {2, -3};
+    ml::ArrayBufferView filterBuffer = {const_cast<int8_t*>(filterData.data()),
+                                        filterData.size()};
+    const ml::Operand filter =
+        builder.DequantizeLinear(builder.Constant(&filterDesc, &filterBuffer));
+    const std::vector<float> biasData = {0.5, 0};
+    utils::Conv2dOptions options;
+    options.bias = utils::BuildConstant(builder, {2}, biasData.data(),
+                                        biasData.size() * sizeof(float));
+    const ml::Operand conv = builder.Conv2d(input, filter, options.AsPtr());
+
+    const std::vector<int32_t> outputShape = {1, 2, 2, 2};
+    const ml::OperandDescriptor outputDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, outputShape, outputScales, noZeroPoints);
+    const ml::Operand y = builder.DequantizeLinear(builder.QuantizeLinear(conv, &outputDesc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape(outputShape));
+    utils::Compute(graph, {{"x", inputData}}, {{"y", result}});
+    const std::vector<float> expectedValue = {1.5, 2.5, 3.5, 4.5, -0.75, -1.5, -2.25, -3};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+TEST_F(QuantizeLinearTests, PerChannelGemmRelu) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> aShape = {2, 2};
+    const ml::Operand x = utils::BuildInput(builder, "x", aShape);
+    const std::vector<float> aScales = {0.5}, outputScales = {0.5};
+    const std::vector<int32_t> aZeroPoints = {2}, noZeroPoints = {};
+    const ml::OperandDescriptor aDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, aShape, aScales, aZeroPoints);
+    const ml::Operand a = builder.DequantizeLinear(builder.QuantizeLinear(x, &aDesc));
+
+    // The real b is {{1, -1, 1}, {1, 1, -1}}, quantized by column.
+    const std::vector<int32_t> bShape = {2, 3};
+    const std::vector<float> bScales = {0.5, 0.25, 1};
+    const ml::OperandDescriptor bDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, bShape, bScales, noZeroPoints, 1);
+    const std::vector<int8_t> bData = {2, -4, 1, 2, 4, -1};
+    ml::ArrayBufferView bBuffer = {const_cast<int8_t*>(bData.data()), bData.size()};
+    const ml::Operand b = builder.DequantizeLinear(builder.Constant(&bDesc, &bBuffer));
+    const std::vector<float> cData = {0.5, 0, 0};
+    ml::GemmOptions options = {};
+    options.c = utils::BuildConstant(builder, {3}, cData.data(), cData.size() * sizeof(float));
+    const ml::Operand gemm = builder.Relu(builder.Gemm(a, b, &options));
+
+    const std::vector<int32_t> outputShape = {2, 3};
+    const ml::OperandDescriptor outputDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, outputShape, outputScales, noZeroPoints);
+    const ml::Operand y = builder.DequantizeLinear(builder.QuantizeLinear(gemm, &outputDesc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape(outputShape));
+    utils::Compute(graph, {{"x", inputData}}, {{"y", result}});
+    const std::vector<float> expectedValue = {3.5, 1, 0, 7.5, 1, 0};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+TEST_F(QuantizeLinearTests, AddWithZeroPoints) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> shape = {2, 2};
+    const ml::Operand x0 = utils::BuildInput(builder, "x0", shape);
+    const ml::Operand x1 = utils::BuildInput(builder, "x1", shape);
+    const std::vector<float> scales = {0.5};
+    const std::vector<int32_t> aZeroPoints = {10}, bZeroPoints = {4}, outputZeroPoints = {1};
+    const ml::OperandDescriptor aDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, shape, scales, aZeroPoints);
+    const ml::OperandDescriptor bDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, shape, scales, bZeroPoints);
+    const ml::Operand a = builder.DequantizeLinear(builder.QuantizeLinear(x0, &aDesc));
+    const ml::Operand b = builder.DequantizeLinear(builder.QuantizeLinear(x1, &bDesc));
+
+    const ml::OperandDescriptor outputDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, shape, scales, outputZeroPoints);
+    const ml::Operand y =
+        builder.DequantizeLinear(builder.QuantizeLinear(builder.Add(a, b), &outputDesc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> aData = {1, -2, 3, 0.5};
+    const std::vector<float> bData = {0.5, 1, -0.5, 2};
+    std::vector<float> result(utils::SizeOfShape(shape));
+    utils::Compute(graph, {{"x0", aData}, {"x1", bData}}, {{"y", result}});
+    const std::vector<float> expectedValue = {1.5, -1, 2.5, 2.5};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+// The pool2d and the clamp read the values quantized as their outputs, so they are computed on
+// the quantized values without rescaling.
+TEST_F(QuantizeLinearTests, MaxPool2dClamp) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> inputShape = {1, 1, 4, 4}, outputShape = {1, 1, 2, 2};
+    const ml::Operand x = utils::BuildInput(builder, "x", inputShape);
+    const std::vector<float> scales = {0.5};
+    const std::vector<int32_t> zeroPoints = {2};
+    const ml::OperandDescriptor inputDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, inputShape, scales, zeroPoints);
+    const ml::OperandDescriptor outputDesc =
+        QuantizedDescriptor(ml::OperandType::Int8, outputShape, scales, zeroPoints);
+    const ml::Operand input = builder.DequantizeLinear(builder.QuantizeLinear(x, &inputDesc));
+    utils::Pool2dOptions poolOptions;
+    poolOptions.windowDimensions = {2, 2};
+    poolOptions.strides = {2, 2};
+    const ml::Operand pool = builder.DequantizeLinear(
+        builder.QuantizeLinear(builder.MaxPool2d(input, poolOptions.AsPtr()), &outputDesc));
+    const std::vector<float> minValue = {6}, maxValue = {14};
+    ml::ClampOptions clampOptions;
+    clampOptions.minValue = utils::BuildConstant(builder, {}, minValue.data(), sizeof(float));
+    clampOptions.maxValue = utils::BuildConstant(builder, {}, maxValue.data(), sizeof(float));
+    const ml::Operand y = builder.DequantizeLinear(
+        builder.QuantizeLinear(builder.Clamp(pool, &clampOptions), &outputDesc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> input = {1, -2, 3,  -4,  5,  -6,  7,  -8,
+                                      9, -10, 11, -12, 13, -14, 15, -16};
+    std::vector<float> result(utils::SizeOfShape(outputShape));
+    utils::Compute(graph, {{"x", input}}, {{"y", result}});
+    const std::vector<float> expectedValue = {6, 7, 13, 14};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+TEST_F(QuantizeLinearTests, Concat) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const std::vector<int32_t> inputShape = {1, 2, 2}, outputShape = {1, 4, 2};
+    const ml::Operand x0 = utils::BuildInput(builder, "x0", inputShape);
+    const ml::Operand x1 = utils::BuildInput(builder, "x1", inputShape);
+    const std::vector<float> scales = {0.25};
+    const std::vector<int32_t> zeroPoints = {128};
+    const ml::OperandDescriptor inputDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, inputShape, scales, zeroPoints);
+    const ml::OperandDescriptor outputDesc =
+        QuantizedDescriptor(ml::OperandType::Uint8, outputShape, scales, zeroPoints);
+    const std::vector<ml::Operand> inputs = {
+        builder.DequantizeLinear(builder.QuantizeLinear(x0, &inputDesc)),
+        builder.DequantizeLinear(builder.QuantizeLinear(x1, &inputDesc))};
+    const ml::Operand y = builder.DequantizeLinear(
+        builder.QuantizeLinear(builder.Concat(inputs.size(), inputs.data(), 1), &outputDesc));
+    const ml::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> data0 = {1, -2, 0.5, 3};
+    const std::vector<float> data1 = {-0.25, 4, -8, 0};
+    std::vector<float> result(utils::SizeOfShape(outputShape));
+    utils::Compute(graph, {{"x0", data0}, {"x1", data1}}, {{"y", result}});
+    const std::vector<float> expectedValue = {1, -2, 0.5, 3, -0.25, 4, -8, 0};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
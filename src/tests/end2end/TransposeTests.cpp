@@ -108,3 +108,83 @@ TEST_F(TransposeTests, TransposePermutations) {
                        permutations[i]);
     }
 }
+
+TEST_F(TransposeTests, BackToBackTransposes) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3, 4});
+    // The transposes are merged into one with permutation {1, 2, 0}.
+    const ml::Operand b = builder.Transpose(a);
+    std::vector<int32_t> permutation = {1, 0, 2};
+    ml::TransposeOptions options;
+    options.permutation = permutation.data();
+    options.permutationCount = permutation.size();
+    const ml::Operand c = builder.Transpose(b, &options);
+    // The transposes cancel out and are removed.
+    permutation = {2, 0, 1};
+    options.permutation = permutation.data();
+    const ml::Operand d = builder.Transpose(a, &options);
+    permutation = {1, 2, 0};
+    options.permutation = permutation.data();
+    const ml::Operand e = builder.Relu(builder.Transpose(d, &options));
+    const ml::Graph graph = utils::Build(builder, {{"c", c}, {"e", e}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {
+        0.43376675, 0.264609,   0.26321858, 0.04260185, 0.6862414,  0.26150206,
+        0.04169406, 0.24857993, 0.14914423, 0.19905873, 0.33851373, 0.74131566,
+        0.91501445, 0.21852633, 0.02267954, 0.22069663, 0.95799077, 0.17188412,
+        0.09732241, 0.03296741, 0.04709655, 0.50648814, 0.13075736, 0.82511896,
+    };
+    std::vector<float> result0(utils::SizeOfShape({3, 4, 2}));
+    std::vector<float> result1(utils::SizeOfShape({2, 3, 4}));
+    utils::Compute(graph, {{"a", inputData}}, {{"c", result0}, {"e", result1}});
+    const std::vector<float> expectedValue = {
+        0.43376675, 0.91501445, 0.264609,   0.21852633, 0.26321858, 0.02267954,
+        0.04260185, 0.22069663, 0.6862414,  0.95799077, 0.26150206, 0.17188412,
+        0.04169406, 0.09732241, 0.24857993, 0.03296741, 0.14914423, 0.04709655,
+        0.19905873, 0.50648814, 0.33851373, 0.13075736, 0.74131566, 0.82511896,
+    };
+    EXPECT_TRUE(utils::CheckValue(result0, expectedValue));
+    EXPECT_TRUE(utils::CheckValue(result1, inputData));
+}
+
+TEST_F(TransposeTests, BuildTwiceFromOneBuilder) {
+    const ml::GraphBuilder builder = ml::CreateGraphBuilder(GetContext());
+    const ml::Operand a = utils::BuildInput(builder, "a", {2, 3, 4});
+    const ml::Operand b = builder.Transpose(a);
+    std::vector<int32_t> permutation = {1, 0, 2};
+    ml::TransposeOptions options;
+    options.permutation = permutation.data();
+    options.permutationCount = permutation.size();
+    const ml::Operand c = builder.Transpose(b, &options);
+    // The first graph merges the transposes, the second one still computes b.
+    const ml::Graph graph0 = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph0);
+    const ml::Graph graph1 = utils::Build(builder, {{"b", b}, {"c", c}});
+    ASSERT_TRUE(graph1);
+    const std::vector<float> inputData = {
+        0.43376675, 0.264609,   0.26321858, 0.04260185, 0.6862414,  0.26150206,
+        0.04169406, 0.24857993, 0.14914423, 0.19905873, 0.33851373, 0.74131566,
+        0.91501445, 0.21852633, 0.02267954, 0.22069663, 0.95799077, 0.17188412,
+        0.09732241, 0.03296741, 0.04709655, 0.50648814, 0.13075736, 0.82511896,
+    };
+    const std::vector<float> expectedValue = {
+        0.43376675, 0.91501445, 0.264609,   0.21852633, 0.26321858, 0.02267954,
+        0.04260185, 0.22069663, 0.6862414,  0.95799077, 0.26150206, 0.17188412,
+        0.04169406, 0.09732241, 0.24857993, 0.03296741, 0.14914423, 0.04709655,
+        0.19905873, 0.50648814, 0.33851373, 0.13075736, 0.74131566, 0.82511896,
+    };
+    std::vector<float> result0(utils::SizeOfShape({3, 4, 2}));
+    utils::Compute(graph0, {{"a", inputData}}, {{"c", result0}});
+    EXPECT_TRUE(utils::CheckValue(result0, expectedValue));
+    std::vector<float> result1(utils::SizeOfShape({4, 3, 2}));
+    std::vector<float> result2(utils::SizeOfShape({3, 4, 2}));
+    utils::Compute(graph1, {{"a", inputData}}, {{"b", result1}, {"c", result2}});
+    const std::vector<float> expectedTranspose = {
+        0.43376675, 0.91501445, 0.6862414,  0.95799077, 0.14914423, 0.04709655,
+        0.264609,   0.21852633, 0.26150206, 0.17188412, 0.19905873, 0.50648814,
+        0.26321858, 0.02267954, 0.04169406, 0.09732241, 0.33851373, 0.13075736,
+        0.04260185, 0.22069663, 0.24857993, 0.03296741, 0.74131566, 0.82511896,
+    };
+    EXPECT_TRUE(utils::CheckValue(result1, expectedTranspose));
+    EXPECT_TRUE(utils::CheckValue(result2, expectedValue));
+}
@@ -0,0 +1,84 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "webnn_native/BackendRegistry.h"
+
+using namespace webnn_native;
+
+namespace {
+
+    const BackendInfo* FindBackend(ml::BackendType type) {
+        for (auto& backend : BackendRegistry::Get().GetBackends()) {
+            if (backend.type == type) {
+                return &backend;
+            }
+        }
+        return nullptr;
+    }
+
+    // Check that the default options select the backend of the highest priority.
+    TEST(BackendRegistryTests, DefaultOptions) {
+        const auto& backends = BackendRegistry::Get().GetBackends();
+        ASSERT_FALSE(backends.empty());
+        ContextOptions options;
+        EXPECT_EQ(BackendRegistry::Get().Select(options), &backends.front());
+    }
+
+    // Check that the named backend is selected whatever the device preference.
+    TEST(BackendRegistryTests, NamedBackend) {
+        for (auto& backend : BackendRegistry::Get().GetBackends()) {
+            ContextOptions options;
+            options.backendType = backend.type;
+            options.devicePreference = ml::DevicePreference::Gpu;
+            EXPECT_EQ(BackendRegistry::Get().Select(options), &backend);
+        }
+    }
+
+    // Check that a backend that isn't enabled in the build isn't selected.
+    TEST(BackendRegistryTests, UnavailableBackend) {
+        for (auto type : {ml::BackendType::Null, ml::BackendType::Openvino, ml::BackendType::Dml,
+                          ml::BackendType::Onednn, ml::BackendType::Xnnpack,
+                          ml::BackendType::Reference}) {
+            if (FindBackend(type) != nullptr) {
+                continue;
+            }
+            ContextOptions options;
+            options.backendType = type;
+            EXPECT_EQ(BackendRegistry::Get().Select(options), nullptr);
+        }
+    }
+
+    // Check that the device preference selects a backend computing on the device.
+    TEST(BackendRegistryTests, DevicePreference) {
+        for (auto device : {ml::DevicePreference::Cpu, ml::DevicePreference::Gpu}) {
+            ContextOptions options;
+            options.devicePreference = device;
+            const BackendInfo* selected = BackendRegistry::Get().Select(options);
+            ASSERT_NE(selected, nullptr);
+            for (auto& backend : BackendRegistry::Get().GetBackends()) {
+                bool computesOnDevice = false;
+                for (auto backendDevice : backend.devices) {
+                    computesOnDevice |= backendDevice == device;
+                }
+                if (computesOnDevice) {
+                    EXPECT_EQ(selected, &backend);
+                    break;
+                }
+            }
+        }
+    }
+
+}  // namespace
@@ -0,0 +1,52 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "webnn_native/Float16.h"
+
+using namespace webnn_native;
+
+namespace {
+
+    // Check the values that are exact in half precision.
+    TEST(Float16Tests, ExactValues) {
+        ASSERT_EQ(Float32ToFloat16(0.0f), 0x0000u);
+        ASSERT_EQ(Float32ToFloat16(-0.0f), 0x8000u);
+        ASSERT_EQ(Float32ToFloat16(1.0f), 0x3C00u);
+        ASSERT_EQ(Float32ToFloat16(-2.0f), 0xC000u);
+        ASSERT_EQ(Float32ToFloat16(65504.0f), 0x7BFFu);
+        ASSERT_EQ(Float32ToFloat16(std::ldexp(1.0f, -24)), 0x0001u);
+        for (uint32_t bits : {0x0001u, 0x03FFu, 0x0400u, 0x3555u, 0x7BFFu, 0xBC00u}) {
+            const uint16_t half = static_cast<uint16_t>(bits);
+            ASSERT_EQ(Float32ToFloat16(Float16ToFloat32(half)), half);
+        }
+    }
+
+    // Check the rounding to the nearest even value and the overflow to the infinity.
+    TEST(Float16Tests, Rounding) {
+        ASSERT_EQ(Float32ToFloat16(1.0f + std::ldexp(1.0f, -11)), 0x3C00u);
+        ASSERT_EQ(Float32ToFloat16(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3C02u);
+        ASSERT_EQ(Float32ToFloat16(std::ldexp(1.0f, -25)), 0x0000u);
+        ASSERT_EQ(Float32ToFloat16(65519.0f), 0x7BFFu);
+        ASSERT_EQ(Float32ToFloat16(65520.0f), 0x7C00u);
+        ASSERT_EQ(Float32ToFloat16(-std::numeric_limits<float>::infinity()), 0xFC00u);
+        ASSERT_TRUE(std::isnan(Float16ToFloat32(
+            Float32ToFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+}  // namespace
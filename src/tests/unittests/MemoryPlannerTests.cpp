@@ -0,0 +1,61 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "webnn_native/MemoryPlanner.h"
+
+using namespace webnn_native;
+
+namespace {
+
+    // Check that the buffers of a chain reuse the memory of the buffers that are dead.
+    TEST(MemoryPlannerTests, ReuseDeadBuffers) {
+        std::vector<BufferLifetime> buffers = {{256, 0, 1}, {256, 1, 2}, {256, 2, 3}};
+        std::vector<size_t> offsets;
+        ASSERT_EQ(AssignOffsets(buffers, offsets), 512u);
+        ASSERT_EQ(offsets[0], offsets[2]);
+        ASSERT_NE(offsets[0], offsets[1]);
+    }
+
+    // Check that the buffers alive at the same time don't overlap.
+    TEST(MemoryPlannerTests, OverlappingLifetimes) {
+        std::vector<BufferLifetime> buffers = {{128, 0, 3}, {256, 1, 2}, {64, 2, 3}};
+        std::vector<size_t> offsets;
+        ASSERT_EQ(AssignOffsets(buffers, offsets), 448u);
+        ASSERT_EQ(offsets[1], 0u);
+        ASSERT_EQ(offsets[0], 256u);
+        ASSERT_EQ(offsets[2], 384u);
+    }
+
+    // Check that a small buffer is placed in the gap left by a dead buffer.
+    TEST(MemoryPlannerTests, FillGap) {
+        std::vector<BufferLifetime> buffers = {{512, 0, 1}, {1024, 0, 3}, {256, 2, 3}};
+        std::vector<size_t> offsets;
+        ASSERT_EQ(AssignOffsets(buffers, offsets), 1536u);
+        ASSERT_EQ(offsets[1], 0u);
+        ASSERT_EQ(offsets[0], 1024u);
+        ASSERT_EQ(offsets[2], 1024u);
+    }
+
+    // Check that the offsets are aligned.
+    TEST(MemoryPlannerTests, Alignment) {
+        std::vector<BufferLifetime> buffers = {{4, 0, 1}, {4, 0, 1}};
+        std::vector<size_t> offsets;
+        ASSERT_EQ(AssignOffsets(buffers, offsets), 2 * kArenaAlignment);
+        ASSERT_EQ(offsets[0] % kArenaAlignment, 0u);
+        ASSERT_EQ(offsets[1] % kArenaAlignment, 0u);
+    }
+
+}  // anonymous namespace
@@ -0,0 +1,149 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "examples/SampleUtils.h"
+#include "webnn_native/onednn/ContextDNNL.h"
+
+using namespace webnn_native;
+
+namespace {
+
+    class PackedConstantTests : public testing::Test {
+      protected:
+        void SetUp() override {
+            ml::ContextOptions options;
+            options.backendType = ml::BackendType::Onednn;
+            mContext = CreateCppContext(&options);
+            ASSERT_TRUE(mContext);
+        }
+
+        onednn::Context* GetContext() {
+            return reinterpret_cast<onednn::Context*>(mContext.Get());
+        }
+
+        // Acquire the packed constant of |buffer|, |packs| counts the calls of the pack function.
+        // The fingerprint is fixed, so the buffers of the same size share the packed constant.
+        dnnl_memory_t Acquire(const std::vector<float>& buffer, uint32_t& packs) {
+            std::vector<dnnl_dim_t> dims = {static_cast<dnnl_dim_t>(buffer.size())};
+            onednn::PackedConstantKey key = {};
+            key.byteLength = buffer.size() * sizeof(float);
+            key.fingerprint = 1;
+            EXPECT_EQ(dnnl_memory_desc_init_by_tag(&key.srcDesc, dims.size(), dims.data(),
+                                                   dnnl_f32, dnnl_a),
+                      dnnl_success);
+            key.dstDesc = key.srcDesc;
+            dnnl_memory_t memory = nullptr;
+            EXPECT_EQ(GetContext()->AcquirePackedConstant(
+                          key,
+                          [&](dnnl_memory_t* packed) {
+                              ++packs;
+                              return dnnl_memory_create(packed, &key.dstDesc,
+                                                        GetContext()->GetEngine(),
+                                                        DNNL_MEMORY_ALLOCATE);
+                          },
+                          &memory),
+                      dnnl_success);
+            return memory;
+        }
+
+        ml::Context mContext;
+    };
+
+    // Check that the packed constant is shared until the last reference is released.
+    TEST_F(PackedConstantTests, ReferenceCount) {
+        const std::vector<float> buffer(16, 1);
+        uint32_t packs = 0;
+        dnnl_memory_t memory0 = Acquire(buffer, packs);
+        dnnl_memory_t memory1 = Acquire(buffer, packs);
+        EXPECT_EQ(packs, 1u);
+        EXPECT_EQ(memory0, memory1);
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), 1u);
+
+        GetContext()->ReleasePackedConstant(memory0);
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), 1u);
+        EXPECT_EQ(Acquire(buffer, packs), memory1);
+        EXPECT_EQ(packs, 1u);
+
+        GetContext()->ReleasePackedConstant(memory1);
+        GetContext()->ReleasePackedConstant(memory1);
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), 0u);
+        dnnl_memory_t memory2 = Acquire(buffer, packs);
+        EXPECT_EQ(packs, 2u);
+        GetContext()->ReleasePackedConstant(memory2);
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), 0u);
+    }
+
+    // Check that two graphs built from the same weights share the packed weights, which are
+    // released with the last graph.
+    TEST_F(PackedConstantTests, GraphsShareWeights) {
+        const std::vector<float> filterData(16 * 16 * 3 * 3, 0.5);
+        auto build = [&]() {
+            const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+            const ml::Operand x = utils::BuildInput(builder, "input", {1, 16, 8, 8});
+            const ml::Operand w = utils::BuildConstant(builder, {16, 16, 3, 3}, filterData.data(),
+                                                       filterData.size() * sizeof(float));
+            return utils::Build(builder, {{"output", builder.Conv2d(x, w)}});
+        };
+        ml::Graph graph0 = build();
+        ASSERT_TRUE(graph0);
+        const size_t count = GetContext()->GetPackedConstantCount();
+        ml::Graph graph1 = build();
+        ASSERT_TRUE(graph1);
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), count);
+
+        graph0 = nullptr;
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), count);
+        graph1 = nullptr;
+        EXPECT_EQ(GetContext()->GetPackedConstantCount(), 0u);
+    }
+
+    // Check that the graphs of other batch sizes, which are built from the copied constants,
+    // share the weights packed by the built graph.
+    TEST_F(PackedConstantTests, BatchGraphsShareWeights) {
+        ml::ContextOptions options;
+        options.backendType = ml::BackendType::Onednn;
+        options.dynamicBatch = true;
+        mContext = CreateCppContext(&options);
+        ASSERT_TRUE(mContext);
+        const std::vector<float> filterData(16 * 16 * 3 * 3, 0.5);
+        const ml::GraphBuilder builder = ml::CreateGraphBuilder(mContext);
+        const ml::Operand x = utils::BuildInput(builder, "input", {2, 16, 8, 8});
+        const ml::Operand w = utils::BuildConstant(builder, {16, 16, 3, 3}, filterData.data(),
+                                                   filterData.size() * sizeof(float));
+        const ml::Graph graph = utils::Build(builder, {{"output", builder.Conv2d(x, w)}});
+        ASSERT_TRUE(graph);
+        const size_t count = GetContext()->GetPackedConstantCount();
+        EXPECT_NE(count, 0u);
+
+        for (int32_t batchSize : {1, 3}) {
+            const std::vector<int32_t> dimensions = {batchSize, 16, 8, 8};
+            const std::vector<float> inputData(batchSize * 16 * 8 * 8, 1);
+            const ml::Input input = {{const_cast<float*>(inputData.data()),
+                                      inputData.size() * sizeof(float)},
+                                     dimensions.data(),
+                                     static_cast<uint32_t>(dimensions.size())};
+            ml::NamedInputs namedInputs = ml::CreateNamedInputs();
+            namedInputs.Set("input", &input);
+            std::vector<float> result(batchSize * 16 * 6 * 6);
+            const ml::ArrayBufferView output = {result.data(), result.size() * sizeof(float)};
+            ml::NamedOutputs namedOutputs = ml::CreateNamedOutputs();
+            namedOutputs.Set("output", &output);
+            EXPECT_EQ(graph.Compute(namedInputs, namedOutputs), ml::ComputeGraphStatus::Success);
+            EXPECT_EQ(GetContext()->GetPackedConstantCount(), count);
+        }
+    }
+
+}  // namespace
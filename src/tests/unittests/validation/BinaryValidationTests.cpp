@@ -45,3 +45,29 @@ TEST_F(BinaryValidationTest, InputsType) {
         ASSERT_CONTEXT_ERROR(mBuilder.Matmul(a, b));
     }
 }
+
+TEST_F(BinaryValidationTest, InputsShape) {
+    std::vector<int32_t> shape = {2, 3};
+    ml::OperandDescriptor inputDesc = {ml::OperandType::Float32, shape.data(),
+                                       (uint32_t)shape.size()};
+    ml::Operand a = mBuilder.Input("input", &inputDesc);
+    // success - broadcast along the first dimension
+    {
+        std::vector<int32_t> bShape = {1, 3};
+        std::vector<float> data(3, 1);
+        inputDesc = {ml::OperandType::Float32, bShape.data(), (uint32_t)bShape.size()};
+        ml::ArrayBufferView arrayBuffer = {data.data(), data.size() * sizeof(float)};
+        ml::Operand b = mBuilder.Constant(&inputDesc, &arrayBuffer);
+        ml::Operand add = mBuilder.Add(a, b);
+    }
+    // shapes are not broadcastable and the inner dimensions of matmul are inconsistent
+    {
+        std::vector<int32_t> bShape = {2, 2};
+        std::vector<float> data(4, 1);
+        inputDesc = {ml::OperandType::Float32, bShape.data(), (uint32_t)bShape.size()};
+        ml::ArrayBufferView arrayBuffer = {data.data(), data.size() * sizeof(float)};
+        ml::Operand b = mBuilder.Constant(&inputDesc, &arrayBuffer);
+        ASSERT_CONTEXT_ERROR(mBuilder.Add(a, b));
+        ASSERT_CONTEXT_ERROR(mBuilder.Matmul(a, b));
+    }
+}
@@ -111,3 +111,26 @@ TEST_F(Conv2dValidationTest, InvalidOptions) {
         ASSERT_CONTEXT_ERROR(mBuilder.Conv2d(mInput, mFilter, &options));
     }
 }
+
+TEST_F(Conv2dValidationTest, InconsistentShapeError) {
+    {
+        // the input channels of filter are not equal to the input channels of input
+        std::vector<int32_t> shape = {1, 2, 3, 3};
+        std::vector<float> data(18, 1);
+        ml::OperandDescriptor inputDesc = {ml::OperandType::Float32, shape.data(),
+                                           (uint32_t)shape.size()};
+        ml::ArrayBufferView arrayBuffer = {data.data(), data.size() * sizeof(float)};
+        ml::Operand filter = mBuilder.Constant(&inputDesc, &arrayBuffer);
+        ASSERT_CONTEXT_ERROR(mBuilder.Conv2d(mInput, filter));
+    }
+    {
+        // the filter is larger than the input
+        std::vector<int32_t> shape = {1, 1, 7, 7};
+        std::vector<float> data(49, 1);
+        ml::OperandDescriptor inputDesc = {ml::OperandType::Float32, shape.data(),
+                                           (uint32_t)shape.size()};
+        ml::ArrayBufferView arrayBuffer = {data.data(), data.size() * sizeof(float)};
+        ml::Operand filter = mBuilder.Constant(&inputDesc, &arrayBuffer);
+        ASSERT_CONTEXT_ERROR(mBuilder.Conv2d(mInput, filter));
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+using namespace testing;
+
+class QuantizeLinearValidationTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+        ml::OperandDescriptor inputDesc = {ml::OperandType::Float32, mShape.data(),
+                                           (uint32_t)mShape.size()};
+        mInput = mBuilder.Input("input", &inputDesc);
+    }
+    std::vector<int32_t> mShape = {2, 3};
+    ml::Operand mInput;
+};
+
+TEST_F(QuantizeLinearValidationTest, QuantizeDequantize) {
+    // Success
+    {
+        // quantize per tensor
+        std::vector<float> scales = {0.5};
+        std::vector<int32_t> zeroPoints = {1};
+        ml::OperandDescriptor desc = {ml::OperandType::Int8, mShape.data(),
+                                      (uint32_t)mShape.size()};
+        desc.scales = scales.data();
+        desc.scalesCount = scales.size();
+        desc.zeroPoints = zeroPoints.data();
+        desc.zeroPointsCount = zeroPoints.size();
+        ml::Operand quantized = mBuilder.QuantizeLinear(mInput, &desc);
+        ml::Operand dequantized = mBuilder.DequantizeLinear(quantized);
+    }
+    {
+        // quantize per channel
+        std::vector<float> scales = {0.5, 0.25, 1};
+        ml::OperandDescriptor desc = {ml::OperandType::Uint8, mShape.data(),
+                                      (uint32_t)mShape.size()};
+        desc.scales = scales.data();
+        desc.scalesCount = scales.size();
+        desc.axis = 1;
+        ml::Operand quantized = mBuilder.QuantizeLinear(mInput, &desc);
+    }
+}
+
+TEST_F(QuantizeLinearValidationTest, ScalesCountError) {
+    // the count of the scales doesn't match the dimension of the axis
+    std::vector<float> scales = {0.5, 0.25};
+    ml::OperandDescriptor desc = {ml::OperandType::Int8, mShape.data(), (uint32_t)mShape.size()};
+    desc.scales = scales.data();
+    desc.scalesCount = scales.size();
+    desc.axis = 1;
+    ASSERT_CONTEXT_ERROR(mBuilder.QuantizeLinear(mInput, &desc));
+}
+
+TEST_F(QuantizeLinearValidationTest, ZeroPointError) {
+    // the zero point is out of the range of uint8
+    std::vector<float> scales = {0.5};
+    std::vector<int32_t> zeroPoints = {-1};
+    ml::OperandDescriptor desc = {ml::OperandType::Uint8, mShape.data(),
+                                  (uint32_t)mShape.size()};
+    desc.scales = scales.data();
+    desc.scalesCount = scales.size();
+    desc.zeroPoints = zeroPoints.data();
+    desc.zeroPointsCount = zeroPoints.size();
+    ASSERT_CONTEXT_ERROR(mBuilder.QuantizeLinear(mInput, &desc));
+}
+
+TEST_F(QuantizeLinearValidationTest, TypeError) {
+    // the output type isn't quantized
+    std::vector<float> scales = {0.5};
+    ml::OperandDescriptor desc = {ml::OperandType::Float32, mShape.data(),
+                                  (uint32_t)mShape.size()};
+    desc.scales = scales.data();
+    desc.scalesCount = scales.size();
+    ASSERT_CONTEXT_ERROR(mBuilder.QuantizeLinear(mInput, &desc));
+    // the dequantized input isn't quantized
+    ASSERT_CONTEXT_ERROR(mBuilder.DequantizeLinear(mInput));
+}
@@ -40,4 +40,14 @@ TEST_F(ReshapeValidationTest, InputsType) {
         std::vector<int32_t> newShape = {-1, 2, -1, 4};
         ASSERT_CONTEXT_ERROR(mBuilder.Reshape(a, newShape.data(), newShape.size()));
     }
+    // the number of elements is changed
+    {
+        std::vector<int32_t> newShape = {2, 3, 5};
+        ASSERT_CONTEXT_ERROR(mBuilder.Reshape(a, newShape.data(), newShape.size()));
+    }
+    // the number of elements can't be divided by the known dimensions
+    {
+        std::vector<int32_t> newShape = {-1, 5};
+        ASSERT_CONTEXT_ERROR(mBuilder.Reshape(a, newShape.data(), newShape.size()));
+    }
 }
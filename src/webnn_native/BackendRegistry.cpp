@@ -0,0 +1,104 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/BackendRegistry.h"
+
+namespace webnn_native {
+
+    namespace null {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+    namespace ie {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+    namespace dml {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+    namespace onednn {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+    namespace xnnpack {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+    namespace reference {
+        ContextBase* Create(MLContextOptions const* options);
+    }
+
+    // static
+    const BackendRegistry& BackendRegistry::Get() {
+        static const BackendRegistry registry;
+        return registry;
+    }
+
+    // Should put the default null backend at the end.
+    BackendRegistry::BackendRegistry() {
+#if defined(WEBNN_ENABLE_BACKEND_OPENVINO)
+        Register(ml::BackendType::Openvino,
+                 {ml::DevicePreference::Cpu, ml::DevicePreference::Gpu}, ie::Create);
+#endif
+#if defined(WEBNN_ENABLE_BACKEND_DML)
+        Register(ml::BackendType::Dml, {ml::DevicePreference::Gpu, ml::DevicePreference::Cpu},
+                 dml::Create);
+#endif
+#if defined(WEBNN_ENABLE_BACKEND_ONEDNN)
+        Register(ml::BackendType::Onednn, {ml::DevicePreference::Cpu}, onednn::Create);
+#endif
+#if defined(WEBNN_ENABLE_BACKEND_XNNPACK)
+        Register(ml::BackendType::Xnnpack, {ml::DevicePreference::Cpu}, xnnpack::Create);
+#endif
+#if defined(WEBNN_ENABLE_BACKEND_REFERENCE)
+        Register(ml::BackendType::Reference, {ml::DevicePreference::Cpu}, reference::Create);
+#endif
+#if defined(WEBNN_ENABLE_BACKEND_NULL)
+        Register(ml::BackendType::Null, {}, null::Create);
+#endif
+    }
+
+    void BackendRegistry::Register(ml::BackendType type,
+                                   std::initializer_list<ml::DevicePreference> devices,
+                                   BackendFactory create) {
+        mBackends.push_back({type, devices, create});
+    }
+
+    const std::vector<BackendInfo>& BackendRegistry::GetBackends() const {
+        return mBackends;
+    }
+
+    const BackendInfo* BackendRegistry::Select(const ContextOptions& options) const {
+        if (mBackends.empty()) {
+            return nullptr;
+        }
+        if (options.backendType != ml::BackendType::Default) {
+            for (auto& backend : mBackends) {
+                if (backend.type == options.backendType) {
+                    return &backend;
+                }
+            }
+            return nullptr;
+        }
+        if (options.devicePreference != ml::DevicePreference::Default) {
+            for (auto& backend : mBackends) {
+                for (auto device : backend.devices) {
+                    if (device == options.devicePreference) {
+                        return &backend;
+                    }
+                }
+            }
+        }
+        // None of the backends computes on the preferred device, the device is then chosen by
+        // the backend of the highest priority.
+        return &mBackends.front();
+    }
+
+}  // namespace webnn_native
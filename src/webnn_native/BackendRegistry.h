@@ -0,0 +1,60 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_BACKEND_REGISTRY_H_
+#define WEBNN_NATIVE_BACKEND_REGISTRY_H_
+
+#include <initializer_list>
+#include <vector>
+
+#include "webnn_native/Forward.h"
+#include "webnn_native/webnn_platform.h"
+
+namespace webnn_native {
+
+    using BackendFactory = ContextBase* (*)(MLContextOptions const* options);
+
+    struct BackendInfo {
+        ml::BackendType type;
+        // The devices that the backend computes on, which are matched with the device
+        // preference of the context options.
+        std::vector<ml::DevicePreference> devices;
+        BackendFactory create;
+    };
+
+    // The backends compiled in the build. The context options either name a backend or let the
+    // registry select the first backend, in the order of registration, that computes on the
+    // preferred device.
+    class BackendRegistry {
+      public:
+        static const BackendRegistry& Get();
+
+        const std::vector<BackendInfo>& GetBackends() const;
+        // Returns nullptr if the named backend isn't compiled in the build.
+        const BackendInfo* Select(const ContextOptions& options) const;
+
+      private:
+        BackendRegistry();
+        ~BackendRegistry() = default;
+
+        void Register(ml::BackendType type,
+                      std::initializer_list<ml::DevicePreference> devices,
+                      BackendFactory create);
+
+        std::vector<BackendInfo> mBackends;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_BACKEND_REGISTRY_H_
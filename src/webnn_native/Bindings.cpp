@@ -0,0 +1,107 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/Bindings.h"
+
+#include <string>
+
+namespace webnn_native {
+
+    BindingsBase::BindingsBase(GraphBase* graph)
+        : ObjectBase(graph->GetContext()),
+          mGraph(graph),
+          mInputs(graph->GetInputNames().size()),
+          mInputDimensions(graph->GetInputNames().size()),
+          mInputBound(graph->GetInputNames().size(), false),
+          mOutputs(graph->GetOutputNames().size()),
+          mOutputBound(graph->GetOutputNames().size(), false),
+          mNamedInputs(AcquireRef(new NamedInputsBase())),
+          mNamedOutputs(AcquireRef(new NamedOutputsBase())) {
+    }
+
+    void BindingsBase::SetInput(char const* name, Input const* input) {
+        uint32_t index;
+        if (GetContext()->ConsumedError(mGraph->GetInputIndex(name), &index)) {
+            return;
+        }
+        if (input == nullptr || input->resource.buffer == nullptr) {
+            GetContext()->ConsumedError(
+                DAWN_VALIDATION_ERROR("The buffer of input " + std::string(name) + " is null."));
+            return;
+        }
+        mInputs[index] = *input;
+        if (input->dimensions == nullptr || input->dimensionsCount == 0) {
+            // A previous binding may have left dimensions behind, drop them with the pointer.
+            mInputDimensions[index].clear();
+            mInputs[index].dimensions = nullptr;
+            mInputs[index].dimensionsCount = 0;
+        } else {
+            // The dimensions are copied because the structure is read at every compute.
+            mInputDimensions[index].assign(input->dimensions,
+                                           input->dimensions + input->dimensionsCount);
+            mInputs[index].dimensions = mInputDimensions[index].data();
+        }
+        mInputBound[index] = true;
+        mNamedInputs->Set(name, &mInputs[index]);
+    }
+
+    void BindingsBase::SetOutput(char const* name, ArrayBufferView const* resource) {
+        uint32_t index;
+        if (GetContext()->ConsumedError(mGraph->GetOutputIndex(name), &index)) {
+            return;
+        }
+        // The size is validated once here instead of at every compute, except for the dynamic
+        // batch whose outputs are validated at compute against the graph of the batch size.
+        size_t byteLength = mGraph->HasDynamicBatch() ? 0 : mGraph->GetOutputByteLength(index);
+        if (resource == nullptr || resource->buffer == nullptr ||
+            resource->byteLength < byteLength) {
+            GetContext()->ConsumedError(DAWN_VALIDATION_ERROR(
+                "The output buffer of " + std::string(name) + " is too small."));
+            return;
+        }
+        mOutputs[index] = *resource;
+        mOutputBound[index] = true;
+        mNamedOutputs->Set(name, &mOutputs[index]);
+    }
+
+    GraphBase* BindingsBase::GetGraph() const {
+        return mGraph.Get();
+    }
+
+    const Input* BindingsBase::GetInput(uint32_t index) const {
+        return mInputBound[index] ? &mInputs[index] : nullptr;
+    }
+
+    const ArrayBufferView* BindingsBase::GetOutput(uint32_t index) const {
+        return mOutputBound[index] ? &mOutputs[index] : nullptr;
+    }
+
+    const char* BindingsBase::GetUnboundInput() const {
+        for (size_t i = 0; i < mInputBound.size(); ++i) {
+            if (!mInputBound[i]) {
+                return mGraph->GetInputNames()[i].c_str();
+            }
+        }
+        return nullptr;
+    }
+
+    NamedInputsBase* BindingsBase::GetNamedInputs() const {
+        return mNamedInputs.Get();
+    }
+
+    NamedOutputsBase* BindingsBase::GetNamedOutputs() const {
+        return mNamedOutputs.Get();
+    }
+
+}  // namespace webnn_native
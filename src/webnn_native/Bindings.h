@@ -0,0 +1,65 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_BINDINGS_H_
+#define WEBNN_NATIVE_BINDINGS_H_
+
+#include <vector>
+
+#include "common/RefCounted.h"
+#include "webnn_native/Graph.h"
+#include "webnn_native/NamedInputs.h"
+#include "webnn_native/NamedOutputs.h"
+#include "webnn_native/ObjectBase.h"
+#include "webnn_native/webnn_platform.h"
+
+namespace webnn_native {
+
+    // The buffers bound to the inputs and outputs of a graph. The names are resolved to the
+    // indices of the graph when the buffers are set, so computing with the bindings doesn't look
+    // up any name. The structures are copied, the buffers must be kept alive by the caller.
+    class BindingsBase : public ObjectBase {
+      public:
+        explicit BindingsBase(GraphBase* graph);
+        ~BindingsBase() override = default;
+
+        // WebNN API
+        void SetInput(char const* name, Input const* input);
+        void SetOutput(char const* name, ArrayBufferView const* resource);
+
+        // Other methods
+        GraphBase* GetGraph() const;
+        // Return nullptr if the input or output of the index isn't bound.
+        const Input* GetInput(uint32_t index) const;
+        const ArrayBufferView* GetOutput(uint32_t index) const;
+        // Return the name of the first input that isn't bound, or nullptr if all are bound.
+        const char* GetUnboundInput() const;
+        // The same bindings as named records for the backends that compute by names.
+        NamedInputsBase* GetNamedInputs() const;
+        NamedOutputsBase* GetNamedOutputs() const;
+
+      private:
+        Ref<GraphBase> mGraph;
+        std::vector<Input> mInputs;
+        std::vector<std::vector<int32_t>> mInputDimensions;
+        std::vector<bool> mInputBound;
+        std::vector<ArrayBufferView> mOutputs;
+        std::vector<bool> mOutputBound;
+        Ref<NamedInputsBase> mNamedInputs;
+        Ref<NamedOutputsBase> mNamedOutputs;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_BINDINGS_H_
@@ -24,6 +24,11 @@ namespace webnn_native {
     ContextBase::ContextBase(ContextOptions const* options) {
         if (options != nullptr) {
             mContextOptions = *options;
+            // Own the strings so that the options stay valid after the creation.
+            if (options->cacheDirectory != nullptr) {
+                mCacheDirectory = options->cacheDirectory;
+                mContextOptions.cacheDirectory = mCacheDirectory.c_str();
+            }
         }
         mRootErrorScope = AcquireRef(new ErrorScope());
         mCurrentErrorScope = mRootErrorScope.Get();
@@ -33,6 +38,10 @@ namespace webnn_native {
         return CreateGraphImpl();
     }
 
+    bool ContextBase::SupportsOperator(const OperatorBase* op) const {
+        return true;
+    }
+
     void ContextBase::PushErrorScope(ml::ErrorFilter filter) {
         if (ConsumedError(ValidateErrorFilter(filter))) {
             return;
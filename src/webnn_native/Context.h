@@ -15,9 +15,12 @@
 #ifndef WEBNN_NATIVE_CONTEXT_H_
 #define WEBNN_NATIVE_CONTEXT_H_
 
+#include <string>
+
 #include "common/RefCounted.h"
 #include "webnn_native/Error.h"
 #include "webnn_native/ErrorScope.h"
+#include "webnn_native/FusionRegistry.h"
 #include "webnn_native/webnn_platform.h"
 
 class WebGLRenderingContext;
@@ -36,6 +39,16 @@ namespace webnn_native {
             return false;
         }
 
+        template <typename T>
+        bool ConsumedError(ResultOrError<T> resultOrError, T* result) {
+            if (DAWN_UNLIKELY(resultOrError.IsError())) {
+                HandleError(resultOrError.AcquireError());
+                return true;
+            }
+            *result = resultOrError.AcquireSuccess();
+            return false;
+        }
+
         GraphBase* CreateGraph();
 
         // Dawn API
@@ -45,6 +58,17 @@ namespace webnn_native {
         ContextOptions GetContextOptions() {
             return mContextOptions;
         }
+        const FusionRegistry& GetFusionRegistry() const {
+            return mFusionRegistry;
+        }
+        // Whether the backend computes the operator, all of them by default. The backends look
+        // at the options of the operator, e.g. the layouts, besides its type.
+        virtual bool SupportsOperator(const OperatorBase* op) const;
+
+      protected:
+        // The operator + activation patterns that the backend fuses, which are registered by
+        // the backend context.
+        FusionRegistry mFusionRegistry;
 
       private:
         // Create concrete model.
@@ -56,6 +80,7 @@ namespace webnn_native {
         Ref<ErrorScope> mCurrentErrorScope;
 
         ContextOptions mContextOptions;
+        std::string mCacheDirectory;
     };
 
 }  // namespace webnn_native
@@ -0,0 +1,179 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/CpuInfo.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "common/Platform.h"
+
+#if defined(DAWN_PLATFORM_LINUX)
+#    include <sched.h>
+#    include <cmath>
+#    include <cstdlib>
+#    include <fstream>
+#    include <set>
+#    include <string>
+#    include <utility>
+#endif
+
+namespace webnn_native {
+
+    namespace {
+
+#if defined(DAWN_PLATFORM_LINUX)
+        // Returns 0 if the file can't be read.
+        int64_t ReadInteger(const std::string& path) {
+            std::ifstream file(path);
+            int64_t value = 0;
+            if (!(file >> value)) {
+                return 0;
+            }
+            return value;
+        }
+
+        // The count of the distinct cores of the CPUs in the affinity mask of the process.
+        uint32_t GetAffinityCoreCount() {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+                return 0;
+            }
+            std::set<std::pair<int64_t, int64_t>> cores;
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (!CPU_ISSET(cpu, &cpuSet)) {
+                    continue;
+                }
+                const std::string topology =
+                    "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+                std::ifstream coreIdFile(topology + "core_id");
+                if (!coreIdFile.good()) {
+                    // The topology isn't exposed, count the logical processors instead.
+                    return CPU_COUNT(&cpuSet);
+                }
+                cores.insert({ReadInteger(topology + "physical_package_id"),
+                              ReadInteger(topology + "core_id")});
+            }
+            return cores.size();
+        }
+
+        // The path of the cgroup of the process relative to the mount point of the hierarchy,
+        // from the "<id>:<controllers>:<path>" lines of /proc/self/cgroup. The cgroup v2 line
+        // has an empty controller list, the cgroup v1 one lists the cpu controller.
+        std::string GetCgroupPath(bool unified) {
+            std::ifstream file("/proc/self/cgroup");
+            std::string line;
+            while (std::getline(file, line)) {
+                size_t first = line.find(':');
+                size_t second = line.find(':', first + 1);
+                if (first == std::string::npos || second == std::string::npos) {
+                    continue;
+                }
+                std::string controllers = line.substr(first + 1, second - first - 1);
+                bool matches = false;
+                if (unified) {
+                    matches = controllers.empty();
+                } else {
+                    size_t begin = 0;
+                    while (!matches && begin <= controllers.size()) {
+                        size_t end = controllers.find(',', begin);
+                        if (end == std::string::npos) {
+                            end = controllers.size();
+                        }
+                        matches = controllers.compare(begin, end - begin, "cpu") == 0;
+                        begin = end + 1;
+                    }
+                }
+                if (matches) {
+                    return line.substr(second + 1);
+                }
+            }
+            return "/";
+        }
+
+        // The quota in cores of the cgroup directory, 0 if it has no quota or can't be read.
+        double ReadCgroupQuota(const std::string& directory, bool unified) {
+            int64_t quota = 0;
+            int64_t period = 0;
+            if (unified) {
+                // cgroup v2 has "<quota> <period>" or "max <period>" in cpu.max.
+                std::ifstream cpuMax(directory + "/cpu.max");
+                std::string quotaString;
+                if (cpuMax >> quotaString >> period) {
+                    quota = quotaString == "max" ? 0
+                                                 : std::strtoll(quotaString.c_str(), nullptr, 10);
+                }
+            } else {
+                // cgroup v1 has -1 in cpu.cfs_quota_us if there is no quota.
+                quota = ReadInteger(directory + "/cpu.cfs_quota_us");
+                period = ReadInteger(directory + "/cpu.cfs_period_us");
+            }
+            if (quota <= 0 || period <= 0) {
+                return 0;
+            }
+            return static_cast<double>(quota) / period;
+        }
+
+        // The CPU quota of the cgroup of the process rounded up to whole cores, 0 if there is
+        // no quota. The quotas of the ancestors also limit the process, so the smallest one
+        // on the path up to the mount point is used.
+        uint32_t GetCgroupQuotaCoreCount() {
+            bool unified = std::ifstream("/sys/fs/cgroup/cgroup.controllers").good();
+            std::string mountPoint = unified ? "/sys/fs/cgroup" : "/sys/fs/cgroup/cpu";
+            std::string path = GetCgroupPath(unified);
+            // In a cgroup namespace or a container the path may not be visible in the mount,
+            // only the mount point itself is read then.
+            std::ifstream probe(mountPoint + path + (unified ? "/cpu.max" : "/cpu.cfs_period_us"));
+            if (!probe.good()) {
+                path = "/";
+            }
+            double coreQuota = 0;
+            while (true) {
+                double quota = ReadCgroupQuota(mountPoint + (path == "/" ? "" : path), unified);
+                if (quota > 0) {
+                    coreQuota = coreQuota == 0 ? quota : std::min(coreQuota, quota);
+                }
+                size_t slash = path.find_last_of('/');
+                if (path == "/" || slash == std::string::npos) {
+                    break;
+                }
+                path = slash == 0 ? "/" : path.substr(0, slash);
+            }
+            if (coreQuota == 0) {
+                return 0;
+            }
+            return static_cast<uint32_t>(std::ceil(coreQuota));
+        }
+#endif
+
+    }  // namespace
+
+    uint32_t GetAvailableCoreCount() {
+        uint32_t coreCount = 0;
+#if defined(DAWN_PLATFORM_LINUX)
+        coreCount = GetAffinityCoreCount();
+        uint32_t quotaCoreCount = GetCgroupQuotaCoreCount();
+        if (quotaCoreCount != 0) {
+            coreCount = coreCount == 0 ? quotaCoreCount : std::min(coreCount, quotaCoreCount);
+        }
+#endif
+        if (coreCount == 0) {
+            // Assume two hyper-threads per core.
+            coreCount = std::thread::hardware_concurrency() / 2;
+        }
+        return std::max(coreCount, 1u);
+    }
+
+}  // namespace webnn_native
@@ -0,0 +1,29 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_CPU_INFO_H_
+#define WEBNN_NATIVE_CPU_INFO_H_
+
+#include <cstdint>
+
+namespace webnn_native {
+
+    // The number of cores that the process may run on, which accounts for the affinity mask of
+    // the process and the CPU quota of its cgroup on Linux. The hyper-threads of a core are
+    // counted once since they share the execution units of the core.
+    uint32_t GetAvailableCoreCount();
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_CPU_INFO_H_
@@ -0,0 +1,95 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/Float16.h"
+
+#include <cstring>
+
+namespace webnn_native {
+
+    uint16_t Float32ToFloat16(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+        const uint32_t absBits = bits & 0x7FFFFFFF;
+        if (absBits >= 0x7F800000) {
+            // The infinities, and the NaNs that stay quiet NaNs.
+            return sign | 0x7C00 | (absBits > 0x7F800000 ? 0x200 : 0);
+        }
+        if (absBits >= 0x477FF000) {
+            // The values from 65520 round to the infinity.
+            return sign | 0x7C00;
+        }
+        if (absBits < 0x38800000) {
+            // The values below 2^-14 are subnormals, and the ones up to 2^-25 round to zero.
+            if (absBits <= 0x33000000) {
+                return sign;
+            }
+            const uint32_t shift = 126 - (absBits >> 23);
+            const uint32_t mantissa = (absBits & 0x7FFFFF) | 0x800000;
+            uint32_t half = mantissa >> shift;
+            const uint32_t remainder = mantissa & ((1u << shift) - 1);
+            const uint32_t halfway = 1u << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (half & 1))) {
+                ++half;
+            }
+            return sign | static_cast<uint16_t>(half);
+        }
+        // Rebias the exponent from 127 to 15 and round the 13 dropped bits of the mantissa.
+        uint32_t half = (absBits - 0x38000000) >> 13;
+        const uint32_t remainder = absBits & 0x1FFF;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+            ++half;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    float Float16ToFloat32(uint16_t value) {
+        const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+        uint32_t exponent = (value >> 10) & 0x1F;
+        uint32_t mantissa = value & 0x3FF;
+        uint32_t bits;
+        if (exponent == 0x1F) {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        } else if (exponent != 0) {
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        } else if (mantissa == 0) {
+            bits = sign;
+        } else {
+            // Normalize the subnormal.
+            exponent = 113;
+            while ((mantissa & 0x400) == 0) {
+                mantissa <<= 1;
+                --exponent;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+        }
+        float result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    void Float32ToFloat16(const float* src, uint16_t* dst, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = Float32ToFloat16(src[i]);
+        }
+    }
+
+    void Float16ToFloat32(const uint16_t* src, float* dst, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = Float16ToFloat32(src[i]);
+        }
+    }
+
+}  // namespace webnn_native
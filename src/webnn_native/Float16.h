@@ -0,0 +1,33 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_FLOAT16_H_
+#define WEBNN_NATIVE_FLOAT16_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace webnn_native {
+
+    // The conversions between float32 and the bits of IEEE 754 half precision floats, which
+    // round to the nearest even value and keep the infinities, the NaNs and the subnormals.
+    uint16_t Float32ToFloat16(float value);
+    float Float16ToFloat32(uint16_t value);
+
+    void Float32ToFloat16(const float* src, uint16_t* dst, size_t count);
+    void Float16ToFloat32(const uint16_t* src, float* dst, size_t count);
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_FLOAT16_H_
@@ -23,7 +23,9 @@ class Ref;
 
 namespace webnn_native {
 
+    class BindingsBase;
     class CompilationBase;
+    class ContextBase;
     class GraphBase;
     class GraphBuilderBase;
     class NamedInputsBase;
@@ -35,6 +37,9 @@ namespace webnn_native {
     class OperatorBase;
     class ResultBase;
 
+    enum class FusedOperator : uint32_t;
+    enum class OperatorType : uint32_t;
+
 }  // namespace webnn_native
 
 #endif  // WEBNN_NATIVE_FORWARD_H_
@@ -0,0 +1,32 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/FusionRegistry.h"
+
+#include "webnn_native/Operator.h"
+
+namespace webnn_native {
+
+    void FusionRegistry::Register(OperatorType type,
+                                  std::initializer_list<FusedOperator> activations) {
+        for (auto activation : activations) {
+            mPatterns.insert(std::make_pair(type, activation));
+        }
+    }
+
+    bool FusionRegistry::CanFuse(OperatorType type, FusedOperator activation) const {
+        return mPatterns.find(std::make_pair(type, activation)) != mPatterns.end();
+    }
+
+}  // namespace webnn_native
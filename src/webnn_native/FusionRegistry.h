@@ -0,0 +1,44 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_FUSION_REGISTRY_H_
+#define WEBNN_NATIVE_FUSION_REGISTRY_H_
+
+#include <initializer_list>
+#include <set>
+#include <utility>
+
+#include "webnn_native/Forward.h"
+
+namespace webnn_native {
+
+    // The patterns of an operator followed by an activation that a backend computes in a single
+    // kernel, e.g. conv2d + relu. Each backend registers its patterns when the context is
+    // created, the OperatorFusion pass fuses the matched activations into the preceding
+    // operator and leaves the others as standalone operators.
+    class FusionRegistry {
+      public:
+        FusionRegistry() = default;
+        ~FusionRegistry() = default;
+
+        void Register(OperatorType type, std::initializer_list<FusedOperator> activations);
+        bool CanFuse(OperatorType type, FusedOperator activation) const;
+
+      private:
+        std::set<std::pair<OperatorType, FusedOperator>> mPatterns;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_FUSION_REGISTRY_H_
@@ -14,11 +14,20 @@
 
 #include "webnn_native/Graph.h"
 
+#include <algorithm>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "common/Assert.h"
 #include "common/Log.h"
 #include "common/RefCounted.h"
+#include "webnn_native/Bindings.h"
+#include "webnn_native/NamedInputs.h"
+#include "webnn_native/NamedOutputs.h"
+#include "webnn_native/PartitionedGraph.h"
+#include "webnn_native/ShapeUtils.h"
+#include "webnn_native/ops/Input.h"
 
 namespace webnn_native {
 
@@ -105,6 +114,14 @@ namespace webnn_native {
         return DAWN_UNIMPLEMENTED_ERROR("AddInstanceNorm");
     }
 
+    MaybeError GraphBase::AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddQuantizeLinear");
+    }
+
+    MaybeError GraphBase::AddDequantizeLinear(const op::DequantizeLinear* dequantizeLinear) {
+        return DAWN_UNIMPLEMENTED_ERROR("AddDequantizeLinear");
+    }
+
     MaybeError GraphBase::Finish() {
         UNREACHABLE();
     }
@@ -113,12 +130,345 @@ namespace webnn_native {
         return CompileImpl();
     }
 
+    MaybeError GraphBase::Build(const std::vector<Ref<OperatorBase>>& operators,
+                                const std::map<std::string, const OperandBase*>& outputs) {
+        if (UsesMemoryPlan()) {
+            std::unordered_set<const OperandBase*> outputOperands;
+            for (auto& output : outputs) {
+                outputOperands.insert(output.second);
+            }
+            SetMemoryPlan(MemoryPlan::Create(operators, outputOperands));
+        }
+        mOperators = operators;
+        for (auto& op : operators) {
+            DAWN_TRY(op->AddToGraph(this));
+        }
+        for (auto& output : outputs) {
+            RecordOutput(output.first, output.second);
+            DAWN_TRY(AddOutput(output.first, output.second));
+        }
+        for (auto& op : operators) {
+            if (op->GetOperatorType() == OperatorType::Input) {
+                RecordInput(static_cast<const op::Input*>(op.Get())->GetName());
+            }
+        }
+        return Finish();
+    }
+
+    MaybeError GraphBase::EnableDynamicBatch(
+        GraphBuilderBase* builder,
+        const std::vector<Ref<OperatorBase>>& operators,
+        const std::map<std::string, const OperandBase*>& outputs) {
+        for (auto& op : operators) {
+            if (op->GetOperatorType() != OperatorType::Input) {
+                continue;
+            }
+            const std::vector<int32_t>& shape = op->PrimaryOutput()->Shape();
+            if (shape.empty() || (mBatchSize != 0 && shape[0] != mBatchSize)) {
+                continue;
+            }
+            mBatchSize = shape[0];
+            mBatchInputs[static_cast<const op::Input*>(op.Get())->GetName()] = shape;
+        }
+        if (mBatchInputs.empty()) {
+            return {};
+        }
+        std::unordered_map<const OperandBase*, OperandBase*> operands;
+        DAWN_TRY_ASSIGN(mBatchOperators, CloneOperators(builder, operators, &operands, true));
+        for (auto& output : outputs) {
+            mBatchOutputs[output.first] = operands.at(output.second);
+        }
+        mBatchBuilder = builder;
+        return {};
+    }
+
+    bool GraphBase::HasDynamicBatch() const {
+        return !mBatchOperators.empty();
+    }
+
+    ResultOrError<GraphBase*> GraphBase::GetBatchGraph(NamedInputsBase* inputs) {
+        if (mBatchOperators.empty()) {
+            return this;
+        }
+        int32_t batchSize = 0;
+        for (auto& namedInput : inputs->GetRecords()) {
+            const Input* input = namedInput.second;
+            auto batchInput = mBatchInputs.find(namedInput.first);
+            if (input->dimensions == nullptr || batchInput == mBatchInputs.end()) {
+                continue;
+            }
+            const std::vector<int32_t>& dimensions = batchInput->second;
+            if (input->dimensionsCount != dimensions.size() ||
+                !std::equal(dimensions.begin() + 1, dimensions.end(), input->dimensions + 1)) {
+                return DAWN_VALIDATION_ERROR("The dimensions of input " + namedInput.first +
+                                             " differ from the built ones beyond the batch size.");
+            }
+            if (input->dimensions[0] <= 0 ||
+                (batchSize != 0 && input->dimensions[0] != batchSize)) {
+                return DAWN_VALIDATION_ERROR("The batch size of input " + namedInput.first +
+                                             " is invalid or inconsistent.");
+            }
+            batchSize = input->dimensions[0];
+        }
+        if (batchSize == 0 || batchSize == mBatchSize) {
+            return this;
+        }
+
+        std::lock_guard<std::mutex> lock(mBatchMutex);
+        auto batchGraph = mBatchGraphs.find(batchSize);
+        if (batchGraph != mBatchGraphs.end()) {
+            return batchGraph->second.Get();
+        }
+        GraphBase* result;
+        DAWN_TRY_ASSIGN(result, BuildBatchGraph(batchSize));
+        mBatchGraphs[batchSize] = AcquireRef(result);
+        dawn::InfoLog() << "The graph is built for the batch size " << batchSize << ".";
+        return result;
+    }
+
+    ResultOrError<GraphBase*> GraphBase::BuildBatchGraph(int32_t batchSize) {
+        std::unordered_map<const OperandBase*, OperandBase*> operands;
+        std::vector<Ref<OperatorBase>> operators;
+        DAWN_TRY_ASSIGN(operators, CloneOperators(mBatchBuilder.Get(), mBatchOperators, &operands));
+        DAWN_TRY(SetBatchSize(operators, batchSize));
+        std::map<std::string, const OperandBase*> outputs;
+        for (auto& output : mBatchOutputs) {
+            outputs[output.first] = operands.at(output.second);
+        }
+        // The batch size may change the operators that the backend supports, e.g. the shapes.
+        bool supported = true;
+        for (auto& op : operators) {
+            supported = supported && GetContext()->SupportsOperator(op.Get());
+        }
+        Ref<GraphBase> graph;
+        if (supported) {
+            graph = AcquireRef(GetContext()->CreateGraph());
+            DAWN_TRY(graph->Build(operators, outputs));
+        } else {
+            PartitionedGraph* partitionedGraph = new PartitionedGraph(GetContext());
+            graph = AcquireRef(static_cast<GraphBase*>(partitionedGraph));
+            DAWN_TRY(partitionedGraph->Partition(mBatchBuilder.Get(), operators, outputs));
+        }
+        DAWN_TRY(graph->Compile());
+        return graph.Detach();
+    }
+
+    MaybeError GraphBase::SetBatchSize(const std::vector<Ref<OperatorBase>>& operators,
+                                       int32_t batchSize) {
+        for (auto& op : operators) {
+            if (op->GetOperatorType() == OperatorType::Constant) {
+                continue;
+            }
+            if (op->GetOperatorType() != OperatorType::Input) {
+                DAWN_TRY(op->Validate());
+                continue;
+            }
+            op::Input* input = static_cast<op::Input*>(op.Get());
+            auto batchInput = mBatchInputs.find(input->GetName());
+            if (batchInput != mBatchInputs.end()) {
+                std::vector<int32_t> dimensions = batchInput->second;
+                dimensions[0] = batchSize;
+                input->SetDimensions(std::move(dimensions));
+            }
+        }
+        return {};
+    }
+
+    void GraphBase::RecordInput(const std::string& name) {
+        mInputIndices[name] = mInputNames.size();
+        mInputNames.push_back(name);
+    }
+
+    void GraphBase::RecordOutput(const std::string& name, const OperandBase* output) {
+        mOutputIndices[name] = mOutputNames.size();
+        mOutputNames.push_back(name);
+        const std::vector<int32_t>& shape = output->Shape();
+        for (auto dim : shape) {
+            if (dim < 0) {
+                // The output size is unknown until compute.
+                mOutputByteLengths.push_back(0);
+                return;
+            }
+        }
+        mOutputByteLengths.push_back(SizeOfShape(shape) * SizeOfOperandType(output->Type()));
+    }
+
+    const std::vector<std::string>& GraphBase::GetInputNames() const {
+        return mInputNames;
+    }
+
+    const std::vector<std::string>& GraphBase::GetOutputNames() const {
+        return mOutputNames;
+    }
+
+    ResultOrError<uint32_t> GraphBase::GetInputIndex(const std::string& name) const {
+        auto iter = mInputIndices.find(name);
+        if (iter == mInputIndices.end()) {
+            return DAWN_VALIDATION_ERROR("The input " + name + " isn't found.");
+        }
+        return iter->second;
+    }
+
+    ResultOrError<uint32_t> GraphBase::GetOutputIndex(const std::string& name) const {
+        auto iter = mOutputIndices.find(name);
+        if (iter == mOutputIndices.end()) {
+            return DAWN_VALIDATION_ERROR("The output " + name + " isn't found.");
+        }
+        return iter->second;
+    }
+
+    size_t GraphBase::GetOutputByteLength(uint32_t index) const {
+        return mOutputByteLengths[index];
+    }
+
+    void GraphBase::SetMemoryPlan(MemoryPlan memoryPlan) {
+        mMemoryPlan = std::move(memoryPlan);
+    }
+
+    const MemoryPlan& GraphBase::GetMemoryPlan() const {
+        return mMemoryPlan;
+    }
+
+    MaybeError GraphBase::ValidateOutputs(NamedOutputsBase* outputs) const {
+        for (auto& namedOutput : outputs->GetRecords()) {
+            auto iter = mOutputIndices.find(namedOutput.first);
+            if (iter == mOutputIndices.end() || mOutputByteLengths[iter->second] == 0) {
+                continue;
+            }
+            const ArrayBufferView* resource = namedOutput.second;
+            if (resource->buffer == nullptr ||
+                resource->byteLength < mOutputByteLengths[iter->second]) {
+                return DAWN_VALIDATION_ERROR("The output buffer of " + namedOutput.first +
+                                             " is too small.");
+            }
+        }
+        return {};
+    }
+
     MLComputeGraphStatus GraphBase::Compute(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
         if (inputs == nullptr || outputs == nullptr) {
             return MLComputeGraphStatus_Error;
         }
+        GraphBase* graph;
+        if (GetContext()->ConsumedError(GetBatchGraph(inputs), &graph)) {
+            return MLComputeGraphStatus_Error;
+        }
+        if (graph != this) {
+            return graph->Compute(inputs, outputs);
+        }
+        if (GetContext()->ConsumedError(ValidateOutputs(outputs))) {
+            return MLComputeGraphStatus_Error;
+        }
 
+        std::unique_lock<std::mutex> lock(mComputeMutex, std::defer_lock);
+        if (!SupportsConcurrentCompute()) {
+            lock.lock();
+        }
         return ComputeImpl(inputs, outputs);
     }
 
+    void GraphBase::ComputeAsync(NamedInputsBase* inputs,
+                                 NamedOutputsBase* outputs,
+                                 ml::ComputeAsyncCallback callback,
+                                 void* userdata) {
+        if (callback == nullptr) {
+            GetContext()->ConsumedError(DAWN_VALIDATION_ERROR("The callback is null."));
+            return;
+        }
+        if (inputs == nullptr || outputs == nullptr) {
+            callback(MLComputeGraphStatus_Error, userdata);
+            return;
+        }
+        GraphBase* graph;
+        if (GetContext()->ConsumedError(GetBatchGraph(inputs), &graph)) {
+            callback(MLComputeGraphStatus_Error, userdata);
+            return;
+        }
+        if (graph != this) {
+            graph->ComputeAsync(inputs, outputs, callback, userdata);
+            return;
+        }
+        if (GetContext()->ConsumedError(ValidateOutputs(outputs))) {
+            callback(MLComputeGraphStatus_Error, userdata);
+            return;
+        }
+
+        ComputeAsyncImpl(inputs, outputs, callback, userdata);
+    }
+
+    void GraphBase::ComputeAsyncImpl(NamedInputsBase* inputs,
+                                     NamedOutputsBase* outputs,
+                                     ml::ComputeAsyncCallback callback,
+                                     void* userdata) {
+        // The graph and the named records are referenced until the task is done, they may be
+        // released by the task on the worker thread.
+        Ref<GraphBase> graph(this);
+        Ref<NamedInputsBase> namedInputs(inputs);
+        Ref<NamedOutputsBase> namedOutputs(outputs);
+        mTaskQueue.Post([graph, namedInputs, namedOutputs, callback, userdata]() {
+            MLComputeGraphStatus status;
+            {
+                std::unique_lock<std::mutex> lock(graph->mComputeMutex, std::defer_lock);
+                if (!graph->SupportsConcurrentCompute()) {
+                    lock.lock();
+                }
+                status = graph->ComputeImpl(namedInputs.Get(), namedOutputs.Get());
+            }
+            callback(status, userdata);
+        });
+    }
+
+    void GraphBase::ReleaseOnWorkerThread(Ref<GraphBase> graph) {
+        mTaskQueue.Post([graph = std::move(graph)]() {});
+    }
+
+    BindingsBase* GraphBase::CreateBindings() {
+        return new BindingsBase(this);
+    }
+
+    MLComputeGraphStatus GraphBase::ComputeBindings(BindingsBase* bindings) {
+        if (bindings == nullptr || bindings->GetGraph() != this) {
+            GetContext()->ConsumedError(
+                DAWN_VALIDATION_ERROR("The bindings aren't created by the graph."));
+            return MLComputeGraphStatus_Error;
+        }
+        // The outputs are validated when they are bound unless the dynamic batch is enabled.
+        const char* unboundInput = bindings->GetUnboundInput();
+        if (unboundInput != nullptr) {
+            GetContext()->ConsumedError(
+                DAWN_VALIDATION_ERROR("The input " + std::string(unboundInput) + " isn't bound."));
+            return MLComputeGraphStatus_Error;
+        }
+        // The bindings of another batch size are computed by names on the graph of the size.
+        GraphBase* graph;
+        if (GetContext()->ConsumedError(GetBatchGraph(bindings->GetNamedInputs()), &graph)) {
+            return MLComputeGraphStatus_Error;
+        }
+        if (graph != this) {
+            return graph->Compute(bindings->GetNamedInputs(), bindings->GetNamedOutputs());
+        }
+        if (HasDynamicBatch() &&
+            GetContext()->ConsumedError(ValidateOutputs(bindings->GetNamedOutputs()))) {
+            return MLComputeGraphStatus_Error;
+        }
+
+        std::unique_lock<std::mutex> lock(mComputeMutex, std::defer_lock);
+        if (!SupportsConcurrentCompute()) {
+            lock.lock();
+        }
+        return ComputeBindingsImpl(bindings);
+    }
+
+    MLComputeGraphStatus GraphBase::ComputeBindingsImpl(BindingsBase* bindings) {
+        return ComputeImpl(bindings->GetNamedInputs(), bindings->GetNamedOutputs());
+    }
+
+    bool GraphBase::SupportsConcurrentCompute() const {
+        return false;
+    }
+
+    bool GraphBase::UsesMemoryPlan() const {
+        return false;
+    }
+
 }  // namespace webnn_native
@@ -15,13 +15,21 @@
 #ifndef WEBNN_NATIVE_GRAPH_H_
 #define WEBNN_NATIVE_GRAPH_H_
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "common/RefCounted.h"
 #include "webnn_native/Context.h"
 #include "webnn_native/Error.h"
 #include "webnn_native/Forward.h"
 #include "webnn_native/GraphBuilder.h"
+#include "webnn_native/MemoryPlanner.h"
 #include "webnn_native/ObjectBase.h"
 #include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/TaskQueue.h"
 #include "webnn_native/webnn_platform.h"
 
 namespace webnn_native {
@@ -46,6 +54,8 @@ namespace webnn_native {
         class Gemm;
         class Clamp;
         class InstanceNorm;
+        class QuantizeLinear;
+        class DequantizeLinear;
     }  // namespace op
 
     class GraphBase : public ObjectBase {
@@ -73,16 +83,113 @@ namespace webnn_native {
         virtual MaybeError AddGemm(const op::Gemm* gemm);
         virtual MaybeError AddClamp(const op::Clamp* clamp);
         virtual MaybeError AddInstanceNorm(const op::InstanceNorm* instanceNorm);
+        virtual MaybeError AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear);
+        virtual MaybeError AddDequantizeLinear(const op::DequantizeLinear* dequantizeLinear);
         virtual MaybeError Finish();
         virtual MaybeError Compile();
 
+        // Add the operators sorted in topological order and the named outputs, and finish the
+        // graph.
+        MaybeError Build(const std::vector<Ref<OperatorBase>>& operators,
+                         const std::map<std::string, const OperandBase*>& outputs);
+        // Keep a copy of the operators to build the graph again when a compute sets the
+        // dimensions of the inputs with another batch size, i.e. the first dimension of the
+        // inputs sharing it with the first input. A graph is built and compiled for each batch
+        // size and cached. The copied constants own their data, so the buffers of the user can
+        // be released after the build.
+        MaybeError EnableDynamicBatch(GraphBuilderBase* builder,
+                                      const std::vector<Ref<OperatorBase>>& operators,
+                                      const std::map<std::string, const OperandBase*>& outputs);
+        bool HasDynamicBatch() const;
+
+        // Record the named inputs and outputs, they are indexed in the recorded order for the
+        // bindings. The byte length of the output inferred at build time is used to validate the
+        // output buffers before computing.
+        void RecordInput(const std::string& name);
+        void RecordOutput(const std::string& name, const OperandBase* output);
+        const std::vector<std::string>& GetInputNames() const;
+        const std::vector<std::string>& GetOutputNames() const;
+        ResultOrError<uint32_t> GetInputIndex(const std::string& name) const;
+        ResultOrError<uint32_t> GetOutputIndex(const std::string& name) const;
+        // Return 0 if the output size is unknown until compute.
+        size_t GetOutputByteLength(uint32_t index) const;
+
+        // The placement of the intermediate operands, it's set before the operators are added so
+        // that the backend can allocate one arena and bind the intermediate operands into it.
+        // The plan is only computed for the backends that use it, see UsesMemoryPlan.
+        void SetMemoryPlan(MemoryPlan memoryPlan);
+        const MemoryPlan& GetMemoryPlan() const;
+
         // Webnn API
         MLComputeGraphStatus Compute(NamedInputsBase* inputs, NamedOutputsBase* outputs);
+        // The buffers of the inputs and the outputs must be kept alive until the callback is
+        // called, the graph and the named inputs and outputs are referenced by the compute. The
+        // callback is called on a thread of the graph or of the backend.
+        void ComputeAsync(NamedInputsBase* inputs,
+                          NamedOutputsBase* outputs,
+                          ml::ComputeAsyncCallback callback,
+                          void* userdata);
+        BindingsBase* CreateBindings();
+        MLComputeGraphStatus ComputeBindings(BindingsBase* bindings);
+
+      protected:
+        // Drop the reference on the worker thread of the graph, for the backends whose threads
+        // must not destroy the graph.
+        void ReleaseOnWorkerThread(Ref<GraphBase> graph);
 
       private:
+        MaybeError ValidateOutputs(NamedOutputsBase* outputs) const;
+        // Return the graph that computes the batch size of the inputs, which is this graph if
+        // the dynamic batch isn't enabled or the batch size is the built one.
+        ResultOrError<GraphBase*> GetBatchGraph(NamedInputsBase* inputs);
+        // Build the graph from another copy of the batch operators, the stored ones keep the
+        // built batch size.
+        ResultOrError<GraphBase*> BuildBatchGraph(int32_t batchSize);
+        // Set the batch size of the inputs of |operators| and calculate the shapes of the
+        // operands again.
+        MaybeError SetBatchSize(const std::vector<Ref<OperatorBase>>& operators,
+                                int32_t batchSize);
+
         virtual MaybeError CompileImpl() = 0;
         virtual MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
                                                  NamedOutputsBase* outputs) = 0;
+        // The backends that can run the computes of a graph concurrently, e.g. on a pool of
+        // infer requests, override it to return true.
+        virtual bool SupportsConcurrentCompute() const;
+        // The backends that bind the intermediate operands into an arena override it to return
+        // true, the others leave the memory plan empty.
+        virtual bool UsesMemoryPlan() const;
+        // The default implementation runs ComputeImpl on the worker thread of the graph, the
+        // backends with native asynchronous execution override it.
+        virtual void ComputeAsyncImpl(NamedInputsBase* inputs,
+                                      NamedOutputsBase* outputs,
+                                      ml::ComputeAsyncCallback callback,
+                                      void* userdata);
+        // The default implementation computes with the named records of the bindings, the
+        // backends override it to read the buffers by the indices resolved at build time.
+        virtual MLComputeGraphStatus ComputeBindingsImpl(BindingsBase* bindings);
+
+        std::vector<std::string> mInputNames;
+        std::vector<std::string> mOutputNames;
+        std::map<std::string, uint32_t> mInputIndices;
+        std::map<std::string, uint32_t> mOutputIndices;
+        std::vector<size_t> mOutputByteLengths;
+        MemoryPlan mMemoryPlan;
+        // The operators of the build, the backends may reference them until the graph is
+        // released.
+        std::vector<Ref<OperatorBase>> mOperators;
+        // The operators and the built dimensions of the batched inputs for the dynamic batch.
+        Ref<GraphBuilderBase> mBatchBuilder;
+        std::vector<Ref<OperatorBase>> mBatchOperators;
+        std::map<std::string, const OperandBase*> mBatchOutputs;
+        std::map<std::string, std::vector<int32_t>> mBatchInputs;
+        int32_t mBatchSize = 0;
+        std::map<int32_t, Ref<GraphBase>> mBatchGraphs;
+        std::mutex mBatchMutex;
+        // Most backends bind the buffers into the compiled graph, so the computes of a graph are
+        // run one by one unless the backend supports concurrent computes.
+        std::mutex mComputeMutex;
+        TaskQueue mTaskQueue;
     };
 }  // namespace webnn_native
 
@@ -14,8 +14,10 @@
 
 #include "webnn_native/GraphBuilder.h"
 
+#include <map>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -27,6 +29,8 @@
 #include "webnn_native/Operand.h"
 #include "webnn_native/OperandArray.h"
 #include "webnn_native/Operator.h"
+#include "webnn_native/PartitionedGraph.h"
+#include "webnn_native/PassManager.h"
 #include "webnn_native/ops/BatchNorm.h"
 #include "webnn_native/ops/Binary.h"
 #include "webnn_native/ops/Clamp.h"
@@ -39,6 +43,7 @@
 #include "webnn_native/ops/LeakyRelu.h"
 #include "webnn_native/ops/Pad.h"
 #include "webnn_native/ops/Pool2d.h"
+#include "webnn_native/ops/Quantize.h"
 #include "webnn_native/ops/ReduceMean.h"
 #include "webnn_native/ops/Resample.h"
 #include "webnn_native/ops/Reshape.h"
@@ -114,22 +119,20 @@ namespace webnn_native {
     OperandBase* GraphBuilderBase::Conv2d(OperandBase* input,
                                           OperandBase* filter,
                                           Conv2dOptions const* options) {
-        // Workaround(mingming): Currently we implement Relu6 operator by clamp. For
-        // case OperatorType::Clamp, OpenVINO can fuse clamp by its graph compiler and DML doesn't
-        // support fuse clamp today. So We added a clamp node in GraphBuilder directly to ensure
-        // that we can find the min and max operands from the graph. We need to refactor codes once
-        // a backend requires fusing clamp.
+        // The activation is added as a standalone operator, the OperatorFusion pass fuses it into
+        // the convolution if the backend supports the pattern.
         if (options != nullptr && options->activation != nullptr) {
-            auto operatorType = options->activation->GetFusedOperator();
-            if (operatorType == FusedOperator::Clamp) {
-                Ref<OperatorBase> conv2d = AcquireRef(new op::Conv2d(this, input, filter, options));
-                if (GetContext()->ConsumedError(conv2d->Validate())) {
-                    return OperandBase::MakeError(this);
-                }
-                auto clamp = reinterpret_cast<op::Clamp*>(options->activation);
-                VALIDATE_FOR_OPERAND(
-                    new op::Clamp(this, conv2d->PrimaryOutput(), clamp->GetOptions()));
+            if (options->activation->IsError()) {
+                return OperandBase::MakeError(this);
+            }
+            Conv2dOptions conv2dOptions = *options;
+            conv2dOptions.activation = nullptr;
+            Ref<OperatorBase> conv2d =
+                AcquireRef(new op::Conv2d(this, input, filter, &conv2dOptions));
+            if (GetContext()->ConsumedError(conv2d->Validate())) {
+                return OperandBase::MakeError(this);
             }
+            VALIDATE_FOR_OPERAND(CreateActivation(options->activation, conv2d->PrimaryOutput()));
         }
         VALIDATE_FOR_OPERAND(new op::Conv2d(this, input, filter, options));
     }
@@ -243,25 +246,21 @@ namespace webnn_native {
                                              OperandBase* mean,
                                              OperandBase* variance,
                                              BatchNormOptions const* options) {
-        // Workaround(mingming): Currently we implement Relu6 operator by clamp. For
-        // case OperatorType::Clamp, OpenVINO can fuse clamp by its graph compiler and DML doesn't
-        // support fuse clamp today. So We added a clamp node in GraphBuilder directly to ensure
-        // that we can find the min and max operands from the graph. We need to refactor codes once
-        // a backend requires fusing clamp.
+        // The activation is added as a standalone operator as Conv2d does.
         if (options != nullptr && options->activation != nullptr) {
-            auto operatorType = options->activation->GetFusedOperator();
-            if (operatorType == FusedOperator::Clamp) {
-                Ref<OperatorBase> batchNorm =
-                    AcquireRef(new op::BatchNorm(this, input, mean, variance, options));
-                if (GetContext()->ConsumedError(batchNorm->Validate())) {
-                    return OperandBase::MakeError(this);
-                }
-                auto clamp = reinterpret_cast<op::Clamp*>(options->activation);
-                auto clampOptions = clamp->GetOptions();
-                VALIDATE_FOR_OPERAND(new op::Clamp(this, batchNorm->PrimaryOutput(), clampOptions));
+            if (options->activation->IsError()) {
+                return OperandBase::MakeError(this);
+            }
+            BatchNormOptions batchNormOptions = *options;
+            batchNormOptions.activation = nullptr;
+            Ref<OperatorBase> batchNorm =
+                AcquireRef(new op::BatchNorm(this, input, mean, variance, &batchNormOptions));
+            if (GetContext()->ConsumedError(batchNorm->Validate())) {
+                return OperandBase::MakeError(this);
             }
+            VALIDATE_FOR_OPERAND(
+                CreateActivation(options->activation, batchNorm->PrimaryOutput()));
         }
-
         VALIDATE_FOR_OPERAND(new op::BatchNorm(this, input, mean, variance, options));
     }
 
@@ -276,6 +275,15 @@ namespace webnn_native {
         VALIDATE_FOR_OPERAND(new op::InstanceNorm(this, input, options));
     }
 
+    OperandBase* GraphBuilderBase::QuantizeLinear(OperandBase* input,
+                                                  OperandDescriptor const* desc) {
+        VALIDATE_FOR_OPERAND(new op::QuantizeLinear(this, input, desc));
+    }
+
+    OperandBase* GraphBuilderBase::DequantizeLinear(OperandBase* input) {
+        VALIDATE_FOR_OPERAND(new op::DequantizeLinear(this, input));
+    }
+
     GraphBase* GraphBuilderBase::Build(NamedOperandsBase const* namedOperands) {
         if (DAWN_UNLIKELY(this->IsError())) {
             dawn::ErrorLog() << "This Graph object is an error";
@@ -290,23 +298,75 @@ namespace webnn_native {
         for (auto& namedOutput : namedOperands->GetRecords()) {
             outputs.push_back(namedOutput.second);
         }
-        std::vector<const OperatorBase*> sorted_operands = TopologicalSort(outputs);
-        Ref<GraphBase> graph = AcquireRef(GetContext()->CreateGraph());
-        for (auto& op : sorted_operands) {
-            if (op->IsError() || GetContext()->ConsumedError(op->AddToGraph(graph.Get()))) {
+        std::vector<Ref<OperatorBase>> operators;
+        for (auto op : TopologicalSort(outputs)) {
+            if (op->IsError()) {
                 dawn::ErrorLog() << "Failed to add the operand when building graph.";
                 return nullptr;
             }
+            operators.push_back(const_cast<OperatorBase*>(op));
+        }
+        // The passes rewrite copies of the operators, the operators of the builder are kept as
+        // they were built for the other builds.
+        std::unordered_map<const OperandBase*, OperandBase*> operands;
+        PassContext passContext;
+        passContext.builder = this;
+        if (GetContext()->ConsumedError(CloneOperators(this, operators, &operands),
+                                        &passContext.operators)) {
+            dawn::ErrorLog() << "Failed to copy the operators of the graph.";
+            return nullptr;
+        }
+        for (auto output : outputs) {
+            passContext.outputs.insert(operands.at(output));
+        }
+        PassManager passManager;
+        passManager.AddDefaultPasses();
+        if (GetContext()->ConsumedError(passManager.Run(passContext))) {
+            dawn::ErrorLog() << "Failed to optimize the graph.";
+            return nullptr;
         }
+
+        // The named outputs after the optimizations.
+        std::map<std::string, const OperandBase*> graphOutputs;
         for (auto& namedOutput : namedOperands->GetRecords()) {
+            const OperandBase* output = operands.at(namedOutput.second);
+            auto replacedOutput = passContext.replacedOutputs.find(output);
+            if (replacedOutput != passContext.replacedOutputs.end()) {
+                output = replacedOutput->second;
+            }
+            graphOutputs[namedOutput.first] = output;
+        }
+
+        bool supported = true;
+        for (auto& op : passContext.operators) {
+            supported = supported && GetContext()->SupportsOperator(op.Get());
+        }
+        Ref<GraphBase> graph;
+        PartitionedGraph* partitionedGraph = nullptr;
+        if (!supported) {
+            // Fall back to the other backends for the operators that the backend doesn't support.
+            partitionedGraph = new PartitionedGraph(GetContext());
+            graph = AcquireRef(static_cast<GraphBase*>(partitionedGraph));
+        } else {
+            graph = AcquireRef(GetContext()->CreateGraph());
+        }
+        // The operators are copied for the dynamic batch before the partition replaces the
+        // operands across the subgraphs.
+        if (GetContext()->GetContextOptions().dynamicBatch &&
+            GetContext()->ConsumedError(
+                graph->EnableDynamicBatch(this, passContext.operators, graphOutputs))) {
+            dawn::ErrorLog() << "Failed to enable the dynamic batch.";
+            return nullptr;
+        }
+        if (partitionedGraph != nullptr) {
             if (GetContext()->ConsumedError(
-                    graph->AddOutput(namedOutput.first, namedOutput.second))) {
-                dawn::ErrorLog() << "Failed to add output when building graph.";
+                    partitionedGraph->Partition(this, passContext.operators, graphOutputs))) {
+                dawn::ErrorLog() << "Failed to partition the graph.";
                 return nullptr;
             }
-        }
-        if (GetContext()->ConsumedError(graph->Finish())) {
-            dawn::ErrorLog() << "Failed to finish building graph.";
+        } else if (GetContext()->ConsumedError(
+                       graph->Build(passContext.operators, graphOutputs))) {
+            dawn::ErrorLog() << "Failed to build graph.";
             return nullptr;
         }
 
@@ -318,6 +378,29 @@ namespace webnn_native {
         return graph.Detach();
     }
 
+    OperatorBase* GraphBuilderBase::CreateActivation(OperatorBase* activation,
+                                                      OperandBase* input) {
+        switch (activation->GetFusedOperator()) {
+            case FusedOperator::Clamp:
+                return new op::Clamp(this, input,
+                                     static_cast<op::Clamp*>(activation)->GetOptions());
+            case FusedOperator::Relu:
+                return new op::Unary(this, op::UnaryOpType::kRelu, input);
+            case FusedOperator::Sigmoid:
+                return new op::Unary(this, op::UnaryOpType::kSigmoid, input);
+            case FusedOperator::LeakyRelu: {
+                LeakyReluOptions options;
+                options.alpha = static_cast<op::LeakyRelu*>(activation)->GetAlpha();
+                return new op::LeakyRelu(this, input, &options);
+            }
+            case FusedOperator::HardSwish:
+                return new op::Unary(this, op::UnaryOpType::kHardSwish, input);
+            default:
+                DAWN_UNREACHABLE();
+                return nullptr;
+        }
+    }
+
     // The implementation derives from nGraph topological_sort in
     // https://github.com/openvinotoolkit/openvino/blob/master/ngraph/core/include/ngraph/graph_util.hpp
     //
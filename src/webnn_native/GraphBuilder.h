@@ -74,9 +74,13 @@ namespace webnn_native {
                                OperandBase*,
                                BatchNormOptions const* options);
         OperandBase* InstanceNorm(OperandBase*, InstanceNormOptions const* options);
+        OperandBase* QuantizeLinear(OperandBase*, OperandDescriptor const* desc);
+        OperandBase* DequantizeLinear(OperandBase*);
         GraphBase* Build(NamedOperandsBase const* namedOperands);
 
       private:
+        // Create the standalone operator that applies the fused |activation| to |input|.
+        OperatorBase* CreateActivation(OperatorBase* activation, OperandBase* input);
         // Topological sort of nodes needed to compute rootNodes
         std::vector<const OperatorBase*> TopologicalSort(
             std::vector<const OperandBase*>& rootNodes);
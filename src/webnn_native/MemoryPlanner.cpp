@@ -0,0 +1,145 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/MemoryPlanner.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/Assert.h"
+#include "common/Log.h"
+#include "common/Math.h"
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ShapeUtils.h"
+
+namespace webnn_native {
+
+    namespace {
+        bool IsStaticShape(const OperandBase* operand) {
+            const std::vector<int32_t>& shape = operand->Shape();
+            if (shape.size() != operand->Rank()) {
+                return false;
+            }
+            for (auto dim : shape) {
+                if (dim < 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }  // namespace
+
+    size_t AssignOffsets(const std::vector<BufferLifetime>& buffers, std::vector<size_t>& offsets) {
+        std::vector<size_t> order(buffers.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buffers](size_t a, size_t b) {
+            return buffers[a].byteLength > buffers[b].byteLength;
+        });
+
+        offsets.assign(buffers.size(), 0);
+        // The placed buffers sorted by offset.
+        std::vector<size_t> placed;
+        size_t arenaSize = 0;
+        for (auto index : order) {
+            const BufferLifetime& buffer = buffers[index];
+            size_t byteLength = Align(buffer.byteLength, kArenaAlignment);
+            // Find the smallest gap between the placed buffers that are alive at the same time.
+            size_t bestOffset = 0;
+            size_t bestGap = std::numeric_limits<size_t>::max();
+            size_t gapBegin = 0;
+            for (auto other : placed) {
+                const BufferLifetime& placedBuffer = buffers[other];
+                if (placedBuffer.lastUse < buffer.firstUse ||
+                    placedBuffer.firstUse > buffer.lastUse) {
+                    continue;
+                }
+                size_t offset = offsets[other];
+                if (offset >= gapBegin + byteLength && offset - gapBegin < bestGap) {
+                    bestOffset = gapBegin;
+                    bestGap = offset - gapBegin;
+                }
+                gapBegin = std::max(gapBegin, offset + Align(placedBuffer.byteLength,
+                                                             kArenaAlignment));
+            }
+            if (bestGap == std::numeric_limits<size_t>::max()) {
+                bestOffset = gapBegin;
+            }
+            offsets[index] = bestOffset;
+            arenaSize = std::max(arenaSize, bestOffset + byteLength);
+            auto position =
+                std::upper_bound(placed.begin(), placed.end(), bestOffset,
+                                 [&offsets](size_t offset, size_t other) {
+                                     return offset < offsets[other];
+                                 });
+            placed.insert(position, index);
+        }
+        return arenaSize;
+    }
+
+    // static
+    MemoryPlan MemoryPlan::Create(const std::vector<Ref<OperatorBase>>& operators,
+                                  const std::unordered_set<const OperandBase*>& outputs) {
+        std::vector<const OperandBase*> operands;
+        std::vector<BufferLifetime> buffers;
+        std::unordered_map<const OperandBase*, size_t> bufferIndices;
+        for (size_t i = 0; i < operators.size(); ++i) {
+            const OperatorBase* op = operators[i].Get();
+            for (auto& input : op->Inputs()) {
+                auto iter = bufferIndices.find(input.Get());
+                if (iter != bufferIndices.end()) {
+                    buffers[iter->second].lastUse = i;
+                }
+            }
+            OperatorType type = op->GetOperatorType();
+            if (type == OperatorType::Input || type == OperatorType::Constant) {
+                continue;
+            }
+            for (auto& output : op->Outputs()) {
+                if (outputs.find(output.Get()) != outputs.end() || !IsStaticShape(output.Get())) {
+                    continue;
+                }
+                size_t byteLength =
+                    SizeOfShape(output->Shape()) * SizeOfOperandType(output->Type());
+                bufferIndices[output.Get()] = buffers.size();
+                operands.push_back(output.Get());
+                buffers.push_back({byteLength, i, i});
+            }
+        }
+
+        MemoryPlan plan;
+        std::vector<size_t> offsets;
+        plan.mArenaSize = AssignOffsets(buffers, offsets);
+        size_t totalSize = 0;
+        for (size_t i = 0; i < operands.size(); ++i) {
+            plan.mOffsets[operands[i]] = offsets[i];
+            totalSize += buffers[i].byteLength;
+        }
+        dawn::DebugLog() << "The arena of " << operands.size() << " intermediate operands is "
+                         << plan.mArenaSize << " bytes, " << totalSize << " bytes without reuse.";
+        return plan;
+    }
+
+    bool MemoryPlan::HasOffset(const OperandBase* operand) const {
+        return mOffsets.find(operand) != mOffsets.end();
+    }
+
+    size_t MemoryPlan::GetOffset(const OperandBase* operand) const {
+        DAWN_ASSERT(HasOffset(operand));
+        return mOffsets.at(operand);
+    }
+
+}  // namespace webnn_native
@@ -0,0 +1,68 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_MEMORY_PLANNER_H_
+#define WEBNN_NATIVE_MEMORY_PLANNER_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/RefCounted.h"
+#include "webnn_native/Forward.h"
+
+namespace webnn_native {
+
+    // The offsets of the intermediate buffers are aligned for the vectorized kernels.
+    static constexpr size_t kArenaAlignment = 64;
+
+    // An intermediate buffer and the range of the operators that use it, the operators are
+    // indexed in topological order.
+    struct BufferLifetime {
+        size_t byteLength;
+        size_t firstUse;
+        size_t lastUse;
+    };
+
+    // Assign the offsets of |buffers| in a single arena so that the buffers that are alive at the
+    // same time don't overlap, and return the size of the arena. The buffers are placed from the
+    // largest to the smallest in the best fitting gap (greedy by size).
+    size_t AssignOffsets(const std::vector<BufferLifetime>& buffers, std::vector<size_t>& offsets);
+
+    // The placement of the intermediate operands of a graph in one arena. The operands bound to
+    // the named outputs, the inputs, the constants and the operands whose shape is unknown at
+    // build time are not planned, the backend allocates them separately.
+    class MemoryPlan {
+      public:
+        MemoryPlan() = default;
+        ~MemoryPlan() = default;
+
+        // Plan the operands computed by |operators|, which are sorted in topological order.
+        static MemoryPlan Create(const std::vector<Ref<OperatorBase>>& operators,
+                                 const std::unordered_set<const OperandBase*>& outputs);
+
+        bool HasOffset(const OperandBase* operand) const;
+        size_t GetOffset(const OperandBase* operand) const;
+        size_t GetArenaSize() const {
+            return mArenaSize;
+        }
+
+      private:
+        std::unordered_map<const OperandBase*, size_t> mOffsets;
+        size_t mArenaSize = 0;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_MEMORY_PLANNER_H_
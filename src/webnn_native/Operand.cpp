@@ -15,6 +15,8 @@
 
 #include "webnn_native/Operand.h"
 
+#include <cmath>
+
 #include "common/Assert.h"
 #include "common/Log.h"
 #include "webnn_native/GraphBuilder.h"
@@ -28,9 +30,15 @@ namespace webnn_native {
           mRank(0) {
         if (mOperator->Inputs().size() >= 1) {
             auto primaryInput = mOperator->Inputs()[0];
-            // The type and rank is the same as input[0] by default.
+            // The type, rank and shape are the same as input[0] by default.
             mType = primaryInput->Type();
             mRank = primaryInput->Rank();
+            mShape = primaryInput->Shape();
+            // The data movement operators keep the values quantized by the tensor, the channel
+            // axis of the per-channel quantization isn't tracked through them.
+            if (!primaryInput->GetQuantization().IsPerChannel()) {
+                mQuantization = primaryInput->GetQuantization();
+            }
         }
     }
 
@@ -38,6 +46,70 @@ namespace webnn_native {
         : ObjectBase(graphBuilder->GetContext(), tag) {
     }
 
+    Quantization MakeQuantization(const OperandDescriptor* desc) {
+        Quantization quantization;
+        if (desc->scales != nullptr) {
+            quantization.scales.assign(desc->scales, desc->scales + desc->scalesCount);
+        }
+        if (desc->zeroPoints != nullptr) {
+            quantization.zeroPoints.assign(desc->zeroPoints,
+                                           desc->zeroPoints + desc->zeroPointsCount);
+        }
+        quantization.axis = desc->axis;
+        return quantization;
+    }
+
+    MaybeError ValidateQuantization(const OperandBase* operand) {
+        const Quantization& quantization = operand->GetQuantization();
+        if (quantization.scales.empty()) {
+            if (!quantization.zeroPoints.empty()) {
+                return DAWN_VALIDATION_ERROR("The zero points are set without the scales.");
+            }
+            return {};
+        }
+        int32_t minValue, maxValue;
+        switch (operand->Type()) {
+            case ml::OperandType::Int8:
+                minValue = -128;
+                maxValue = 127;
+                break;
+            case ml::OperandType::Uint8:
+                minValue = 0;
+                maxValue = 255;
+                break;
+            default:
+                return DAWN_VALIDATION_ERROR("Only the int8 and uint8 operands are quantized.");
+        }
+        if (quantization.IsPerChannel()) {
+            const std::vector<int32_t>& shape = operand->Shape();
+            int32_t axis = quantization.axis;
+            if (axis < 0 || axis >= static_cast<int32_t>(shape.size())) {
+                return DAWN_VALIDATION_ERROR("The quantization axis is out of the rank.");
+            }
+            if (shape[axis] != static_cast<int32_t>(quantization.scales.size())) {
+                return DAWN_VALIDATION_ERROR(
+                    "The count of the scales doesn't match the channels of the axis.");
+            }
+        }
+        for (float scale : quantization.scales) {
+            if (!(scale > 0) || std::isinf(scale)) {
+                return DAWN_VALIDATION_ERROR("The scales must be positive and finite.");
+            }
+        }
+        if (!quantization.zeroPoints.empty()) {
+            if (quantization.zeroPoints.size() != quantization.scales.size()) {
+                return DAWN_VALIDATION_ERROR(
+                    "The count of the zero points doesn't match the scales.");
+            }
+            for (int32_t zeroPoint : quantization.zeroPoints) {
+                if (zeroPoint < minValue || zeroPoint > maxValue) {
+                    return DAWN_VALIDATION_ERROR("The zero point is out of the operand type.");
+                }
+            }
+        }
+        return {};
+    }
+
     // static
     OperandBase* OperandBase::MakeError(GraphBuilderBase* GraphBuilder) {
         return new OperandBase(GraphBuilder, ObjectBase::kError);
@@ -16,8 +16,10 @@
 #define WEBNN_NATIVE_OPERAND_H_
 
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "webnn_native/Error.h"
 #include "webnn_native/Forward.h"
 #include "webnn_native/Graph.h"
 #include "webnn_native/ObjectBase.h"
@@ -26,12 +28,36 @@
 
 namespace webnn_native {
 
+    // The quantization of an int8 or uint8 operand, the quantized value q represents the real
+    // value (q - zeroPoint) * scale. There is one scale for the whole tensor or one scale for
+    // each channel along the axis, the zero points are 0 if they are empty.
+    struct Quantization {
+        std::vector<float> scales;
+        std::vector<int32_t> zeroPoints;
+        int32_t axis = 0;
+
+        bool IsPerChannel() const {
+            return scales.size() > 1;
+        }
+        float Scale(size_t channel) const {
+            return scales[IsPerChannel() ? channel : 0];
+        }
+        int32_t ZeroPoint(size_t channel) const {
+            return zeroPoints.empty() ? 0 : zeroPoints[IsPerChannel() ? channel : 0];
+        }
+    };
+
+    // Copy the quantization out of the descriptor that may not outlive the call.
+    Quantization MakeQuantization(const OperandDescriptor* desc);
+    // Validate the quantization against the type and the shape of the operand.
+    MaybeError ValidateQuantization(const OperandBase* operand);
+
     class OperandBase : public ObjectBase {
       public:
         OperandBase(GraphBuilderBase*, OperatorBase*);
         virtual ~OperandBase() = default;
 
-        const OperatorBase* Operator() {
+        const OperatorBase* Operator() const {
             return mOperator.Get();
         }
 
@@ -47,6 +73,22 @@ namespace webnn_native {
         void SetRank(uint32_t rank) {
             mRank = rank;
         }
+        const std::vector<int32_t>& Shape() const {
+            return mShape;
+        }
+        void SetShape(std::vector<int32_t> shape) {
+            mShape = std::move(shape);
+            mRank = mShape.size();
+        }
+        bool IsQuantized() const {
+            return !mQuantization.scales.empty();
+        }
+        const Quantization& GetQuantization() const {
+            return mQuantization;
+        }
+        void SetQuantization(Quantization quantization) {
+            mQuantization = std::move(quantization);
+        }
 
         static OperandBase* MakeError(GraphBuilderBase* modelBuilder);
 
@@ -60,6 +102,9 @@ namespace webnn_native {
         ml::OperandType mType;
         // only set rank for dimensions
         uint32_t mRank;
+        // The static dimensions that are inferred when the operator is validated.
+        std::vector<int32_t> mShape;
+        Quantization mQuantization;
     };
 }  // namespace webnn_native
 
@@ -18,6 +18,7 @@
 #include "common/Assert.h"
 #include "common/Log.h"
 #include "webnn_native/GraphBuilder.h"
+#include "webnn_native/ops/Constant.h"
 
 namespace webnn_native {
     OperatorBase::OperatorBase(GraphBuilderBase* graphBuilder,
@@ -63,12 +64,85 @@ namespace webnn_native {
         return {};
     }
 
+    OperatorType OperatorBase::GetOperatorType() const {
+        DAWN_UNREACHABLE();
+    }
+
+    bool OperatorBase::IsSameOperation(const OperatorBase* other) const {
+        return false;
+    }
+
+    void OperatorBase::ReplaceInput(const OperandBase* input, OperandBase* replacement) {
+        for (auto& operand : mInputs) {
+            if (operand.Get() == input) {
+                operand = replacement;
+            }
+        }
+    }
+
     FusedOperator OperatorBase::GetFusedOperator() const {
         return mFusedOperator;
     }
 
+    ResultOrError<Ref<OperatorBase>> OperatorBase::Clone(
+        GraphBuilderBase* graphBuilder,
+        const std::vector<Ref<OperandBase>>& inputs) const {
+        DAWN_ASSERT(inputs.size() == mInputs.size());
+        Ref<OperatorBase> clone = AcquireRef(CloneImpl(graphBuilder));
+        for (size_t i = 0; i < mInputs.size(); ++i) {
+            clone->ReplaceInput(mInputs[i].Get(), inputs[i].Get());
+        }
+        CopyOutputsTo(clone.Get());
+        DAWN_TRY(clone->Validate());
+        return clone;
+    }
+
+    OperatorBase* OperatorBase::CloneImpl(GraphBuilderBase* graphBuilder) const {
+        DAWN_UNREACHABLE();
+    }
+
+    void OperatorBase::CopyOutputsTo(OperatorBase* clone) const {
+        DAWN_ASSERT(clone->mOutputs.size() == mOutputs.size());
+        for (size_t i = 0; i < mOutputs.size(); ++i) {
+            OperandBase* output = clone->mOutputs[i].Get();
+            output->SetType(mOutputs[i]->Type());
+            output->SetShape(mOutputs[i]->Shape());
+            output->SetQuantization(mOutputs[i]->GetQuantization());
+        }
+    }
+
     // static
     OperatorBase* OperatorBase::MakeError(GraphBuilderBase* graphBuilder) {
         return new OperatorBase(graphBuilder, ObjectBase::kError);
     }
+
+    ResultOrError<std::vector<Ref<OperatorBase>>> CloneOperators(
+        GraphBuilderBase* graphBuilder,
+        const std::vector<Ref<OperatorBase>>& operators,
+        std::unordered_map<const OperandBase*, OperandBase*>* operands,
+        bool copyConstantData) {
+        std::vector<Ref<OperatorBase>> clones;
+        clones.reserve(operators.size());
+        for (auto& op : operators) {
+            std::vector<Ref<OperandBase>> inputs;
+            inputs.reserve(op->Inputs().size());
+            for (auto& input : op->Inputs()) {
+                auto operand = operands->find(input.Get());
+                DAWN_ASSERT(operand != operands->end());
+                inputs.push_back(operand->second);
+            }
+            Ref<OperatorBase> clone;
+            if (copyConstantData && op->GetOperatorType() == OperatorType::Constant) {
+                DAWN_TRY_ASSIGN(clone, static_cast<const op::Constant*>(op.Get())
+                                           ->CloneWithData(graphBuilder));
+            } else {
+                DAWN_TRY_ASSIGN(clone, op->Clone(graphBuilder, inputs));
+            }
+            for (size_t i = 0; i < op->Outputs().size(); ++i) {
+                (*operands)[op->Outputs()[i].Get()] = clone->Outputs()[i].Get();
+            }
+            clones.push_back(std::move(clone));
+        }
+        return std::move(clones);
+    }
 }  // namespace webnn_native
@@ -15,6 +15,9 @@
 #ifndef WEBNN_NATIVE_OPERATOR_H_
 #define WEBNN_NATIVE_OPERATOR_H_
 
+#include <unordered_map>
+#include <vector>
+
 #include "webnn_native/Forward.h"
 #include "webnn_native/ObjectBase.h"
 #include "webnn_native/Operand.h"
@@ -29,6 +32,29 @@ namespace webnn_native {
         HardSwish = 0x00000004,
     };
 
+    enum class OperatorType : uint32_t {
+        BatchNorm,
+        Binary,
+        Clamp,
+        Concat,
+        Constant,
+        Conv2d,
+        DequantizeLinear,
+        Gemm,
+        Input,
+        InstanceNorm,
+        Pad,
+        Pool2d,
+        QuantizeLinear,
+        ReduceMean,
+        Resample,
+        Reshape,
+        Split,
+        Squeeze,
+        Transpose,
+        Unary,
+    };
+
     class OperatorBase : public ObjectBase {
       public:
         explicit OperatorBase(GraphBuilderBase* GraphBuilder,
@@ -44,7 +70,18 @@ namespace webnn_native {
         // Add the operand to model for specific backend.
         virtual MaybeError AddToGraph(GraphBase* graph) const;
         virtual MaybeError Validate();
+        virtual OperatorType GetOperatorType() const;
+        // Whether the operator computes the same result as |other| given the same inputs, it's
+        // used to eliminate the common subexpressions. The type and inputs are compared by the
+        // caller.
+        virtual bool IsSameOperation(const OperatorBase* other) const;
+        // Replace the input operand, the options referencing the operand are updated as well.
+        virtual void ReplaceInput(const OperandBase* input, OperandBase* replacement);
         FusedOperator GetFusedOperator() const;
+        // Copy the operator that reads |inputs| instead of its inputs, the outputs of the copy
+        // are validated again.
+        ResultOrError<Ref<OperatorBase>> Clone(GraphBuilderBase* graphBuilder,
+                                               const std::vector<Ref<OperandBase>>& inputs) const;
 
         static OperatorBase* MakeError(GraphBuilderBase* graphBuilder);
 
@@ -53,12 +90,27 @@ namespace webnn_native {
         FusedOperator mFusedOperator;
 
       protected:
+        // Create the operator of the same type and options that reads the same inputs.
+        virtual OperatorBase* CloneImpl(GraphBuilderBase* graphBuilder) const;
+        // Copy the types, the shapes and the quantizations of the outputs to |clone|.
+        void CopyOutputsTo(OperatorBase* clone) const;
+
         // The input operands of operator.
         std::vector<Ref<OperandBase>> mInputs;
         // The output operands of operator.
         std::vector<Ref<OperandBase>> mOutputs;
     };
 
+    // Copy the operators sorted in topological order, so that a build rewrites the copies and
+    // the operators of the builder stay as they were built. The operands of |operators| are
+    // mapped to the operands of the copies in |operands|. The copies of the constants reference
+    // the same data unless |copyConstantData| is true.
+    ResultOrError<std::vector<Ref<OperatorBase>>> CloneOperators(
+        GraphBuilderBase* graphBuilder,
+        const std::vector<Ref<OperatorBase>>& operators,
+        std::unordered_map<const OperandBase*, OperandBase*>* operands,
+        bool copyConstantData = false);
+
 }  // namespace webnn_native
 
 #endif  // WEBNN_NATIVE_OPERATOR_H_
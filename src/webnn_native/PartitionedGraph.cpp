@@ -0,0 +1,292 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/PartitionedGraph.h"
+
+#include <unordered_set>
+
+#include "common/Log.h"
+#include "webnn_native/BackendRegistry.h"
+#include "webnn_native/Context.h"
+#include "webnn_native/NamedInputs.h"
+#include "webnn_native/NamedOutputs.h"
+#include "webnn_native/ShapeUtils.h"
+#include "webnn_native/ops/Input.h"
+
+namespace webnn_native {
+
+    namespace {
+
+        bool IsLeaf(const OperatorBase* op) {
+            OperatorType type = op->GetOperatorType();
+            return type == OperatorType::Input || type == OperatorType::Constant;
+        }
+
+        // Returns 0 if the shape is unknown at build time.
+        size_t ByteLengthOf(const OperandBase* operand) {
+            for (auto dim : operand->Shape()) {
+                if (dim < 0) {
+                    return 0;
+                }
+            }
+            return SizeOfShape(operand->Shape()) * SizeOfOperandType(operand->Type());
+        }
+
+    }  // namespace
+
+    PartitionedGraph::PartitionedGraph(ContextBase* context) : GraphBase(context) {
+    }
+
+    ResultOrError<ContextBase*> PartitionedGraph::SelectContext(const OperatorBase* op) {
+        if (GetContext()->SupportsOperator(op)) {
+            return GetContext();
+        }
+        for (auto& context : mFallbackContexts) {
+            if (context->SupportsOperator(op)) {
+                return context.Get();
+            }
+        }
+        // Create the contexts of the other backends in the order of the registry until one of
+        // them supports the operator.
+        const std::vector<BackendInfo>& backends = BackendRegistry::Get().GetBackends();
+        ContextOptions options = GetContext()->GetContextOptions();
+        for (; mRegistryPosition < backends.size(); ++mRegistryPosition) {
+            const BackendInfo& backend = backends[mRegistryPosition];
+            // The null backend doesn't compute.
+            if (backend.type == ml::BackendType::Null) {
+                continue;
+            }
+            options.backendType = backend.type;
+            Ref<ContextBase> context =
+                AcquireRef(backend.create(reinterpret_cast<MLContextOptions const*>(&options)));
+            if (context.Get() == nullptr) {
+                continue;
+            }
+            mFallbackContexts.push_back(context);
+            if (context->SupportsOperator(op)) {
+                ++mRegistryPosition;
+                return context.Get();
+            }
+        }
+        return DAWN_UNIMPLEMENTED_ERROR("The operator isn't supported by any backend.");
+    }
+
+    MaybeError PartitionedGraph::Partition(
+        GraphBuilderBase* builder,
+        const std::vector<Ref<OperatorBase>>& operators,
+        const std::map<std::string, const OperandBase*>& outputs) {
+        // Split the operators into the runs of the same backend. The inputs and the constants
+        // are added to each subgraph that uses them.
+        std::unordered_map<const OperandBase*, size_t> producers;
+        for (auto& op : operators) {
+            if (IsLeaf(op.Get())) {
+                continue;
+            }
+            ContextBase* context;
+            DAWN_TRY_ASSIGN(context, SelectContext(op.Get()));
+            if (mSubgraphs.empty() || mSubgraphs.back().context != context) {
+                mSubgraphs.push_back({});
+                mSubgraphs.back().context = context;
+            }
+            mSubgraphs.back().operators.push_back(op);
+            for (auto& output : op->Outputs()) {
+                producers[output.Get()] = mSubgraphs.size() - 1;
+            }
+        }
+
+        std::unordered_map<const OperandBase*, std::string> outputNames;
+        for (auto& output : outputs) {
+            auto producer = producers.find(output.second);
+            if (producer == producers.end()) {
+                return DAWN_UNIMPLEMENTED_ERROR(
+                    "An input or a constant as output isn't supported by the partitioned graph.");
+            }
+            Subgraph& subgraph = mSubgraphs[producer->second];
+            subgraph.outputs[output.first] = output.second;
+            subgraph.namedOutputs.insert(output.first);
+            outputNames[output.second] = output.first;
+            RecordOutput(output.first, output.second);
+            size_t byteLength = ByteLengthOf(output.second);
+            if (byteLength != 0) {
+                Buffer& buffer = mOutputBuffers[output.first];
+                buffer.data.resize(byteLength);
+                buffer.view = {buffer.data.data(), byteLength, 0};
+            }
+        }
+
+        // The names of the inputs and the outputs of the graph, the names of the boundary
+        // buffers mustn't collide with them.
+        std::unordered_set<std::string> usedNames;
+        for (auto& op : operators) {
+            if (op->GetOperatorType() == OperatorType::Input) {
+                usedNames.insert(static_cast<const op::Input*>(op.Get())->GetName());
+            }
+        }
+        for (auto& output : outputs) {
+            usedNames.insert(output.first);
+        }
+
+        // The operand used by a later subgraph is read from the buffer that the producer writes,
+        // which is the buffer of the named output if it's one.
+        std::unordered_map<const OperandBase*, Ref<OperatorBase>> boundaryInputs;
+        size_t boundaryIndex = 0;
+        for (size_t i = 0; i < mSubgraphs.size(); ++i) {
+            Subgraph& subgraph = mSubgraphs[i];
+            std::unordered_set<const OperatorBase*> addedInputs;
+            for (auto& op : subgraph.operators) {
+                // Copy the inputs since they are replaced below.
+                std::vector<Ref<OperandBase>> operands = op->Inputs();
+                for (auto& operand : operands) {
+                    const OperatorBase* producer = operand->Operator();
+                    if (IsLeaf(producer)) {
+                        if (addedInputs.insert(producer).second) {
+                            subgraph.inputs.push_back(const_cast<OperatorBase*>(producer));
+                            if (producer->GetOperatorType() == OperatorType::Input) {
+                                subgraph.namedInputs.insert(
+                                    static_cast<const op::Input*>(producer)->GetName());
+                            }
+                        }
+                        continue;
+                    }
+                    size_t producerIndex = producers.at(operand.Get());
+                    if (producerIndex == i) {
+                        continue;
+                    }
+                    auto boundaryInput = boundaryInputs.find(operand.Get());
+                    if (boundaryInput == boundaryInputs.end()) {
+                        size_t byteLength = ByteLengthOf(operand.Get());
+                        if (byteLength == 0) {
+                            return DAWN_UNIMPLEMENTED_ERROR(
+                                "The operand across the backends must have a static shape.");
+                        }
+                        std::string name;
+                        auto outputName = outputNames.find(operand.Get());
+                        if (outputName != outputNames.end()) {
+                            name = outputName->second;
+                        } else {
+                            do {
+                                name = "webnn_partition_" + std::to_string(boundaryIndex++);
+                            } while (!usedNames.insert(name).second);
+                            Buffer& buffer = mBoundaryBuffers[name];
+                            buffer.data.resize(byteLength);
+                            buffer.view = {buffer.data.data(), byteLength, 0};
+                            buffer.input.resource = buffer.view;
+                            mSubgraphs[producerIndex].outputs[name] = operand.Get();
+                        }
+                        OperandDescriptor desc;
+                        desc.type = operand->Type();
+                        desc.dimensions = operand->Shape().data();
+                        desc.dimensionsCount = operand->Shape().size();
+                        OperatorBase* input = new op::Input(builder, name, &desc);
+                        input->PrimaryOutput()->SetQuantization(operand->GetQuantization());
+                        boundaryInput =
+                            boundaryInputs.insert({operand.Get(), AcquireRef(input)}).first;
+                    }
+                    OperatorBase* input = boundaryInput->second.Get();
+                    if (addedInputs.insert(input).second) {
+                        subgraph.inputs.push_back(input);
+                        subgraph.namedInputs.insert(static_cast<op::Input*>(input)->GetName());
+                    }
+                    op->ReplaceInput(operand.Get(), input->PrimaryOutput());
+                }
+            }
+        }
+
+        for (auto& subgraph : mSubgraphs) {
+            DAWN_TRY(BuildSubgraph(subgraph));
+        }
+        for (auto& op : operators) {
+            if (op->GetOperatorType() == OperatorType::Input) {
+                RecordInput(static_cast<const op::Input*>(op.Get())->GetName());
+            }
+        }
+        dawn::InfoLog() << "The graph is partitioned into " << mSubgraphs.size()
+                        << " subgraphs on " << mFallbackContexts.size() + 1 << " backends.";
+        return {};
+    }
+
+    MaybeError PartitionedGraph::BuildSubgraph(Subgraph& subgraph) {
+        subgraph.graph = AcquireRef(subgraph.context->CreateGraph());
+        std::vector<Ref<OperatorBase>> operators = subgraph.inputs;
+        operators.insert(operators.end(), subgraph.operators.begin(), subgraph.operators.end());
+        return subgraph.graph->Build(operators, subgraph.outputs);
+    }
+
+    MaybeError PartitionedGraph::Finish() {
+        // The subgraphs are finished when they are partitioned.
+        return {};
+    }
+
+    MaybeError PartitionedGraph::CompileImpl() {
+        for (auto& subgraph : mSubgraphs) {
+            DAWN_TRY(subgraph.graph->Compile());
+        }
+        return {};
+    }
+
+    const ArrayBufferView* PartitionedGraph::GetOutput(NamedOutputsBase* outputs,
+                                                       const std::string& name) const {
+        const ArrayBufferView* output = outputs->Get(name.c_str());
+        if (output != nullptr) {
+            return output;
+        }
+        auto buffer = mOutputBuffers.find(name);
+        return buffer != mOutputBuffers.end() ? &buffer->second.view : nullptr;
+    }
+
+    MLComputeGraphStatus PartitionedGraph::ComputeImpl(NamedInputsBase* inputs,
+                                                       NamedOutputsBase* outputs) {
+        // The named outputs that are read by the later subgraphs.
+        std::map<std::string, Input> outputInputs;
+        for (auto& subgraph : mSubgraphs) {
+            Ref<NamedInputsBase> subgraphInputs = AcquireRef(new NamedInputsBase());
+            for (auto& name : subgraph.namedInputs) {
+                auto boundaryBuffer = mBoundaryBuffers.find(name);
+                auto outputInput = outputInputs.find(name);
+                if (boundaryBuffer != mBoundaryBuffers.end()) {
+                    subgraphInputs->Set(name.c_str(), &boundaryBuffer->second.input);
+                } else if (outputInput != outputInputs.end()) {
+                    subgraphInputs->Set(name.c_str(), &outputInput->second);
+                } else if (inputs->Get(name.c_str()) != nullptr) {
+                    subgraphInputs->Set(name.c_str(), inputs->Get(name.c_str()));
+                } else {
+                    dawn::ErrorLog() << "The input " << name << " isn't set.";
+                    return MLComputeGraphStatus_Error;
+                }
+            }
+            Ref<NamedOutputsBase> subgraphOutputs = AcquireRef(new NamedOutputsBase());
+            for (auto& output : subgraph.outputs) {
+                const std::string& name = output.first;
+                auto boundaryBuffer = mBoundaryBuffers.find(name);
+                if (boundaryBuffer != mBoundaryBuffers.end()) {
+                    subgraphOutputs->Set(name.c_str(), &boundaryBuffer->second.view);
+                    continue;
+                }
+                const ArrayBufferView* resource = GetOutput(outputs, name);
+                if (resource == nullptr) {
+                    continue;
+                }
+                subgraphOutputs->Set(name.c_str(), resource);
+                outputInputs[name].resource = *resource;
+            }
+            MLComputeGraphStatus status =
+                subgraph.graph->Compute(subgraphInputs.Get(), subgraphOutputs.Get());
+            if (status != MLComputeGraphStatus_Success) {
+                return status;
+            }
+        }
+        return MLComputeGraphStatus_Success;
+    }
+
+}  // namespace webnn_native
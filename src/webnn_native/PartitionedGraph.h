@@ -0,0 +1,88 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_PARTITIONED_GRAPH_H_
+#define WEBNN_NATIVE_PARTITIONED_GRAPH_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/RefCounted.h"
+#include "webnn_native/Graph.h"
+
+namespace webnn_native {
+
+    // A graph whose operators are not all supported by the backend of the context. The sorted
+    // operators are split into the maximal runs of operators that are computed by the same
+    // backend, the context backend when it supports the operator and otherwise the first
+    // backend of the registry that does. Each run is built and compiled as a subgraph, and the
+    // subgraphs are computed in order. An operand computed by a subgraph and used by a later one
+    // is an output of the former and an input of the latter bound to the same buffer, so it's
+    // handed across without a copy.
+    class PartitionedGraph final : public GraphBase {
+      public:
+        explicit PartitionedGraph(ContextBase* context);
+        ~PartitionedGraph() override = default;
+
+        // Split |operators|, which are sorted in topological order, and build the subgraphs.
+        // |operators| are the copies of the build, the operands across the subgraphs are
+        // replaced with the inputs of the later subgraphs.
+        MaybeError Partition(GraphBuilderBase* builder,
+                             const std::vector<Ref<OperatorBase>>& operators,
+                             const std::map<std::string, const OperandBase*>& outputs);
+        MaybeError Finish() override;
+
+      private:
+        struct Subgraph {
+            ContextBase* context;
+            // The computed operators in topological order.
+            std::vector<Ref<OperatorBase>> operators;
+            // The inputs and constants, and the inputs of the operands computed by the previous
+            // subgraphs.
+            std::vector<Ref<OperatorBase>> inputs;
+            std::map<std::string, const OperandBase*> outputs;
+            std::set<std::string> namedInputs;
+            std::set<std::string> namedOutputs;
+            Ref<GraphBase> graph;
+        };
+        // The buffer of an operand handed across the subgraphs, or of a named output that isn't
+        // requested by a compute.
+        struct Buffer {
+            std::vector<int8_t> data;
+            Input input;
+            ArrayBufferView view;
+        };
+
+        MaybeError CompileImpl() override;
+        MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
+                                         NamedOutputsBase* outputs) override;
+
+        ResultOrError<ContextBase*> SelectContext(const OperatorBase* op);
+        MaybeError BuildSubgraph(Subgraph& subgraph);
+        // Returns nullptr if the named output isn't requested and its size is unknown.
+        const ArrayBufferView* GetOutput(NamedOutputsBase* outputs, const std::string& name) const;
+
+        std::vector<Ref<ContextBase>> mFallbackContexts;
+        size_t mRegistryPosition = 0;
+        std::vector<Subgraph> mSubgraphs;
+        std::map<std::string, Buffer> mBoundaryBuffers;
+        std::map<std::string, Buffer> mOutputBuffers;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_PARTITIONED_GRAPH_H_
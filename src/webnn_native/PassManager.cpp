@@ -0,0 +1,105 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/PassManager.h"
+
+#include "common/Log.h"
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/passes/BatchNormFolding.h"
+#include "webnn_native/passes/CommonSubexpressionElimination.h"
+#include "webnn_native/passes/ConstantFolding.h"
+#include "webnn_native/passes/DeadOperatorElimination.h"
+#include "webnn_native/passes/IdentityElimination.h"
+#include "webnn_native/passes/OperatorFusion.h"
+#include "webnn_native/passes/TransposeMerge.h"
+
+namespace webnn_native {
+
+    namespace {
+        // The passes converge in a few iterations for real models, the limit only guards
+        // against passes undoing each other.
+        constexpr size_t kMaxIterations = 8;
+    }  // namespace
+
+    void ReplaceAllUsesWith(PassContext& context,
+                            size_t position,
+                            const OperandBase* operand,
+                            OperandBase* replacement) {
+        for (size_t i = position + 1; i < context.operators.size(); ++i) {
+            context.operators[i]->ReplaceInput(operand, replacement);
+        }
+    }
+
+    bool HasSingleUse(const PassContext& context, const OperandBase* operand) {
+        if (context.outputs.find(operand) != context.outputs.end()) {
+            return false;
+        }
+        size_t uses = 0;
+        for (auto& op : context.operators) {
+            for (auto& input : op->Inputs()) {
+                if (input.Get() == operand) {
+                    ++uses;
+                }
+            }
+        }
+        return uses == 1;
+    }
+
+    void ReplaceOutput(PassContext& context,
+                       const OperandBase* output,
+                       const OperandBase* replacement) {
+        context.outputs.erase(output);
+        context.outputs.insert(replacement);
+        for (auto& replacedOutput : context.replacedOutputs) {
+            if (replacedOutput.second == output) {
+                replacedOutput.second = replacement;
+            }
+        }
+        context.replacedOutputs[output] = replacement;
+    }
+
+    void PassManager::AddPass(std::unique_ptr<GraphPass> pass) {
+        mPasses.push_back(std::move(pass));
+    }
+
+    void PassManager::AddDefaultPasses() {
+        AddPass(std::make_unique<pass::ConstantFolding>());
+        AddPass(std::make_unique<pass::BatchNormFolding>());
+        AddPass(std::make_unique<pass::TransposeMerge>());
+        AddPass(std::make_unique<pass::IdentityElimination>());
+        AddPass(std::make_unique<pass::CommonSubexpressionElimination>());
+        AddPass(std::make_unique<pass::OperatorFusion>());
+        AddPass(std::make_unique<pass::DeadOperatorElimination>());
+    }
+
+    MaybeError PassManager::Run(PassContext& context) {
+        for (size_t iteration = 0; iteration < kMaxIterations; ++iteration) {
+            bool changed = false;
+            for (auto& pass : mPasses) {
+                bool passChanged;
+                DAWN_TRY_ASSIGN(passChanged, pass->Run(context));
+                if (passChanged) {
+                    dawn::DebugLog() << pass->GetName() << " changed the graph.";
+                }
+                changed |= passChanged;
+            }
+            if (!changed) {
+                break;
+            }
+        }
+        return {};
+    }
+
+}  // namespace webnn_native
@@ -0,0 +1,84 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_PASS_MANAGER_H_
+#define WEBNN_NATIVE_PASS_MANAGER_H_
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/RefCounted.h"
+#include "webnn_native/Error.h"
+#include "webnn_native/Forward.h"
+
+namespace webnn_native {
+
+    // The graph being optimized. The operators are the copies of the build sorted in topological
+    // order, so the passes rewrite them in place without changing the operators of the builder.
+    // The outputs are the operands bound to the named outputs of the graph which must be
+    // preserved. The builder is used to create the new operators, e.g. the folded constants. The
+    // operators are referenced so that the ones removed by a pass stay alive until the passes
+    // finish. A named output that is computed by another operand after the rewrite, e.g. an
+    // activation fused into the preceding operator, is recorded in the replacedOutputs.
+    struct PassContext {
+        GraphBuilderBase* builder;
+        std::vector<Ref<OperatorBase>> operators;
+        std::unordered_set<const OperandBase*> outputs;
+        std::unordered_map<const OperandBase*, const OperandBase*> replacedOutputs;
+    };
+
+    // Replace the uses of |operand| by the operators following |position| with |replacement|.
+    void ReplaceAllUsesWith(PassContext& context,
+                            size_t position,
+                            const OperandBase* operand,
+                            OperandBase* replacement);
+
+    // Whether |operand| is used by exactly one operator and isn't a named output.
+    bool HasSingleUse(const PassContext& context, const OperandBase* operand);
+
+    // Move the named output |output| to |replacement|.
+    void ReplaceOutput(PassContext& context,
+                       const OperandBase* output,
+                       const OperandBase* replacement);
+
+    class GraphPass {
+      public:
+        virtual ~GraphPass() = default;
+
+        virtual const char* GetName() const = 0;
+        // Rewrite the graph in place, return true if the graph is changed.
+        virtual ResultOrError<bool> Run(PassContext& context) = 0;
+    };
+
+    // The backend-agnostic optimization pipeline that runs on the sorted operators before they
+    // are added to the backend graph.
+    class PassManager {
+      public:
+        PassManager() = default;
+        ~PassManager() = default;
+
+        void AddPass(std::unique_ptr<GraphPass> pass);
+        void AddDefaultPasses();
+        // Run the passes in order until none of them changes the graph.
+        MaybeError Run(PassContext& context);
+
+      private:
+        std::vector<std::unique_ptr<GraphPass>> mPasses;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_PASS_MANAGER_H_
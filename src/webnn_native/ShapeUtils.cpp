@@ -0,0 +1,121 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/ShapeUtils.h"
+
+#include <algorithm>
+
+#include "common/Assert.h"
+
+namespace webnn_native {
+
+    bool BroadcastShapes(const std::vector<int32_t>& aShape,
+                         const std::vector<int32_t>& bShape,
+                         std::vector<int32_t>& outputShape,
+                         size_t skipAxes) {
+        size_t aRank = aShape.size();
+        size_t bRank = bShape.size();
+        size_t outputRank = std::max(aRank, bRank);
+        outputShape.resize(outputRank);
+        for (size_t i = skipAxes; i < outputRank; ++i) {
+            int32_t aDim = i < aRank ? aShape[aRank - i - 1] : 1;
+            int32_t bDim = i < bRank ? bShape[bRank - i - 1] : 1;
+            size_t outputIndex = outputRank - i - 1;
+            if (aDim < 0 || bDim < 0) {
+                // The dimension is unknown at build time, so it is checked by the backend.
+                int32_t knownDim = std::max(aDim, bDim);
+                outputShape[outputIndex] = knownDim > 1 ? knownDim : -1;
+            } else if (aDim == bDim || bDim == 1) {
+                outputShape[outputIndex] = aDim;
+            } else if (aDim == 1) {
+                outputShape[outputIndex] = bDim;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IsUnidirectionalBroadcastable(const std::vector<int32_t>& shape,
+                                       const std::vector<int32_t>& targetShape) {
+        if (shape.size() > targetShape.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < shape.size(); ++i) {
+            int32_t dim = shape[shape.size() - i - 1];
+            int32_t targetDim = targetShape[targetShape.size() - i - 1];
+            if (dim >= 0 && targetDim >= 0 && dim != 1 && dim != targetDim) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ComputeImplicitPaddingForAutoPad(ml::AutoPad autoPad,
+                                          int32_t inputSize,
+                                          int32_t filterSize,
+                                          int32_t stride,
+                                          int32_t dilation,
+                                          int32_t& paddingBegin,
+                                          int32_t& paddingEnd) {
+        DAWN_ASSERT(autoPad != ml::AutoPad::Explicit);
+        int32_t outputSize = (inputSize + stride - 1) / stride;
+        int32_t effectiveFilterSize = (filterSize - 1) * dilation + 1;
+        int32_t neededInput = (outputSize - 1) * stride + effectiveFilterSize;
+        int32_t totalPadding = std::max(0, neededInput - inputSize);
+        if (autoPad == ml::AutoPad::SameUpper) {
+            paddingBegin = totalPadding / 2;
+            paddingEnd = (totalPadding + 1) / 2;
+        } else {
+            paddingBegin = (totalPadding + 1) / 2;
+            paddingEnd = totalPadding / 2;
+        }
+    }
+
+    int32_t ComputeConv2dOutputSize(int32_t inputSize,
+                                    int32_t filterSize,
+                                    int32_t paddingBegin,
+                                    int32_t paddingEnd,
+                                    int32_t stride,
+                                    int32_t dilation) {
+        int32_t effectiveFilterSize = (filterSize - 1) * dilation + 1;
+        return (inputSize - effectiveFilterSize + paddingBegin + paddingEnd) / stride + 1;
+    }
+
+    size_t SizeOfShape(const std::vector<int32_t>& shape) {
+        size_t size = 1;
+        for (auto dim : shape) {
+            DAWN_ASSERT(dim >= 0);
+            size *= dim;
+        }
+        return size;
+    }
+
+    size_t SizeOfOperandType(ml::OperandType type) {
+        switch (type) {
+            case ml::OperandType::Float32:
+            case ml::OperandType::Int32:
+            case ml::OperandType::Uint32:
+                return 4;
+            case ml::OperandType::Float16:
+                return 2;
+            case ml::OperandType::Int8:
+            case ml::OperandType::Uint8:
+                return 1;
+            default:
+                UNREACHABLE();
+        }
+    }
+
+}  // namespace webnn_native
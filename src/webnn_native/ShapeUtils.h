@@ -0,0 +1,67 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_SHAPE_UTILS_H_
+#define WEBNN_NATIVE_SHAPE_UTILS_H_
+
+#include <vector>
+
+#include "webnn_native/webnn_platform.h"
+
+namespace webnn_native {
+
+    // A negative dimension of an inferred shape means that the dimension is unknown at build
+    // time, e.g. the output of pad with a non-constant padding operand. The helpers below skip
+    // the checks of the unknown dimensions.
+
+    // Broadcast the shapes according to
+    // [numpy-broadcasting-rule](https://webmachinelearning.github.io/webnn/#biblio-numpy-broadcasting-rule).
+    // The last |skipAxes| dimensions are not broadcasted and are left to the caller, e.g. the
+    // matrix dimensions of matmul. Return false if the shapes are not broadcastable.
+    bool BroadcastShapes(const std::vector<int32_t>& aShape,
+                         const std::vector<int32_t>& bShape,
+                         std::vector<int32_t>& outputShape,
+                         size_t skipAxes = 0);
+
+    // Whether |shape| can be broadcasted to |targetShape| without changing |targetShape|.
+    bool IsUnidirectionalBroadcastable(const std::vector<int32_t>& shape,
+                                       const std::vector<int32_t>& targetShape);
+
+    // Compute the beginning and ending padding of one spatial dimension for the same-upper and
+    // same-lower auto pad.
+    void ComputeImplicitPaddingForAutoPad(ml::AutoPad autoPad,
+                                          int32_t inputSize,
+                                          int32_t filterSize,
+                                          int32_t stride,
+                                          int32_t dilation,
+                                          int32_t& paddingBegin,
+                                          int32_t& paddingEnd);
+
+    // Compute the output size of one spatial dimension for conv2d and pool2d.
+    int32_t ComputeConv2dOutputSize(int32_t inputSize,
+                                    int32_t filterSize,
+                                    int32_t paddingBegin,
+                                    int32_t paddingEnd,
+                                    int32_t stride,
+                                    int32_t dilation);
+
+    // The number of elements of the shape, a scalar has one element.
+    size_t SizeOfShape(const std::vector<int32_t>& shape);
+
+    // The byte size of one element of the operand type.
+    size_t SizeOfOperandType(ml::OperandType type);
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_SHAPE_UTILS_H_
@@ -0,0 +1,69 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/TaskQueue.h"
+
+namespace webnn_native {
+
+    TaskQueue::TaskQueue() : mState(std::make_shared<State>()) {
+    }
+
+    TaskQueue::~TaskQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mState->mutex);
+            mState->stopped = true;
+        }
+        mState->condition.notify_one();
+        if (!mThread.joinable()) {
+            return;
+        }
+        if (mThread.get_id() == std::this_thread::get_id()) {
+            mThread.detach();
+        } else {
+            mThread.join();
+        }
+    }
+
+    void TaskQueue::Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mState->mutex);
+            mState->tasks.push_back(std::move(task));
+            if (!mThread.joinable()) {
+                mThread = std::thread(RunTasks, mState);
+            }
+        }
+        mState->condition.notify_one();
+    }
+
+    // The state is shared with the worker thread so that it outlives a queue destroyed by a task.
+    void TaskQueue::RunTasks(std::shared_ptr<State> state) {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->condition.wait(lock,
+                                      [&state] { return state->stopped || !state->tasks.empty(); });
+                if (state->tasks.empty()) {
+                    return;
+                }
+                task = std::move(state->tasks.front());
+                state->tasks.pop_front();
+            }
+            task();
+            // Release what the task holds before waiting for the next one.
+            task = nullptr;
+        }
+    }
+
+}  // namespace webnn_native
@@ -0,0 +1,54 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_TASK_QUEUE_H_
+#define WEBNN_NATIVE_TASK_QUEUE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace webnn_native {
+
+    // Run the tasks one by one on a worker thread that is started with the first task. The queue
+    // can be destroyed by a task on the worker thread, e.g. when the task releases the last
+    // reference of the graph owning the queue, the worker thread is detached and exits after the
+    // task.
+    class TaskQueue {
+      public:
+        TaskQueue();
+        ~TaskQueue();
+
+        void Post(std::function<void()> task);
+
+      private:
+        struct State {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::deque<std::function<void()>> tasks;
+            bool stopped = false;
+        };
+
+        static void RunTasks(std::shared_ptr<State> state);
+
+        std::shared_ptr<State> mState;
+        std::thread mThread;
+    };
+
+}  // namespace webnn_native
+
+#endif  // WEBNN_NATIVE_TASK_QUEUE_H_
@@ -18,6 +18,8 @@
 #include <memory>
 
 #include "common/Assert.h"
+#include "common/Log.h"
+#include "webnn_native/BackendRegistry.h"
 #include "webnn_native/GraphBuilder.h"
 
 #if defined(_WIN32)
@@ -53,37 +55,25 @@ namespace webnn_native {
         return GetProcsAutogen();
     }
 
-    namespace null {
-        ContextBase* Create(MLContextOptions const* options);
-    }
-    namespace ie {
-        ContextBase* Create(MLContextOptions const* options);
-    }
-    namespace dml {
-        ContextBase* Create(MLContextOptions const* options);
-    }
-    namespace onednn {
-        ContextBase* Create();
-    }
-    namespace xnnpack {
-        ContextBase* Create();
+    std::vector<MLBackendType> GetAvailableBackends() {
+        std::vector<MLBackendType> backendTypes;
+        for (auto& backend : BackendRegistry::Get().GetBackends()) {
+            backendTypes.push_back(static_cast<MLBackendType>(backend.type));
+        }
+        return backendTypes;
     }
 
-    // Should put the default null backend at the end.
     MLContext CreateContext(MLContextOptions const* options) {
-#if defined(WEBNN_ENABLE_BACKEND_OPENVINO)
-        return reinterpret_cast<MLContext>(ie::Create(options));
-#elif defined(WEBNN_ENABLE_BACKEND_DML)
-        return reinterpret_cast<MLContext>(dml::Create(options));
-#elif defined(WEBNN_ENABLE_BACKEND_ONEDNN)
-        return reinterpret_cast<MLContext>(onednn::Create());
-#elif defined(WEBNN_ENABLE_BACKEND_XNNPACK)
-        return reinterpret_cast<MLContext>(xnnpack::Create());
-#elif defined(WEBNN_ENABLE_BACKEND_NULL)
-        return reinterpret_cast<MLContext>(null::Create(options));
-#else
-        return nullptr;
-#endif
+        ContextOptions defaultOptions;
+        const ContextOptions& contextOptions =
+            options != nullptr ? *reinterpret_cast<ContextOptions const*>(options)
+                               : defaultOptions;
+        const BackendInfo* backend = BackendRegistry::Get().Select(contextOptions);
+        if (backend == nullptr) {
+            dawn::ErrorLog() << "The backend isn't enabled in the build.";
+            return nullptr;
+        }
+        return reinterpret_cast<MLContext>(backend->create(options));
     }
 
 }  // namespace webnn_native
@@ -24,6 +24,11 @@ namespace webnn_native { namespace dml {
     }
 
     Context::Context(ContextOptions const* options) : ContextBase(options) {
+        // DirectML fuses the activations that are supported by DML_OPERATOR_ACTIVATION_*.
+        for (auto type : {OperatorType::BatchNorm, OperatorType::Conv2d, OperatorType::Gemm}) {
+            mFusionRegistry.Register(type, {FusedOperator::LeakyRelu, FusedOperator::Relu,
+                                            FusedOperator::Sigmoid});
+        }
     }
 
     GraphBase* Context::CreateGraphImpl() {
@@ -496,25 +496,14 @@ namespace webnn_native { namespace dml {
         return {};
     }
 
-    ::dml::FusedActivation Graph::FuseOperator(OperatorBase* activation, ::dml::Expression& input) {
+    ::dml::FusedActivation Graph::FuseOperator(OperatorBase* activation) {
         ::dml::FusedActivation dmlActivation = ::dml::FusedActivation::None();
         if (activation == nullptr) {
             return dmlActivation;
         }
 
+        // Only the activations registered in the FusionRegistry of the context are fused.
         switch (activation->GetFusedOperator()) {
-            case FusedOperator::HardSwish: {
-                auto output = HardSwish(input);
-                DAWN_ASSERT(input.GetOutputDesc().sizes == output.GetOutputDesc().sizes);
-                input = output;
-                break;
-            }
-            // Workaround(mingming): Currently we implement Relu6 operator by clamp. While
-            // Clamp operator is not supported for fusion, and to ensure that we can find
-            // the min and max operands from the graph, we have added a clamp node in
-            // GraphBuilder directly.
-            case FusedOperator::Clamp:
-                break;
             case FusedOperator::Relu:
                 dmlActivation = ::dml::FusedActivation::Relu();
                 break;
@@ -523,7 +512,7 @@ namespace webnn_native { namespace dml {
                 break;
             case FusedOperator::LeakyRelu:
                 dmlActivation = ::dml::FusedActivation::LeakyRelu(
-                    reinterpret_cast<op::LeakyRelu*>(activation)->GetAlpha());
+                    static_cast<op::LeakyRelu*>(activation)->GetAlpha());
                 break;
             default:
                 DAWN_ASSERT(0);
@@ -608,7 +597,7 @@ namespace webnn_native { namespace dml {
         }
         ::dml::Expression output = ::dml::BatchNormalization(
             input, expressions[0], expressions[1], expressions[2], expressions[3], true,
-            options->epsilon, FuseOperator(options->activation, input));
+            options->epsilon, FuseOperator(options->activation));
         if (options->axis == 3) {
             output = ReinterpretInputLayout(NchwToNhwc, output);
         }
@@ -783,7 +772,7 @@ namespace webnn_native { namespace dml {
             // outPadding
             {},
             // groupCount
-            options->groups, FuseOperator(options->activation, input));
+            options->groups, FuseOperator(options->activation));
         if (options->inputLayout == ml::InputOperandLayout::Nhwc) {
             output = ::dml::Identity(ReinterpretInputLayout(NchwToNhwc, output));
         }
@@ -1432,7 +1421,8 @@ namespace webnn_native { namespace dml {
                                               ? DML_MATRIX_TRANSFORM_TRANSPOSE
                                               : DML_MATRIX_TRANSFORM_NONE;
         ::dml::Expression output =
-            ::dml::Gemm(a, b, c, aTranspose, bTranspose, options->alpha, options->beta);
+            ::dml::Gemm(a, b, c, aTranspose, bTranspose, options->alpha, options->beta,
+                        FuseOperator(gemm->GetActivation()));
         // Reshape back according to output rank.
         auto shrinkDims = ShrinkDimensions(output.GetOutputDesc().sizes, 2);
         output = ::dml::Reinterpret(output, shrinkDims, ::dml::NullOpt);
@@ -86,7 +86,7 @@ namespace webnn_native { namespace dml {
                                           void const* value,
                                           size_t size);
         ::dml::Expression HardSwish(::dml::Expression& input);
-        ::dml::FusedActivation FuseOperator(OperatorBase* activation, ::dml::Expression& input);
+        ::dml::FusedActivation FuseOperator(OperatorBase* activation);
 
         std::shared_ptr<::pydml::Device> mDevice;
         // The mutex is used to lock mDevice.
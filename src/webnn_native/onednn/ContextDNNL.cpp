@@ -14,14 +14,17 @@
 
 #include "webnn_native/onednn/ContextDNNL.h"
 
+#include "common/Assert.h"
 #include "common/Log.h"
 #include "common/RefCounted.h"
+#include "webnn_native/Operator.h"
 #include "webnn_native/onednn/GraphDNNL.h"
 
 namespace webnn_native { namespace onednn {
 
-    ContextBase* Create() {
-        Ref<ContextBase> context = AcquireRef(new Context());
+    ContextBase* Create(MLContextOptions const* options) {
+        Ref<ContextBase> context =
+            AcquireRef(new Context(reinterpret_cast<ContextOptions const*>(options)));
         dnnl_status_t status = reinterpret_cast<Context*>(context.Get())->CreateEngine();
         if (status != dnnl_success) {
             dawn::ErrorLog() << "Failed to create oneDNN engine.";
@@ -43,10 +46,27 @@ namespace webnn_native { namespace onednn {
         return context.Detach();
     }
 
-    Context::Context() : mEngine(nullptr) {
+    Context::Context(ContextOptions const* options)
+        : ContextBase(options), mEngine(nullptr), mComputeDataType(dnnl_f32) {
+        // The activations are appended as the eltwise post-ops of the primitives.
+        for (auto type : {OperatorType::Binary, OperatorType::Conv2d, OperatorType::Gemm}) {
+            mFusionRegistry.Register(type, {FusedOperator::Clamp, FusedOperator::Relu,
+                                            FusedOperator::Sigmoid, FusedOperator::LeakyRelu,
+                                            FusedOperator::HardSwish});
+        }
+        // The reduced precision computes in bf16 on the CPUs with the native bf16 instructions,
+        // the primitives still accumulate in f32. The other CPUs keep computing in f32.
+        if (GetContextOptions().reducedPrecision) {
+            const dnnl_cpu_isa_t isa = dnnl_get_effective_cpu_isa();
+            if (isa == dnnl_cpu_isa_avx512_core_bf16 || isa == dnnl_cpu_isa_avx512_core_amx) {
+                mComputeDataType = dnnl_bf16;
+            }
+        }
     }
 
     Context::~Context() {
+        // The graphs hold references to the context, so the packed constants are all released.
+        DAWN_ASSERT(mPackedConstants.empty());
         if (mEngine != nullptr) {
             dnnl_engine_destroy(mEngine);
         }
@@ -56,6 +76,54 @@ namespace webnn_native { namespace onednn {
         return dnnl_engine_create(&mEngine, engineKind, 0);
     }
 
+    bool Context::SupportsOperator(const OperatorBase* op) const {
+        return Graph::SupportsOperator(op);
+    }
+
+    dnnl_status_t Context::AcquirePackedConstant(
+        const PackedConstantKey& key,
+        std::function<dnnl_status_t(dnnl_memory_t*)> pack,
+        dnnl_memory_t* memory) {
+        std::lock_guard<std::mutex> lock(mPackedConstantsMutex);
+        auto range = mPackedConstants.equal_range(key.fingerprint);
+        for (auto it = range.first; it != range.second; ++it) {
+            PackedConstant& packed = it->second;
+            if (packed.key.byteLength == key.byteLength &&
+                dnnl_memory_desc_equal(&packed.key.srcDesc, &key.srcDesc) &&
+                dnnl_memory_desc_equal(&packed.key.dstDesc, &key.dstDesc)) {
+                ++packed.references;
+                *memory = packed.memory;
+                return dnnl_success;
+            }
+        }
+        dnnl_status_t status = pack(memory);
+        if (status != dnnl_success) {
+            return status;
+        }
+        mPackedConstants.insert(std::make_pair(key.fingerprint, PackedConstant{key, *memory, 1}));
+        return dnnl_success;
+    }
+
+    void Context::ReleasePackedConstant(dnnl_memory_t memory) {
+        std::lock_guard<std::mutex> lock(mPackedConstantsMutex);
+        for (auto it = mPackedConstants.begin(); it != mPackedConstants.end(); ++it) {
+            if (it->second.memory != memory) {
+                continue;
+            }
+            if (--it->second.references == 0) {
+                dnnl_memory_destroy(memory);
+                mPackedConstants.erase(it);
+            }
+            return;
+        }
+        DAWN_UNREACHABLE();
+    }
+
+    size_t Context::GetPackedConstantCount() {
+        std::lock_guard<std::mutex> lock(mPackedConstantsMutex);
+        return mPackedConstants.size();
+    }
+
     GraphBase* Context::CreateGraphImpl() {
         return new Graph(this);
     }
@@ -17,13 +17,27 @@
 
 #include "webnn_native/Context.h"
 
+#include <functional>
+#include <map>
+#include <mutex>
+
 #include <dnnl.h>
 
 namespace webnn_native { namespace onednn {
 
+    // The identity of a constant reordered to the format requested by a primitive. The constant
+    // is identified by the fingerprint of its data rather than by its buffer, so the copies of
+    // the same data, e.g. the constants copied for the dynamic batch, share the packed memory.
+    struct PackedConstantKey {
+        size_t byteLength;
+        uint64_t fingerprint;
+        dnnl_memory_desc_t srcDesc;
+        dnnl_memory_desc_t dstDesc;
+    };
+
     class Context : public ContextBase {
       public:
-        Context();
+        explicit Context(ContextOptions const* options);
         ~Context() override;
 
         dnnl_status_t CreateEngine(dnnl_engine_kind_t engineKind = dnnl_cpu);
@@ -32,10 +46,38 @@ namespace webnn_native { namespace onednn {
             return mEngine;
         }
 
+        bool SupportsOperator(const OperatorBase* op) const override;
+
+        // The data type that the float operands are computed in, the float16 and float32
+        // operands are converted to it at the boundaries of the graphs.
+        dnnl_data_type_t GetComputeDataType() const {
+            return mComputeDataType;
+        }
+
+        // The packed constants are shared by the graphs of the context that are built from the
+        // same constant data, e.g. the graphs of different batch sizes. The pack function
+        // reorders the constant on a miss, and the memory is destroyed when the last graph
+        // releases it.
+        dnnl_status_t AcquirePackedConstant(const PackedConstantKey& key,
+                                            std::function<dnnl_status_t(dnnl_memory_t*)> pack,
+                                            dnnl_memory_t* memory);
+        void ReleasePackedConstant(dnnl_memory_t memory);
+        // The number of the packed constants referenced by the graphs.
+        size_t GetPackedConstantCount();
+
       private:
         GraphBase* CreateGraphImpl() override;
 
         dnnl_engine_t mEngine;
+        dnnl_data_type_t mComputeDataType;
+
+        struct PackedConstant {
+            PackedConstantKey key;
+            dnnl_memory_t memory;
+            uint32_t references;
+        };
+        std::multimap<uint64_t, PackedConstant> mPackedConstants;
+        std::mutex mPackedConstantsMutex;
     };
 
 }}  // namespace webnn_native::onednn
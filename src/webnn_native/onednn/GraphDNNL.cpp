@@ -14,6 +14,7 @@
 
 #include "webnn_native/onednn/GraphDNNL.h"
 
+#include <functional>
 #include <numeric>
 
 #include "common/Assert.h"
@@ -22,6 +23,7 @@
 #include "webnn_native/NamedInputs.h"
 #include "webnn_native/NamedOutputs.h"
 #include "webnn_native/Operand.h"
+#include "webnn_native/ShapeUtils.h"
 
 #define FAILED(status) (((dnnl_status_t)(status)) != dnnl_success)
 
@@ -99,6 +101,10 @@ namespace webnn_native { namespace onednn {
                 dnnlDataType = dnnl_f16;
             } else if (operandType == ml::OperandType::Int32) {
                 dnnlDataType = dnnl_s32;
+            } else if (operandType == ml::OperandType::Int8) {
+                dnnlDataType = dnnl_s8;
+            } else if (operandType == ml::OperandType::Uint8) {
+                dnnlDataType = dnnl_u8;
             } else {
                 return dnnl_invalid_arguments;
             }
@@ -307,6 +313,192 @@ namespace webnn_native { namespace onednn {
                     return dnnl_invalid_arguments;
             }
         }
+
+        bool IsFloatDataType(dnnl_data_type_t dataType) {
+            return dataType == dnnl_f32 || dataType == dnnl_f16 || dataType == dnnl_bf16;
+        }
+
+        // The descriptor of the same layout with another data type, the strides are counted in
+        // elements so they are kept.
+        dnnl_memory_desc_t WithDataType(const dnnl_memory_desc_t& desc, dnnl_data_type_t dataType) {
+            dnnl_memory_desc_t newDesc = desc;
+            newDesc.data_type = dataType;
+            return newDesc;
+        }
+
+        // Reorder the memory of a constant at build time, the new memory isn't owned by the graph.
+        dnnl_status_t ExecuteReorder(dnnl_engine_t engine,
+                                     const dnnl_memory_desc_t* srcDesc,
+                                     dnnl_memory_t srcMem,
+                                     const dnnl_memory_desc_t* dstDesc,
+                                     dnnl_memory_t* dstMem) {
+            DNNL_TRY(dnnl_memory_create(dstMem, dstDesc, engine, DNNL_MEMORY_ALLOCATE));
+            dnnl_primitive_desc_t reorderDesc;
+            DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, srcDesc, engine, dstDesc,
+                                                        engine, NULL));
+            dnnl_primitive_t reorder;
+            DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
+            DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
+            std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, srcMem}, {DNNL_ARG_DST, *dstMem}};
+            dnnl_stream_t stream;
+            DNNL_TRY(dnnl_stream_create(&stream, engine, dnnl_stream_default_flags));
+            DNNL_TRY(dnnl_primitive_execute(reorder, stream, args.size(), args.data()));
+            DNNL_TRY(dnnl_stream_wait(stream));
+            DNNL_TRY(dnnl_stream_destroy(stream));
+            DNNL_TRY(dnnl_primitive_destroy(reorder));
+            return dnnl_success;
+        }
+
+        // The FNV-1a hash of the constant data.
+        uint64_t Fingerprint(const void* buffer, size_t byteLength) {
+            const uint8_t* data = static_cast<const uint8_t*>(buffer);
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < byteLength; ++i) {
+                hash = (hash ^ data[i]) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // The eltwise algorithm of a unary operator, which is either standalone or fused.
+        dnnl_status_t GetEltwiseAlgorithm(const op::Unary* unary,
+                                          dnnl_alg_kind_t& algKind,
+                                          float& alpha,
+                                          float& beta) {
+            alpha = 0;
+            beta = 0;
+            switch (unary->GetType()) {
+                case op::UnaryOpType::kRelu:
+                    algKind = dnnl_eltwise_relu;
+                    break;
+                case op::UnaryOpType::kLeakyRelu:
+                    // The relu with the negative slope.
+                    algKind = dnnl_eltwise_relu;
+                    alpha = static_cast<const op::LeakyRelu*>(unary)->GetAlpha();
+                    break;
+                case op::UnaryOpType::kSigmoid:
+                    algKind = dnnl_eltwise_logistic;
+                    break;
+                case op::UnaryOpType::kTanh:
+                    algKind = dnnl_eltwise_tanh;
+                    break;
+                case op::UnaryOpType::kHardSwish:
+                    algKind = dnnl_eltwise_hardswish;
+                    break;
+                default:
+                    return dnnl_unimplemented;
+            }
+            return dnnl_success;
+        }
+
+        // Append an eltwise post-op for the activation fused into a primitive.
+        dnnl_status_t AppendActivation(dnnl_post_ops_t postops, const OperatorBase* activation) {
+            dnnl_alg_kind_t algKind;
+            float alpha = 0;
+            float beta = 0;
+            if (activation->GetFusedOperator() == FusedOperator::Clamp) {
+                auto clamp = static_cast<const op::Clamp*>(activation);
+                if (!clamp->IsClampByValue()) {
+                    return dnnl_unimplemented;
+                }
+                algKind = dnnl_eltwise_clip;
+                alpha = clamp->GetMinValue();
+                beta = clamp->GetMaxValue();
+            } else {
+                DNNL_TRY(GetEltwiseAlgorithm(static_cast<const op::Unary*>(activation), algKind,
+                                             alpha, beta));
+            }
+            DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, algKind, alpha, beta));
+            return dnnl_success;
+        }
+
+        // The attribute of the post-ops is left null without post-ops.
+        dnnl_status_t CreatePostOpsAttr(const_dnnl_post_ops_t postops,
+                                        dnnl_primitive_attr_t* attr) {
+            *attr = nullptr;
+            if (dnnl_post_ops_len(postops) == 0) {
+                return dnnl_success;
+            }
+            DNNL_TRY(dnnl_primitive_attr_create(attr));
+            DNNL_TRY(dnnl_primitive_attr_set_post_ops(*attr, postops));
+            return dnnl_success;
+        }
+
+        dnnl_status_t CreateActivationAttr(const OperatorBase* activation,
+                                           dnnl_primitive_attr_t* attr) {
+            *attr = nullptr;
+            if (activation == nullptr) {
+                return dnnl_success;
+            }
+            dnnl_post_ops_t postops;
+            DNNL_TRY(dnnl_post_ops_create(&postops));
+            dnnl_status_t status = AppendActivation(postops, activation);
+            if (status == dnnl_success) {
+                status = CreatePostOpsAttr(postops, attr);
+            }
+            dnnl_post_ops_destroy(postops);
+            return status;
+        }
+
+        bool IsFloatConstant(const OperandBase* operand) {
+            return operand->Operator()->GetOperatorType() == OperatorType::Constant &&
+                   operand->Type() == ml::OperandType::Float32;
+        }
+
+        // The int8 weights quantized by tensor or along |axis| with the zero points of 0.
+        bool IsSymmetricWeights(const OperandBase* weights, int32_t axis) {
+            const Quantization& quantization = weights->GetQuantization();
+            if (weights->Type() != ml::OperandType::Int8 ||
+                (quantization.IsPerChannel() && quantization.axis != axis)) {
+                return false;
+            }
+            for (size_t c = 0; c < quantization.scales.size(); ++c) {
+                if (quantization.ZeroPoint(c) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // The activations that commute with the requantization by a positive scale.
+        bool IsQuantizableActivation(const OperatorBase* activation) {
+            return activation == nullptr || activation->GetFusedOperator() == FusedOperator::Relu ||
+                   (activation->GetFusedOperator() == FusedOperator::Clamp &&
+                    static_cast<const op::Clamp*>(activation)->IsClampByValue());
+        }
+
+        // The dequantized |operand| is read from the values quantized as |quantized|, so that
+        // an operator that doesn't rescale the values reads them in place.
+        bool IsQuantizedAs(const OperandBase* operand, const OperandBase* quantized) {
+            if (operand->Operator()->GetOperatorType() != OperatorType::DequantizeLinear) {
+                return false;
+            }
+            const OperandBase* input = operand->Operator()->Inputs()[0].Get();
+            const Quantization& inputQuantization = input->GetQuantization();
+            const Quantization& quantization = quantized->GetQuantization();
+            return input->Type() == quantized->Type() && inputQuantization.scales.size() == 1 &&
+                   quantization.scales.size() == 1 &&
+                   inputQuantization.Scale(0) == quantization.Scale(0) &&
+                   inputQuantization.ZeroPoint(0) == quantization.ZeroPoint(0);
+        }
+
+        // Append the activation, if any, applied to the values quantized by |scale|, the bounds
+        // of the clamp are divided by the scale. The scale is 1 for the float values.
+        dnnl_status_t AppendQuantizedActivation(dnnl_post_ops_t postops,
+                                                const OperatorBase* activation,
+                                                float scale) {
+            if (activation == nullptr) {
+                return dnnl_success;
+            }
+            if (activation->GetFusedOperator() == FusedOperator::Clamp &&
+                static_cast<const op::Clamp*>(activation)->IsClampByValue()) {
+                auto clamp = static_cast<const op::Clamp*>(activation);
+                DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_clip,
+                                                      clamp->GetMinValue() / scale,
+                                                      clamp->GetMaxValue() / scale));
+                return dnnl_success;
+            }
+            return AppendActivation(postops, activation);
+        }
     }  // anonymous namespace
 
     Graph::Graph(Context* context) : GraphBase(context) {
@@ -316,6 +508,9 @@ namespace webnn_native { namespace onednn {
         for (auto memory : mMemories) {
             dnnl_memory_destroy(memory);
         }
+        for (auto memory : mPackedConstants) {
+            reinterpret_cast<Context*>(GetContext())->ReleasePackedConstant(memory);
+        }
         for (auto op : mOperations) {
             dnnl_primitive_destroy(op.primitive);
         }
@@ -324,11 +519,19 @@ namespace webnn_native { namespace onednn {
     MaybeError Graph::AddConstant(const op::Constant* constant) {
         const OperandDescriptor* desc = constant->GetOperandDescriptor();
         dnnl_memory_t memory;
-        DAWN_TRY(CreateDnnlMemory(GetEngine(), desc, &memory, constant->GetBuffer(),
-                                  constant->GetByteLength()));
+        DAWN_TRY(CreateDnnlMemory(GetEngine(), desc, &memory));
         mMemories.push_back(memory);
+        DAWN_TRY(dnnl_memory_set_data_handle(memory, const_cast<void*>(constant->GetBuffer())));
+        const dnnl_memory_desc_t* memoryDesc;
+        DAWN_TRY(dnnl_memory_get_memory_desc(memory, &memoryDesc));
+        if (IsFloatDataType(memoryDesc->data_type) &&
+            memoryDesc->data_type != GetComputeDataType()) {
+            mMemoryReinterprets.insert(
+                std::make_pair(memory, WithDataType(*memoryDesc, GetComputeDataType())));
+        }
         mConstantMemories.insert(memory);
-        mOperandMemoryMap.insert(std::make_pair(constant, memory));
+        mConstantOperators.insert(std::make_pair(memory, constant));
+        mOperandMemoryMap.insert(std::make_pair(constant->PrimaryOutput(), memory));
         return {};
     }
 
@@ -337,73 +540,419 @@ namespace webnn_native { namespace onednn {
         dnnl_memory_t memory;
         DAWN_TRY(CreateDnnlMemory(GetEngine(), desc, &memory));
         mMemories.push_back(memory);
-        mOperandMemoryMap.insert(std::make_pair(input, memory));
         mInputMemoryMap.insert(std::make_pair(input->GetName(), memory));
+        // The float input of another type than the compute type is converted by a reorder that
+        // runs before the operators.
+        const dnnl_memory_desc_t* memoryDesc;
+        DAWN_TRY(dnnl_memory_get_memory_desc(memory, &memoryDesc));
+        if (IsFloatDataType(memoryDesc->data_type) &&
+            memoryDesc->data_type != GetComputeDataType()) {
+            const dnnl_memory_desc_t computeMemoryDesc =
+                WithDataType(*memoryDesc, GetComputeDataType());
+            DAWN_TRY(Reorder(memoryDesc, memory, &computeMemoryDesc, &memory));
+        }
+        mOperandMemoryMap.insert(std::make_pair(input->PrimaryOutput(), memory));
         return {};
     }
 
-    dnnl_status_t Graph::BuildPrimitives() {
-        if (mOperandsToBuild.empty()) {
-            dawn::ErrorLog() << "No operators to build.";
-            return dnnl_invalid_arguments;
-        }
-        auto& info = mOperandsToBuild[0];
-        if (mOperandsToBuild.size() == 1) {
-            if (info.opType == OperandType::UNARY) {
-                DNNL_TRY(AddUnaryImpl(reinterpret_cast<const op::Unary*>(info.op)));
-            } else if (info.opType == OperandType::CLAMP) {
-                DNNL_TRY(AddClampImpl(reinterpret_cast<const op::Clamp*>(info.op)));
-            } else if (info.opType == OperandType::BINARY) {
-                DNNL_TRY(AddBinaryImpl(reinterpret_cast<const op::Binary*>(info.op)));
-            } else if (info.opType == OperandType::CONV2D) {
-                DNNL_TRY(AddConv2dImpl(reinterpret_cast<const op::Conv2d*>(info.op)));
-            } else if (info.opType == OperandType::POOL2D) {
-                DNNL_TRY(AddPool2dImpl(reinterpret_cast<const op::Pool2d*>(info.op)));
-            } else {
-                return dnnl_unimplemented;
+    bool Graph::SupportsOperator(const OperatorBase* op) {
+        // The activations fused into the primitives are appended as the eltwise post-ops.
+        auto supportsActivation = [](const OperatorBase* activation) {
+            if (activation == nullptr) {
+                return true;
             }
-        } else if (info.opType == OperandType::CONV2D) {
-            // Try to fuse add and clamp into conv2d
-            const op::Conv2d* conv2d = reinterpret_cast<const op::Conv2d*>(info.op);
-            if (mOperandsToBuild.size() > 3) {
-                dawn::ErrorLog() << "Cannot fuse conv2d subgraph with more than 3 ops.";
-                return dnnl_invalid_arguments;
+            if (activation->GetFusedOperator() == FusedOperator::Clamp) {
+                return static_cast<const op::Clamp*>(activation)->IsClampByValue();
             }
-            const op::Binary* add = nullptr;
-            const op::Clamp* clamp = nullptr;
-            for (size_t i = 1; i < mOperandsToBuild.size(); ++i) {
-                auto& postOp = mOperandsToBuild[i];
-                if (postOp.opType == OperandType::BINARY &&
-                    reinterpret_cast<const op::Binary*>(postOp.op)->GetType() ==
-                        op::BinaryOpType::kAdd) {
-                    add = reinterpret_cast<const op::Binary*>(postOp.op);
-                } else if (postOp.opType == OperandType::CLAMP) {
-                    clamp = reinterpret_cast<const op::Clamp*>(postOp.op);
+            dnnl_alg_kind_t algKind;
+            float alpha;
+            float beta;
+            return GetEltwiseAlgorithm(static_cast<const op::Unary*>(activation), algKind, alpha,
+                                       beta) == dnnl_success;
+        };
+        // The reorders of the quantization only take a common zero point.
+        auto hasCommonZeroPoint = [](const Quantization& quantization) {
+            for (size_t c = 1; c < quantization.scales.size(); ++c) {
+                if (quantization.ZeroPoint(c) != quantization.ZeroPoint(0)) {
+                    return false;
                 }
             }
-            if ((mOperandsToBuild.size() == 2 && !add && !clamp) ||
-                (mOperandsToBuild.size() == 3 && (!add || !clamp))) {
-                dawn::ErrorLog() << "Failed to fuse conv2d subgraph.";
-                return dnnl_invalid_arguments;
+            return true;
+        };
+        switch (op->GetOperatorType()) {
+            case OperatorType::Binary: {
+                auto binary = static_cast<const op::Binary*>(op);
+                switch (binary->GetType()) {
+                    case op::BinaryOpType::kAdd:
+                    case op::BinaryOpType::kMul:
+                    case op::BinaryOpType::kMatMul:
+                        return supportsActivation(binary->GetActivation());
+                    default:
+                        return false;
+                }
             }
-            DNNL_TRY(AddConv2dImpl(conv2d, add, clamp));
-        } else {
-            return dnnl_unimplemented;
+            case OperatorType::Conv2d: {
+                const Conv2dOptions* options = static_cast<const op::Conv2d*>(op)->GetOptions();
+                return supportsActivation(options->activation);
+            }
+            case OperatorType::DequantizeLinear:
+                return hasCommonZeroPoint(op->Inputs()[0]->GetQuantization());
+            case OperatorType::Gemm: {
+                auto gemm = static_cast<const op::Gemm*>(op);
+                const GemmOptions* options = gemm->GetOptions();
+                // The c operand is added as the bias, which isn't scaled apart from the product.
+                if (gemm->Inputs().size() == 3 &&
+                    (options->alpha != 1.0f || options->beta != 1.0f)) {
+                    return false;
+                }
+                return supportsActivation(gemm->GetActivation());
+            }
+            case OperatorType::Pool2d: {
+                auto pool2d = static_cast<const op::Pool2d*>(op);
+                return pool2d->GetOptions()->layout == ml::InputOperandLayout::Nchw &&
+                       (pool2d->GetType() == op::Pool2dType::kAveragePool2d ||
+                        pool2d->GetType() == op::Pool2dType::kMaxPool2d);
+            }
+            case OperatorType::QuantizeLinear:
+                return hasCommonZeroPoint(op->PrimaryOutput()->GetQuantization());
+            case OperatorType::Unary: {
+                auto unary = static_cast<const op::Unary*>(op);
+                if (unary->GetType() == op::UnaryOpType::kSoftmax) {
+                    // The softmax primitive normalizes the axis 1 of the 2-D input.
+                    return unary->Inputs()[0]->Rank() == 2;
+                }
+                dnnl_alg_kind_t algKind;
+                float alpha;
+                float beta;
+                return GetEltwiseAlgorithm(unary, algKind, alpha, beta) == dnnl_success;
+            }
+            case OperatorType::Clamp:
+            case OperatorType::Concat:
+            case OperatorType::Constant:
+            case OperatorType::Input:
+            case OperatorType::Reshape:
+                return true;
+            default:
+                return false;
         }
-        return dnnl_success;
     }
 
     MaybeError Graph::AddOutput(const std::string& name, const OperandBase* output) {
-        DAWN_TRY(BuildPrimitives());
-        DAWN_ASSERT(mOperandMemoryMap.find(output) != mOperandMemoryMap.end());
-        dnnl_memory_t plainOutputMemory;
-        DAWN_TRY(ReorderToPlainFormat(mOperandMemoryMap.at(output), &plainOutputMemory));
-        mOutputMemoryMap.insert(std::make_pair(name, plainOutputMemory));
+        mOutputs.push_back(std::make_pair(name, output));
         return {};
     }
 
+    dnnl_status_t Graph::AddOperatorImpl(const OperatorBase* op) {
+        switch (op->GetOperatorType()) {
+            case OperatorType::Binary: {
+                auto binary = static_cast<const op::Binary*>(op);
+                if (GetFusableQuantize(binary) != nullptr) {
+                    return dnnl_success;
+                }
+                auto fused = mFusedBinaries.find(binary);
+                if (fused != mFusedBinaries.end()) {
+                    return AddConv2dImpl(fused->second, binary);
+                }
+                return AddBinaryImpl(binary);
+            }
+            case OperatorType::Clamp: {
+                auto clamp = static_cast<const op::Clamp*>(op);
+                if (GetFusableQuantize(clamp) != nullptr) {
+                    return dnnl_success;
+                }
+                return AddClampImpl(clamp);
+            }
+            case OperatorType::Concat: {
+                auto concat = static_cast<const op::Concat*>(op);
+                if (GetFusableQuantize(concat) != nullptr) {
+                    return dnnl_success;
+                }
+                return AddConcatImpl(concat);
+            }
+            case OperatorType::Conv2d: {
+                auto conv2d = static_cast<const op::Conv2d*>(op);
+                if (GetFusableQuantize(conv2d) != nullptr) {
+                    return dnnl_success;
+                }
+                const op::Binary* binary = GetFusableBinary(conv2d);
+                if (binary != nullptr) {
+                    mFusedBinaries.insert(std::make_pair(binary, conv2d));
+                    return dnnl_success;
+                }
+                return AddConv2dImpl(conv2d);
+            }
+            case OperatorType::DequantizeLinear:
+                return AddDequantizeLinearImpl(static_cast<const op::DequantizeLinear*>(op));
+            case OperatorType::Gemm: {
+                auto gemm = static_cast<const op::Gemm*>(op);
+                if (GetFusableQuantize(gemm) != nullptr) {
+                    return dnnl_success;
+                }
+                return AddGemmImpl(gemm);
+            }
+            case OperatorType::Pool2d: {
+                auto pool2d = static_cast<const op::Pool2d*>(op);
+                if (GetFusableQuantize(pool2d) != nullptr) {
+                    return dnnl_success;
+                }
+                return AddPool2dImpl(pool2d);
+            }
+            case OperatorType::QuantizeLinear: {
+                auto quantize = static_cast<const op::QuantizeLinear*>(op);
+                auto fused = mQuantizedOperators.find(quantize);
+                if (fused == mQuantizedOperators.end()) {
+                    return AddQuantizeLinearImpl(quantize);
+                }
+                switch (fused->second->GetOperatorType()) {
+                    case OperatorType::Binary:
+                        return AddQuantizedAddImpl(
+                            static_cast<const op::Binary*>(fused->second), quantize);
+                    case OperatorType::Clamp:
+                        return AddClampImpl(static_cast<const op::Clamp*>(fused->second),
+                                            quantize);
+                    case OperatorType::Concat:
+                        return AddConcatImpl(static_cast<const op::Concat*>(fused->second),
+                                             quantize);
+                    case OperatorType::Conv2d:
+                        return AddConv2dImpl(static_cast<const op::Conv2d*>(fused->second),
+                                             nullptr, quantize);
+                    case OperatorType::Gemm:
+                        return AddGemmImpl(static_cast<const op::Gemm*>(fused->second), quantize);
+                    case OperatorType::Pool2d:
+                        return AddPool2dImpl(static_cast<const op::Pool2d*>(fused->second),
+                                             quantize);
+                    default:
+                        DAWN_UNREACHABLE();
+                }
+            }
+            case OperatorType::Reshape:
+                return AddReshapeImpl(static_cast<const op::Reshape*>(op));
+            case OperatorType::Unary:
+                return AddUnaryImpl(static_cast<const op::Unary*>(op));
+            default:
+                return dnnl_unimplemented;
+        }
+    }
+
+    const op::Binary* Graph::GetFusableBinary(const op::Conv2d* conv2d) const {
+        const OperandBase* output = conv2d->PrimaryOutput();
+        if (conv2d->GetOptions()->inputLayout != ml::InputOperandLayout::Nchw) {
+            return nullptr;
+        }
+        for (auto& namedOutput : mOutputs) {
+            if (namedOutput.second == output) {
+                return nullptr;
+            }
+        }
+        auto consumers = mConsumers.find(output);
+        if (consumers == mConsumers.end() || consumers->second.size() != 1 ||
+            consumers->second[0]->GetOperatorType() != OperatorType::Binary) {
+            return nullptr;
+        }
+        auto binary = static_cast<const op::Binary*>(consumers->second[0]);
+        const OperandBase* a = binary->Inputs()[0].Get();
+        const OperandBase* b = binary->Inputs()[1].Get();
+        const OperandBase* other = a == output ? b : a;
+        if (other == output) {
+            return nullptr;
+        }
+        const std::vector<int32_t>& outputShape = output->Shape();
+        if (binary->GetType() == op::BinaryOpType::kAdd && other->Shape() == outputShape) {
+            return binary;
+        }
+        // The per-channel operand is broadcasted as [1, C, 1, 1].
+        if (binary->GetType() != op::BinaryOpType::kAdd &&
+            binary->GetType() != op::BinaryOpType::kMul) {
+            return nullptr;
+        }
+        if (other->Operator()->GetOperatorType() != OperatorType::Constant ||
+            other->Rank() > 4) {
+            return nullptr;
+        }
+        std::vector<int32_t> otherShape(4 - other->Rank(), 1);
+        otherShape.insert(otherShape.end(), other->Shape().begin(), other->Shape().end());
+        if (otherShape[0] != 1 || (otherShape[1] != 1 && otherShape[1] != outputShape[1]) ||
+            otherShape[2] != 1 || otherShape[3] != 1) {
+            return nullptr;
+        }
+        return binary;
+    }
+
+    const op::QuantizeLinear* Graph::GetOnlyQuantize(const OperatorBase* op) const {
+        const OperandBase* output = op->PrimaryOutput();
+        for (auto& namedOutput : mOutputs) {
+            if (namedOutput.second == output) {
+                return nullptr;
+            }
+        }
+        auto consumers = mConsumers.find(output);
+        if (consumers == mConsumers.end() || consumers->second.size() != 1 ||
+            consumers->second[0]->GetOperatorType() != OperatorType::QuantizeLinear) {
+            return nullptr;
+        }
+        return static_cast<const op::QuantizeLinear*>(consumers->second[0]);
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const OperatorBase* op) const {
+        switch (op->GetOperatorType()) {
+            case OperatorType::Binary:
+                return GetFusableQuantize(static_cast<const op::Binary*>(op));
+            case OperatorType::Clamp:
+                return GetFusableQuantize(static_cast<const op::Clamp*>(op));
+            case OperatorType::Concat:
+                return GetFusableQuantize(static_cast<const op::Concat*>(op));
+            case OperatorType::Conv2d:
+                return GetFusableQuantize(static_cast<const op::Conv2d*>(op));
+            case OperatorType::Gemm:
+                return GetFusableQuantize(static_cast<const op::Gemm*>(op));
+            case OperatorType::Pool2d:
+                return GetFusableQuantize(static_cast<const op::Pool2d*>(op));
+            default:
+                return nullptr;
+        }
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Conv2d* conv2d) const {
+        const Conv2dOptions* options = conv2d->GetOptions();
+        if (options->inputLayout != ml::InputOperandLayout::Nchw ||
+            options->filterLayout != ml::FilterOperandLayout::Oihw) {
+            return nullptr;
+        }
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(conv2d);
+        if (quantize == nullptr) {
+            return nullptr;
+        }
+        const OperatorBase* input = conv2d->Inputs()[0]->Operator();
+        const OperatorBase* filter = conv2d->Inputs()[1]->Operator();
+        if (input->GetOperatorType() != OperatorType::DequantizeLinear ||
+            filter->GetOperatorType() != OperatorType::DequantizeLinear) {
+            return nullptr;
+        }
+        // The input and the output are quantized by tensor and the filter by tensor or by output
+        // channel. The filter must be symmetric because oneDNN doesn't take the zero points of
+        // the weights.
+        const OperandBase* quantizedFilter = filter->Inputs()[0].Get();
+        if (input->Inputs()[0]->GetQuantization().IsPerChannel() ||
+            quantize->PrimaryOutput()->GetQuantization().IsPerChannel() ||
+            !IsSymmetricWeights(quantizedFilter, 0)) {
+            return nullptr;
+        }
+        // The bias is quantized to the accumulators at build time.
+        if (options->bias != nullptr && !IsFloatConstant(options->bias)) {
+            return nullptr;
+        }
+        // The activation is applied to the requantized values, only the piecewise linear ones
+        // commute with the scaling.
+        if (!IsQuantizableActivation(options->activation)) {
+            return nullptr;
+        }
+        return quantize;
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Gemm* gemm) const {
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(gemm);
+        if (quantize == nullptr) {
+            return nullptr;
+        }
+        const OperatorBase* a = gemm->Inputs()[0]->Operator();
+        const OperatorBase* b = gemm->Inputs()[1]->Operator();
+        if (a->GetOperatorType() != OperatorType::DequantizeLinear ||
+            b->GetOperatorType() != OperatorType::DequantizeLinear) {
+            return nullptr;
+        }
+        // The a and the output are quantized by tensor and b by tensor or by column, i.e. the
+        // axis 1 or the axis 0 of the transposed b, like the filter of conv2d.
+        const GemmOptions* options = gemm->GetOptions();
+        if (a->Inputs()[0]->GetQuantization().IsPerChannel() ||
+            quantize->PrimaryOutput()->GetQuantization().IsPerChannel() ||
+            !IsSymmetricWeights(b->Inputs()[0].Get(), options->bTranspose ? 0 : 1)) {
+            return nullptr;
+        }
+        // The c operand is a float constant of one value per column that is added as the bias
+        // to the accumulators, it isn't scaled by alpha and beta.
+        if (gemm->Inputs().size() == 3) {
+            const OperandBase* c = gemm->Inputs()[2].Get();
+            const std::vector<int32_t>& outputShape = gemm->PrimaryOutput()->Shape();
+            if (!IsFloatConstant(c) || options->alpha != 1.0f || options->beta != 1.0f ||
+                c->Rank() > 2 || SizeOfShape(c->Shape()) != static_cast<size_t>(outputShape[1]) ||
+                (c->Rank() != 0 && c->Shape().back() != outputShape[1])) {
+                return nullptr;
+            }
+        }
+        if (!IsQuantizableActivation(gemm->GetActivation())) {
+            return nullptr;
+        }
+        return quantize;
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Binary* binary) const {
+        if (binary->GetType() != op::BinaryOpType::kAdd) {
+            return nullptr;
+        }
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(binary);
+        if (quantize == nullptr) {
+            return nullptr;
+        }
+        // The operands are added without broadcasting.
+        const OperandBase* a = binary->Inputs()[0].Get();
+        const OperandBase* b = binary->Inputs()[1].Get();
+        if (a->Operator()->GetOperatorType() != OperatorType::DequantizeLinear ||
+            b->Operator()->GetOperatorType() != OperatorType::DequantizeLinear ||
+            a->Shape() != b->Shape()) {
+            return nullptr;
+        }
+        if (a->Operator()->Inputs()[0]->GetQuantization().IsPerChannel() ||
+            b->Operator()->Inputs()[0]->GetQuantization().IsPerChannel() ||
+            quantize->PrimaryOutput()->GetQuantization().IsPerChannel()) {
+            return nullptr;
+        }
+        if (!IsQuantizableActivation(binary->GetActivation())) {
+            return nullptr;
+        }
+        return quantize;
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Pool2d* pool2d) const {
+        if (pool2d->GetOptions()->layout != ml::InputOperandLayout::Nchw ||
+            (pool2d->GetType() != op::Pool2dType::kAveragePool2d &&
+             pool2d->GetType() != op::Pool2dType::kMaxPool2d)) {
+            return nullptr;
+        }
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(pool2d);
+        if (quantize == nullptr || !IsQuantizedAs(pool2d->Inputs()[0].Get(),
+                                                  quantize->PrimaryOutput())) {
+            return nullptr;
+        }
+        return quantize;
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Clamp* clamp) const {
+        if (!clamp->IsClampByValue()) {
+            return nullptr;
+        }
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(clamp);
+        if (quantize == nullptr || !IsQuantizedAs(clamp->Inputs()[0].Get(),
+                                                  quantize->PrimaryOutput())) {
+            return nullptr;
+        }
+        return quantize;
+    }
+
+    const op::QuantizeLinear* Graph::GetFusableQuantize(const op::Concat* concat) const {
+        const op::QuantizeLinear* quantize = GetOnlyQuantize(concat);
+        if (quantize == nullptr) {
+            return nullptr;
+        }
+        for (auto& input : concat->Inputs()) {
+            if (!IsQuantizedAs(input.Get(), quantize->PrimaryOutput())) {
+                return nullptr;
+            }
+        }
+        return quantize;
+    }
+
     MaybeError Graph::AddBinary(const op::Binary* binary) {
-        mOperandsToBuild.push_back({OperandType::BINARY, binary});
+        mOperators.push_back(binary);
         return {};
     }
 
@@ -494,6 +1043,8 @@ namespace webnn_native { namespace onednn {
         dnnl_memory_desc_t cInitDesc;
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&cInitDesc, cDims.size(), cDims.data(),
                                               aMemoryDesc->data_type, dnnl_format_tag_any));
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(CreateActivationAttr(binary->GetActivation(), &attr));
         dnnl_primitive_desc_t primitiveDesc;
         dnnl_data_type_t dataType = aMemoryDesc->data_type;
         if (binary->GetType() == op::BinaryOpType::kMatMul) {
@@ -506,7 +1057,7 @@ namespace webnn_native { namespace onednn {
             dnnl_matmul_desc_t matmulDesc;
             DNNL_TRY(dnnl_matmul_desc_init(&matmulDesc, &aInitDesc, &bInitDesc, NULL, &cInitDesc));
             DNNL_TRY(
-                dnnl_primitive_desc_create(&primitiveDesc, &matmulDesc, NULL, GetEngine(), NULL));
+                dnnl_primitive_desc_create(&primitiveDesc, &matmulDesc, attr, GetEngine(), NULL));
             const dnnl_memory_desc_t* input0InternalMemoryDesc =
                 dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_src_md, 0);
             DNNL_TRY(ReorderIfNeeded(aMemoryDesc, aMemory, input0InternalMemoryDesc, &aMemory));
@@ -526,7 +1077,10 @@ namespace webnn_native { namespace onednn {
             DNNL_TRY(
                 dnnl_binary_desc_init(&binaryDesc, algKind, aMemoryDesc, bMemoryDesc, &cInitDesc));
             DNNL_TRY(
-                dnnl_primitive_desc_create(&primitiveDesc, &binaryDesc, NULL, GetEngine(), NULL));
+                dnnl_primitive_desc_create(&primitiveDesc, &binaryDesc, attr, GetEngine(), NULL));
+        }
+        if (attr) {
+            DNNL_TRY(dnnl_primitive_attr_destroy(attr));
         }
         dnnl_memory_t cMemory;
         dnnl_primitive_t primitive;
@@ -543,7 +1097,7 @@ namespace webnn_native { namespace onednn {
         }
         mOperations.push_back({primitive, args});
         mMemories.push_back(cMemory);
-        mOperandMemoryMap.insert(std::make_pair(binary, cMemory));
+        mOperandMemoryMap.insert(std::make_pair(binary->PrimaryOutput(), cMemory));
         if (cRank != 0 && cRank < cMemoryDesc->ndims) {
             std::vector<dnnl_dim_t> cDims(cMemoryDesc->dims,
                                           cMemoryDesc->dims + cMemoryDesc->ndims);
@@ -556,16 +1110,99 @@ namespace webnn_native { namespace onednn {
         return dnnl_success;
     }
 
+    dnnl_status_t Graph::AddQuantizedAddImpl(const op::Binary* binary,
+                                             const op::QuantizeLinear* quantize) {
+        // The int8 add reads the operands before they are dequantized.
+        const OperandBase* aOperand = binary->Inputs()[0]->Operator()->Inputs()[0].Get();
+        const OperandBase* bOperand = binary->Inputs()[1]->Operator()->Inputs()[0].Get();
+        DAWN_ASSERT(mOperandMemoryMap.find(aOperand) != mOperandMemoryMap.end());
+        dnnl_memory_t aMemory = mOperandMemoryMap.at(aOperand);
+        const dnnl_memory_desc_t* aMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(aMemory, &aMemoryDesc));
+        DAWN_ASSERT(mOperandMemoryMap.find(bOperand) != mOperandMemoryMap.end());
+        dnnl_memory_t bMemory = mOperandMemoryMap.at(bOperand);
+        const dnnl_memory_desc_t* bMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(bMemory, &bMemoryDesc));
+        // The binary primitive reads b in the format of a.
+        dnnl_memory_desc_t bInternalMemoryDesc =
+            WithDataType(*aMemoryDesc, bMemoryDesc->data_type);
+        DNNL_TRY(ReorderIfNeeded(bMemoryDesc, bMemory, &bInternalMemoryDesc, &bMemory));
+
+        const OperandBase* output = quantize->PrimaryOutput();
+        dnnl_data_type_t outputDataType;
+        DNNL_TRY(GetDnnlDataType(output->Type(), outputDataType));
+        dnnl_memory_desc_t outputInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputInitDesc, aMemoryDesc->ndims,
+                                              aMemoryDesc->dims, outputDataType,
+                                              dnnl_format_tag_any));
+        dnnl_binary_desc_t binaryDesc;
+        DNNL_TRY(dnnl_binary_desc_init(&binaryDesc, dnnl_binary_add, aMemoryDesc,
+                                       &bInternalMemoryDesc, &outputInitDesc));
+
+        // The quantized output is aScale / outputScale * (a - aZeroPoint) + bScale /
+        // outputScale * (b - bZeroPoint) + outputZeroPoint, the operands are scaled by the
+        // attribute and the zero points are folded into the shifts of the linear post-ops
+        // around the activation.
+        const Quantization& aQuantization = aOperand->GetQuantization();
+        const Quantization& bQuantization = bOperand->GetQuantization();
+        const Quantization& outputQuantization = output->GetQuantization();
+        const float outputScale = outputQuantization.Scale(0);
+        const float aScale = aQuantization.Scale(0) / outputScale;
+        const float bScale = bQuantization.Scale(0) / outputScale;
+        const float shift = -(aScale * aQuantization.ZeroPoint(0) +
+                              bScale * bQuantization.ZeroPoint(0));
+        dnnl_post_ops_t postops;
+        DNNL_TRY(dnnl_post_ops_create(&postops));
+        if (shift != 0) {
+            DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_linear, 1.0, shift));
+        }
+        DNNL_TRY(AppendQuantizedActivation(postops, binary->GetActivation(), outputScale));
+        if (outputQuantization.ZeroPoint(0) != 0) {
+            DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_linear, 1.0,
+                                                  outputQuantization.ZeroPoint(0)));
+        }
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(dnnl_primitive_attr_create(&attr));
+        DNNL_TRY(dnnl_primitive_attr_set_post_ops(attr, postops));
+        DNNL_TRY(dnnl_post_ops_destroy(postops));
+        DNNL_TRY(dnnl_primitive_attr_set_scales(attr, DNNL_ARG_SRC_0, 1, 0, &aScale));
+        DNNL_TRY(dnnl_primitive_attr_set_scales(attr, DNNL_ARG_SRC_1, 1, 0, &bScale));
+        dnnl_primitive_desc_t primitiveDesc;
+        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &binaryDesc, attr, GetEngine(), NULL));
+        DNNL_TRY(dnnl_primitive_attr_destroy(attr));
+
+        const dnnl_memory_desc_t* outputMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
+        dnnl_memory_t outputMemory;
+        DNNL_TRY(
+            dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        dnnl_primitive_t primitive;
+        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
+        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
+        mOperations.push_back({primitive,
+                               {{DNNL_ARG_SRC_0, aMemory},
+                                {DNNL_ARG_SRC_1, bMemory},
+                                {DNNL_ARG_DST, outputMemory}}});
+        mMemories.push_back(outputMemory);
+        mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
+        return dnnl_success;
+    }
+
     MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
-        mOperandsToBuild.push_back({OperandType::CONV2D, conv2d});
+        mOperators.push_back(conv2d);
         return {};
     }
 
     dnnl_status_t Graph::AddConv2dImpl(const op::Conv2d* conv2d,
-                                       const op::Binary* add,
-                                       const op::Clamp* clamp) {
-        DAWN_ASSERT(conv2d->Inputs().size() == 2);
+                                       const op::Binary* binary,
+                                       const op::QuantizeLinear* quantize) {
         const OperandBase* inputOperand = conv2d->Inputs()[0].Get();
+        const OperandBase* filterOperand = conv2d->Inputs()[1].Get();
+        if (quantize != nullptr) {
+            // The int8 conv2d reads the operands before they are dequantized.
+            inputOperand = inputOperand->Operator()->Inputs()[0].Get();
+            filterOperand = filterOperand->Operator()->Inputs()[0].Get();
+        }
         DAWN_ASSERT(mOperandMemoryMap.find(inputOperand) != mOperandMemoryMap.end());
         dnnl_memory_t inputMemory = mOperandMemoryMap.at(inputOperand);
         const dnnl_memory_desc_t* inputMemoryDesc;
@@ -575,23 +1212,20 @@ namespace webnn_native { namespace onednn {
         const dnnl_memory_desc_t* actualInputMemoryDesc;
         dnnl_memory_desc_t transposedInputMemoryDesc;
         if (options->inputLayout == ml::InputOperandLayout::Nhwc) {
+            // The logical dimensions are always in {NCHW}, the permuted descriptor keeps the
+            // physical layout of the input, which is nhwc for a plain input or the blocked format
+            // of the conv2d that produces it.
             const int permute[] = {0, 2, 3, 1};
             DNNL_TRY(dnnl_memory_desc_permute_axes(&transposedInputMemoryDesc, inputMemoryDesc,
                                                    permute));
             inputDims.assign(transposedInputMemoryDesc.dims,
                              transposedInputMemoryDesc.dims + transposedInputMemoryDesc.ndims);
-            // logical dimension is always in {NCHW}
-            // physical layout is nhwc for input
-            DNNL_TRY(dnnl_memory_desc_init_by_tag(&transposedInputMemoryDesc, inputDims.size(),
-                                                  inputDims.data(), inputMemoryDesc->data_type,
-                                                  dnnl_nhwc));
             actualInputMemoryDesc = &transposedInputMemoryDesc;
         } else {
             inputDims.assign(inputMemoryDesc->dims, inputMemoryDesc->dims + inputMemoryDesc->ndims);
             actualInputMemoryDesc = inputMemoryDesc;
         }
 
-        const OperandBase* filterOperand = conv2d->Inputs()[1].Get();
         DAWN_ASSERT(mOperandMemoryMap.find(filterOperand) != mOperandMemoryMap.end());
         dnnl_memory_t filterMemory = mOperandMemoryMap.at(filterOperand);
         const dnnl_memory_desc_t* filterMemoryDesc;
@@ -670,7 +1304,14 @@ namespace webnn_native { namespace onednn {
             actualFilterMemoryDesc = &newFilterMemoryDesc;
         }
 
+        // The int8 conv2d reads the u8 or s8 input and the s8 filter and writes the type of the
+        // quantized output.
         dnnl_data_type_t dataType = actualInputMemoryDesc->data_type;
+        dnnl_data_type_t filterDataType = quantize != nullptr ? dnnl_s8 : dataType;
+        dnnl_data_type_t outputDataType = dataType;
+        if (quantize != nullptr) {
+            DNNL_TRY(GetDnnlDataType(quantize->PrimaryOutput()->Type(), outputDataType));
+        }
         dnnl_memory_desc_t inputInitDesc;
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&inputInitDesc, inputDims.size(), inputDims.data(),
                                               dataType, dnnl_format_tag_any));
@@ -678,11 +1319,11 @@ namespace webnn_native { namespace onednn {
         dnnl_memory_desc_t filterInitDesc;
         if (options->groups == 1) {
             DNNL_TRY(dnnl_memory_desc_init_by_tag(&filterInitDesc, filterDims.size(),
-                                                  filterDims.data(), dataType,
+                                                  filterDims.data(), filterDataType,
                                                   dnnl_format_tag_any));
         } else {
             DNNL_TRY(dnnl_memory_desc_init_by_tag(&filterInitDesc, groupFilterDims.size(),
-                                                  groupFilterDims.data(), dataType,
+                                                  groupFilterDims.data(), filterDataType,
                                                   dnnl_format_tag_any));
         }
         std::vector<dnnl_dim_t> strides = {options->strides[0], options->strides[1]};
@@ -721,77 +1362,127 @@ namespace webnn_native { namespace onednn {
         }
         dnnl_memory_desc_t outputInitDesc;
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputInitDesc, outputDims.size(), outputDims.data(),
-                                              dataType, dnnl_format_tag_any));
-
-        // dnnl_memory_desc_t biasInitDesc;
-        dnnl_memory_t biasMemory = nullptr;
-        const dnnl_memory_desc_t* biasMemoryDesc;
-        if (add) {
-            DAWN_ASSERT(add->Inputs().size() == 2);
-            OperandBase* biasOperand = nullptr;
-            if (conv2d == add->Inputs()[0].Get()) {
-                biasOperand = add->Inputs()[1].Get();
-            } else if (conv2d == add->Inputs()[1].Get()) {
-                biasOperand = add->Inputs()[0].Get();
-            } else {
-                dawn::ErrorLog() << "The add is not fusable.";
-                return dnnl_invalid_arguments;
+                                              outputDataType, dnnl_format_tag_any));
+
+        // The output scales requantize the int32 accumulators of the int8 conv2d, i.e.
+        // inputScale * filterScale[c] / outputScale for each output channel.
+        const Quantization& inputQuantization = inputOperand->GetQuantization();
+        const Quantization& filterQuantization = filterOperand->GetQuantization();
+        std::vector<float> outputScales;
+        float quantizedOutputScale = 1;
+        if (quantize != nullptr) {
+            quantizedOutputScale = quantize->PrimaryOutput()->GetQuantization().Scale(0);
+            for (size_t c = 0; c < filterQuantization.scales.size(); ++c) {
+                outputScales.push_back(inputQuantization.Scale(0) * filterQuantization.Scale(c) /
+                                       quantizedOutputScale);
             }
+        }
 
-            DAWN_ASSERT(mOperandMemoryMap.find(biasOperand) != mOperandMemoryMap.end());
-            biasMemory = mOperandMemoryMap.at(biasOperand);
+        dnnl_memory_t biasMemory = nullptr;
+        const dnnl_memory_desc_t* biasMemoryDesc = nullptr;
+        dnnl_memory_desc_t scaledBiasMemoryDesc;
+        if (options->bias != nullptr) {
+            DAWN_ASSERT(mOperandMemoryMap.find(options->bias) != mOperandMemoryMap.end());
+            biasMemory = mOperandMemoryMap.at(options->bias);
             DNNL_TRY(GetMemoryDesc(biasMemory, &biasMemoryDesc));
+            if (quantize != nullptr) {
+                scaledBiasMemoryDesc = WithDataType(*biasMemoryDesc, dnnl_f32);
+                biasMemoryDesc = &scaledBiasMemoryDesc;
+                DNNL_TRY(CreateQuantizedBias(options->bias, biasMemoryDesc,
+                                             inputQuantization.Scale(0), filterQuantization,
+                                             &biasMemory));
+            }
         }
 
-        dnnl_primitive_attr_t attr = nullptr;
-        dnnl_post_ops_t postops = nullptr;
-        if (clamp) {
-            float outputMin = -std::numeric_limits<float>::infinity();
-            float outputMax = +std::numeric_limits<float>::infinity();
-            if (add) {
-                if (add != clamp->Inputs()[0].Get()) {
-                    dawn::ErrorLog() << "The clamp is not fusable.";
-                    return dnnl_invalid_arguments;
+        // The post-ops are applied in order: the activation of the conv2d, the fused binary and
+        // the activation of the binary.
+        dnnl_post_ops_t postops;
+        DNNL_TRY(dnnl_post_ops_create(&postops));
+        DNNL_TRY(AppendQuantizedActivation(postops, options->activation, quantizedOutputScale));
+        // The memory that holds the other operand of a fused add before the conv2d accumulates
+        // into it, and the per-channel operand of a fused binary.
+        dnnl_memory_t summandMemory = nullptr;
+        const dnnl_memory_desc_t* summandMemoryDesc = nullptr;
+        bool inPlaceSum = false;
+        std::vector<dnnl_exec_arg_t> postOpArgs;
+        if (binary != nullptr) {
+            const OperandBase* output = conv2d->PrimaryOutput();
+            const OperandBase* other = binary->Inputs()[0].Get() == output
+                                           ? binary->Inputs()[1].Get()
+                                           : binary->Inputs()[0].Get();
+            DAWN_ASSERT(mOperandMemoryMap.find(other) != mOperandMemoryMap.end());
+            dnnl_memory_t otherMemory = mOperandMemoryMap.at(other);
+            const dnnl_memory_desc_t* otherMemoryDesc;
+            DNNL_TRY(GetMemoryDesc(otherMemory, &otherMemoryDesc));
+            if (other->Shape() == output->Shape()) {
+                DNNL_TRY(dnnl_post_ops_append_sum(postops, 1.0));
+                summandMemory = otherMemory;
+                summandMemoryDesc = otherMemoryDesc;
+                // The conv2d writes to the memory of the other operand if the binary is its only
+                // use, which saves the copy of the operand.
+                inPlaceSum = mConsumers.at(other).size() == 1 &&
+                             mConstantMemories.find(otherMemory) == mConstantMemories.end() &&
+                             mMemoryReinterprets.find(otherMemory) == mMemoryReinterprets.end();
+                for (auto& input : mInputMemoryMap) {
+                    inPlaceSum = inPlaceSum && input.second != otherMemory;
                 }
-            } else {
-                if (conv2d != clamp->Inputs()[0].Get()) {
-                    dawn::ErrorLog() << "The clamp is not fusable.";
-                    return dnnl_invalid_arguments;
+                for (auto& operand : mOperandMemoryMap) {
+                    inPlaceSum = inPlaceSum && (operand.first == other ||
+                                                operand.second != otherMemory);
                 }
+                for (auto& namedOutput : mOutputs) {
+                    inPlaceSum = inPlaceSum && namedOutput.second != other;
+                }
+                if (inPlaceSum) {
+                    outputInitDesc = *otherMemoryDesc;
+                }
+            } else {
+                // The operand has a single channel or one value per channel.
+                const std::vector<int32_t>& otherShape = other->Shape();
+                dnnl_dim_t channels = std::accumulate(otherShape.begin(), otherShape.end(), 1,
+                                                      std::multiplies<int32_t>());
+                std::vector<dnnl_dim_t> channelDims = {1, channels, 1, 1};
+                dnnl_memory_desc_t channelMemoryDesc;
+                DNNL_TRY(dnnl_memory_desc_reshape(&channelMemoryDesc, otherMemoryDesc,
+                                                  channelDims.size(), channelDims.data()));
+                dnnl_alg_kind_t algKind = binary->GetType() == op::BinaryOpType::kAdd
+                                              ? dnnl_binary_add
+                                              : dnnl_binary_mul;
+                DNNL_TRY(dnnl_post_ops_append_binary(postops, algKind, &channelMemoryDesc));
+                postOpArgs.push_back(
+                    {DNNL_ARG_ATTR_MULTIPLE_POST_OP(dnnl_post_ops_len(postops) - 1) |
+                         DNNL_ARG_SRC_1,
+                     otherMemory});
             }
-            const ClampOptions* options = clamp->GetOptions();
-            if (options->minValue != nullptr) {
-                DAWN_ASSERT(mOperandMemoryMap.find(options->minValue) != mOperandMemoryMap.end());
-                dnnl_memory_t minMemory = mOperandMemoryMap.at(options->minValue);
-                DNNL_TRY(ReadFromMemory(&outputMin, sizeof(outputMin), minMemory));
+            if (binary->GetActivation() != nullptr) {
+                DNNL_TRY(AppendActivation(postops, binary->GetActivation()));
             }
-            if (options->maxValue != nullptr) {
-                DAWN_ASSERT(mOperandMemoryMap.find(options->maxValue) != mOperandMemoryMap.end());
-                dnnl_memory_t maxMemory = mOperandMemoryMap.at(options->maxValue);
-                DNNL_TRY(ReadFromMemory(&outputMax, sizeof(outputMax), maxMemory));
+        }
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(CreatePostOpsAttr(postops, &attr));
+        DNNL_TRY(dnnl_post_ops_destroy(postops));
+        if (quantize != nullptr) {
+            if (attr == nullptr) {
+                DNNL_TRY(dnnl_primitive_attr_create(&attr));
             }
-            DNNL_TRY(dnnl_post_ops_create(&postops));
-            DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_clip, outputMin,
-                                                  outputMax));
-            DNNL_TRY(dnnl_primitive_attr_create(&attr));
-            DNNL_TRY(dnnl_primitive_attr_set_post_ops(attr, postops));
+            const int mask = outputScales.size() > 1 ? 1 << 1 : 0;
+            DNNL_TRY(dnnl_primitive_attr_set_output_scales(attr, outputScales.size(), mask,
+                                                           outputScales.data()));
+            DNNL_TRY(SetZeroPoints(attr, inputQuantization.ZeroPoint(0),
+                                   quantize->PrimaryOutput()->GetQuantization().ZeroPoint(0),
+                                   postOpArgs));
         }
 
         dnnl_convolution_desc_t convDesc;
         DNNL_TRY(dnnl_dilated_convolution_forward_desc_init(
             &convDesc, dnnl_forward, dnnl_convolution_direct, &inputInitDesc, &filterInitDesc,
-            add ? biasMemoryDesc : NULL, &outputInitDesc, strides.data(), dilates.data(),
-            padding_l.data(), padding_r.data()));
+            biasMemoryDesc, &outputInitDesc, strides.data(), dilates.data(), padding_l.data(),
+            padding_r.data()));
         dnnl_primitive_desc_t primitiveDesc;
-        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &convDesc, clamp ? attr : NULL,
-                                            GetEngine(), NULL));
-
+        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &convDesc, attr, GetEngine(), NULL));
         if (attr) {
             DNNL_TRY(dnnl_primitive_attr_destroy(attr));
         }
-        if (postops) {
-            DNNL_TRY(dnnl_post_ops_destroy(postops));
-        }
 
         const dnnl_memory_desc_t* inputInternalMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_src_md, 0);
@@ -807,8 +1498,25 @@ namespace webnn_native { namespace onednn {
         const dnnl_memory_desc_t* outputMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
         dnnl_memory_t outputMemory;
-        DNNL_TRY(
-            dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        if (inPlaceSum && dnnl_memory_desc_equal(outputMemoryDesc, summandMemoryDesc)) {
+            outputMemory = summandMemory;
+        } else {
+            DNNL_TRY(dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(),
+                                        DNNL_MEMORY_ALLOCATE));
+            mMemories.push_back(outputMemory);
+            if (summandMemory != nullptr) {
+                // Copy the other operand of the add to the output that the sum accumulates into.
+                dnnl_primitive_desc_t reorderDesc;
+                DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, summandMemoryDesc,
+                                                            GetEngine(), outputMemoryDesc,
+                                                            GetEngine(), NULL));
+                dnnl_primitive_t reorder;
+                DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
+                DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
+                mOperations.push_back(
+                    {reorder, {{DNNL_ARG_SRC, summandMemory}, {DNNL_ARG_DST, outputMemory}}});
+            }
+        }
 
         dnnl_primitive_t primitive;
         DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
@@ -816,53 +1524,45 @@ namespace webnn_native { namespace onednn {
         std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, inputInternalMemory},
                                              {DNNL_ARG_WEIGHTS, filterInternalMemory},
                                              {DNNL_ARG_DST, outputMemory}};
-        if (add) {
+        if (biasMemory != nullptr) {
             args.push_back({DNNL_ARG_BIAS, biasMemory});
         }
+        args.insert(args.end(), postOpArgs.begin(), postOpArgs.end());
         mOperations.push_back({primitive, args});
-        mMemories.push_back(outputMemory);
-
-        const OperandBase* output = clamp ? reinterpret_cast<const OperandBase*>(clamp)
-                                          : (add ? reinterpret_cast<const OperandBase*>(add)
-                                                 : reinterpret_cast<const OperandBase*>(conv2d));
 
+        const OperandBase* output = conv2d->PrimaryOutput();
+        if (binary != nullptr) {
+            output = binary->PrimaryOutput();
+        } else if (quantize != nullptr) {
+            output = quantize->PrimaryOutput();
+        }
+        mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
         if (options->inputLayout == ml::InputOperandLayout::Nhwc) {
-            // reorder the output from primitive query layout to nhwc
-            dnnl_memory_desc_t finalOutputMemoryDesc;
-            DNNL_TRY(dnnl_memory_desc_init_by_tag(&finalOutputMemoryDesc, outputDims.size(),
-                                                  outputDims.data(), dataType, dnnl_nhwc));
-            dnnl_memory_t finalOutputMemory;
-            DNNL_TRY(ReorderIfNeeded(outputMemoryDesc, outputMemory, &finalOutputMemoryDesc,
-                                     &finalOutputMemory));
-            mOperandMemoryMap.insert(std::make_pair(output, finalOutputMemory));
-
-            // transpose the output logical dims to nhwc
-            dnnl_memory_desc_t transposeOutputMemoryDesc;
-            std::vector<dnnl_dim_t> finalOutputDims(4);
-            finalOutputDims[0] = outputDims[0];
-            finalOutputDims[1] = outputDims[2];
-            finalOutputDims[2] = outputDims[3];
-            finalOutputDims[3] = outputDims[1];
-            DNNL_TRY(dnnl_memory_desc_init_by_tag(&transposeOutputMemoryDesc,
-                                                  finalOutputDims.size(), finalOutputDims.data(),
-                                                  dataType, dnnl_nchw));
-            mMemoryReinterprets.insert(
-                std::make_pair(finalOutputMemory, transposeOutputMemoryDesc));
-        } else {
-            mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
+            // Transpose the logical dimensions of the output to nhwc without reordering, the
+            // next conv2d reads the blocked format as is.
+            const int permute[] = {0, 3, 1, 2};
+            dnnl_memory_desc_t transposedOutputMemoryDesc;
+            DNNL_TRY(dnnl_memory_desc_permute_axes(&transposedOutputMemoryDesc, outputMemoryDesc,
+                                                   permute));
+            mMemoryReinterprets.insert(std::make_pair(outputMemory, transposedOutputMemoryDesc));
         }
 
         return dnnl_success;
     }
 
     MaybeError Graph::AddPool2d(const op::Pool2d* pool2d) {
-        mOperandsToBuild.push_back({POOL2D, pool2d});
+        mOperators.push_back(pool2d);
         return {};
     }
 
-    dnnl_status_t Graph::AddPool2dImpl(const op::Pool2d* pool2d) {
+    dnnl_status_t Graph::AddPool2dImpl(const op::Pool2d* pool2d,
+                                       const op::QuantizeLinear* quantize) {
         DAWN_ASSERT(pool2d->Inputs().size() == 1);
         const OperandBase* inputOperand = pool2d->Inputs()[0].Get();
+        if (quantize != nullptr) {
+            // The int8 pool2d reads the input before it's dequantized.
+            inputOperand = inputOperand->Operator()->Inputs()[0].Get();
+        }
         DAWN_ASSERT(mOperandMemoryMap.find(inputOperand) != mOperandMemoryMap.end());
         dnnl_memory_t inputMemory = mOperandMemoryMap.at(inputOperand);
         const dnnl_memory_desc_t* inputMemoryDesc;
@@ -913,9 +1613,13 @@ namespace webnn_native { namespace onednn {
         } else {
             return dnnl_invalid_arguments;
         }
+        // The int8 pooling is only implemented for the inference, which doesn't need the
+        // workspace of the max pooling.
+        const dnnl_prop_kind_t propKind =
+            quantize != nullptr ? dnnl_forward_inference : dnnl_forward;
         dnnl_pooling_v2_desc_t poolDesc;
         DNNL_TRY(dnnl_pooling_v2_forward_desc_init(
-            &poolDesc, dnnl_forward, poolType, inputMemoryDesc, &outputInitDesc, strides.data(),
+            &poolDesc, propKind, poolType, inputMemoryDesc, &outputInitDesc, strides.data(),
             kernel.data(), dilates.data(), padding_l.data(), padding_r.data()));
         dnnl_primitive_desc_t primitiveDesc;
         DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &poolDesc, NULL, GetEngine(), NULL));
@@ -928,7 +1632,7 @@ namespace webnn_native { namespace onednn {
         DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
         std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, inputMemory},
                                              {DNNL_ARG_DST, outputMemory}};
-        if (poolType == dnnl_pooling_max) {
+        if (poolType == dnnl_pooling_max && propKind == dnnl_forward) {
             const dnnl_memory_desc_t* workspaceMemoryDesc =
                 dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_workspace_md, 0);
             dnnl_memory_t workspaceMemory;
@@ -940,12 +1644,14 @@ namespace webnn_native { namespace onednn {
         DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         mOperations.push_back({primitive, args});
         mMemories.push_back(outputMemory);
-        mOperandMemoryMap.insert(std::make_pair(pool2d, outputMemory));
+        const OperandBase* output = quantize != nullptr ? quantize->PrimaryOutput()
+                                                        : pool2d->PrimaryOutput();
+        mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
         return dnnl_success;
     }
 
     MaybeError Graph::AddUnary(const op::Unary* unary) {
-        mOperandsToBuild.push_back({OperandType::UNARY, unary});
+        mOperators.push_back(unary);
         return {};
     }
 
@@ -959,20 +1665,22 @@ namespace webnn_native { namespace onednn {
         dnnl_primitive_desc_t primitiveDesc;
         dnnl_primitive_t primitive;
         dnnl_memory_t outputMemory;
-        if (unary->GetType() == op::UnaryOpType::kRelu) {
-            dnnl_eltwise_desc_t eltWiseDesc;
-            DNNL_TRY(dnnl_eltwise_forward_desc_init(&eltWiseDesc, dnnl_forward, dnnl_eltwise_relu,
-                                                    inputMemoryDesc, 0, 0));
-            DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &eltWiseDesc, nullptr, GetEngine(),
-                                                nullptr));
-        } else if (unary->GetType() == op::UnaryOpType::kSoftmax) {
+        if (unary->GetType() == op::UnaryOpType::kSoftmax) {
             dnnl_softmax_desc_t softmaxDesc;
             DNNL_TRY(
                 dnnl_softmax_forward_desc_init(&softmaxDesc, dnnl_forward, inputMemoryDesc, 1));
             DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &softmaxDesc, nullptr, GetEngine(),
                                                 nullptr));
         } else {
-            return dnnl_unimplemented;
+            dnnl_alg_kind_t algKind;
+            float alpha;
+            float beta;
+            DNNL_TRY(GetEltwiseAlgorithm(unary, algKind, alpha, beta));
+            dnnl_eltwise_desc_t eltWiseDesc;
+            DNNL_TRY(dnnl_eltwise_forward_desc_init(&eltWiseDesc, dnnl_forward, algKind,
+                                                    inputMemoryDesc, alpha, beta));
+            DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &eltWiseDesc, nullptr, GetEngine(),
+                                                nullptr));
         }
         const dnnl_memory_desc_t* outputMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
@@ -983,24 +1691,62 @@ namespace webnn_native { namespace onednn {
         mOperations.push_back(
             {primitive, {{DNNL_ARG_SRC, inputMemory}, {DNNL_ARG_DST, outputMemory}}});
         mMemories.push_back(outputMemory);
-        mOperandMemoryMap.insert(std::make_pair(unary, outputMemory));
+        mOperandMemoryMap.insert(std::make_pair(unary->PrimaryOutput(), outputMemory));
         return dnnl_success;
     }
 
     MaybeError Graph::AddClamp(const op::Clamp* clamp) {
-        mOperandsToBuild.push_back({OperandType::CLAMP, clamp});
+        mOperators.push_back(clamp);
         return {};
     }
 
-    dnnl_status_t Graph::AddClampImpl(const op::Clamp* clamp) {
+    dnnl_status_t Graph::AddClampImpl(const op::Clamp* clamp, const op::QuantizeLinear* quantize) {
         auto inputsOperand = clamp->Inputs();
         DAWN_ASSERT(inputsOperand.size() == 1 || inputsOperand.size() == 2 ||
                     inputsOperand.size() == 3);
         const OperandBase* inputOperand = inputsOperand[0].Get();
+        float minValue = clamp->GetMinValue();
+        float maxValue = clamp->GetMaxValue();
+        dnnl_prop_kind_t propKind = dnnl_forward;
+        if (quantize != nullptr) {
+            // The int8 clamp reads the input before it's dequantized and clips the quantized
+            // values by the quantized bounds, the integer eltwise is only implemented for the
+            // inference.
+            inputOperand = inputOperand->Operator()->Inputs()[0].Get();
+            const Quantization& quantization = inputOperand->GetQuantization();
+            minValue = minValue / quantization.Scale(0) + quantization.ZeroPoint(0);
+            maxValue = maxValue / quantization.Scale(0) + quantization.ZeroPoint(0);
+            propKind = dnnl_forward_inference;
+        }
         DAWN_ASSERT(mOperandMemoryMap.find(inputOperand) != mOperandMemoryMap.end());
         dnnl_memory_t inputMemory = mOperandMemoryMap.at(inputOperand);
         const dnnl_memory_desc_t* inputMemoryDesc;
         DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
+        if (clamp->IsClampByValue()) {
+            // The clip primitive reads the input in any format, e.g. the blocked output of a
+            // conv2d, rather than broadcasting the bounds by the binary primitives.
+            dnnl_eltwise_desc_t eltWiseDesc;
+            DNNL_TRY(dnnl_eltwise_forward_desc_init(&eltWiseDesc, propKind, dnnl_eltwise_clip,
+                                                    inputMemoryDesc, minValue, maxValue));
+            dnnl_primitive_desc_t primitiveDesc;
+            DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &eltWiseDesc, nullptr, GetEngine(),
+                                                nullptr));
+            const dnnl_memory_desc_t* outputMemoryDesc =
+                dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
+            dnnl_memory_t outputMemory;
+            DNNL_TRY(dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(),
+                                        DNNL_MEMORY_ALLOCATE));
+            dnnl_primitive_t primitive;
+            DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
+            DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
+            mOperations.push_back(
+                {primitive, {{DNNL_ARG_SRC, inputMemory}, {DNNL_ARG_DST, outputMemory}}});
+            mMemories.push_back(outputMemory);
+            const OperandBase* output = quantize != nullptr ? quantize->PrimaryOutput()
+                                                            : clamp->PrimaryOutput();
+            mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
+            return dnnl_success;
+        }
         std::vector<dnnl_dim_t> inputDims(inputMemoryDesc->dims,
                                           inputMemoryDesc->dims + inputMemoryDesc->ndims);
 
@@ -1115,17 +1861,490 @@ namespace webnn_native { namespace onednn {
             outDims = tempDims;
             outMemoryDesc = tempMemoryDesc;
         }
-        mOperandMemoryMap.insert(std::make_pair(clamp, outMemory));
+        mOperandMemoryMap.insert(std::make_pair(clamp->PrimaryOutput(), outMemory));
+
+        return dnnl_success;
+    }
+
+    MaybeError Graph::AddConcat(const op::Concat* concat) {
+        mOperators.push_back(concat);
+        return {};
+    }
+
+    dnnl_status_t Graph::AddConcatImpl(const op::Concat* concat,
+                                       const op::QuantizeLinear* quantize) {
+        // The concat primitive reads the inputs in their own formats and picks the format of
+        // the output.
+        std::vector<dnnl_memory_desc_t> inputMemoryDescs;
+        std::vector<dnnl_exec_arg_t> args;
+        for (size_t i = 0; i < concat->Inputs().size(); ++i) {
+            const OperandBase* inputOperand = concat->Inputs()[i].Get();
+            if (quantize != nullptr) {
+                // The int8 concat reads the inputs before they are dequantized.
+                inputOperand = inputOperand->Operator()->Inputs()[0].Get();
+            }
+            DAWN_ASSERT(mOperandMemoryMap.find(inputOperand) != mOperandMemoryMap.end());
+            dnnl_memory_t inputMemory = mOperandMemoryMap.at(inputOperand);
+            const dnnl_memory_desc_t* inputMemoryDesc;
+            DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
+            inputMemoryDescs.push_back(*inputMemoryDesc);
+            args.push_back({static_cast<int>(DNNL_ARG_MULTIPLE_SRC + i), inputMemory});
+        }
+        dnnl_primitive_desc_t primitiveDesc;
+        DNNL_TRY(dnnl_concat_primitive_desc_create(
+            &primitiveDesc, nullptr, inputMemoryDescs.size(), concat->GetAxis(),
+            inputMemoryDescs.data(), nullptr, GetEngine()));
+        const dnnl_memory_desc_t* outputMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
+        dnnl_memory_t outputMemory;
+        DNNL_TRY(
+            dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        dnnl_primitive_t primitive;
+        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
+        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
+        args.push_back({DNNL_ARG_DST, outputMemory});
+        mOperations.push_back({primitive, args});
+        mMemories.push_back(outputMemory);
+        const OperandBase* output = quantize != nullptr ? quantize->PrimaryOutput()
+                                                        : concat->PrimaryOutput();
+        mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
+        return dnnl_success;
+    }
+
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        mOperators.push_back(gemm);
+        return {};
+    }
+
+    dnnl_status_t Graph::AddGemmImpl(const op::Gemm* gemm, const op::QuantizeLinear* quantize) {
+        auto inputs = gemm->Inputs();
+        const GemmOptions* options = gemm->GetOptions();
+        // The c operand is added as the bias of the matmul primitive, which is scaled together
+        // with the product by the output scale.
+        if (inputs.size() == 3 && (options->alpha != 1.0f || options->beta != 1.0f)) {
+            dawn::ErrorLog() << "oneDNN doesn't support the scaled c operand of gemm.";
+            return dnnl_unimplemented;
+        }
+        const OperandBase* aOperand = inputs[0].Get();
+        const OperandBase* bOperand = inputs[1].Get();
+        if (quantize != nullptr) {
+            // The int8 gemm reads the operands before they are dequantized.
+            aOperand = aOperand->Operator()->Inputs()[0].Get();
+            bOperand = bOperand->Operator()->Inputs()[0].Get();
+        }
+        dnnl_memory_t aMemory = mOperandMemoryMap.at(aOperand);
+        const dnnl_memory_desc_t* aMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(aMemory, &aMemoryDesc));
+        dnnl_memory_t bMemory = mOperandMemoryMap.at(bOperand);
+        const dnnl_memory_desc_t* bMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(bMemory, &bMemoryDesc));
+        // The transposes are applied to the logical dimensions without moving the data.
+        const int transpose[] = {1, 0};
+        dnnl_memory_desc_t aTransposedMemoryDesc;
+        if (options->aTranspose) {
+            DNNL_TRY(dnnl_memory_desc_permute_axes(&aTransposedMemoryDesc, aMemoryDesc, transpose));
+            aMemoryDesc = &aTransposedMemoryDesc;
+        }
+        dnnl_memory_desc_t bTransposedMemoryDesc;
+        if (options->bTranspose) {
+            DNNL_TRY(dnnl_memory_desc_permute_axes(&bTransposedMemoryDesc, bMemoryDesc, transpose));
+            bMemoryDesc = &bTransposedMemoryDesc;
+        }
+        // The int8 gemm reads the u8 or s8 a and the s8 b and writes the type of the quantized
+        // output.
+        dnnl_data_type_t dataType = aMemoryDesc->data_type;
+        dnnl_data_type_t bDataType = quantize != nullptr ? dnnl_s8 : dataType;
+        dnnl_data_type_t cDataType = dataType;
+        if (quantize != nullptr) {
+            DNNL_TRY(GetDnnlDataType(quantize->PrimaryOutput()->Type(), cDataType));
+        }
+        std::vector<dnnl_dim_t> aDims(aMemoryDesc->dims, aMemoryDesc->dims + aMemoryDesc->ndims);
+        std::vector<dnnl_dim_t> bDims(bMemoryDesc->dims, bMemoryDesc->dims + bMemoryDesc->ndims);
+        std::vector<dnnl_dim_t> cDims = {aDims[0], bDims[1]};
+
+        // The output scales requantize the int32 accumulators of the int8 gemm, i.e.
+        // alpha * aScale * bScale[n] / outputScale for each column.
+        const Quantization& aQuantization = aOperand->GetQuantization();
+        const Quantization& bQuantization = bOperand->GetQuantization();
+        std::vector<float> outputScales = {options->alpha};
+        float quantizedOutputScale = 1;
+        if (quantize != nullptr) {
+            quantizedOutputScale = quantize->PrimaryOutput()->GetQuantization().Scale(0);
+            outputScales.resize(bQuantization.scales.size());
+            for (size_t n = 0; n < outputScales.size(); ++n) {
+                outputScales[n] = options->alpha * aQuantization.Scale(0) * bQuantization.Scale(n) /
+                                  quantizedOutputScale;
+            }
+        }
+
+        dnnl_memory_t biasMemory = nullptr;
+        const dnnl_memory_desc_t* biasMemoryDesc = nullptr;
+        dnnl_memory_desc_t biasReshapedMemoryDesc;
+        dnnl_memory_desc_t scaledBiasMemoryDesc;
+        if (inputs.size() == 3) {
+            biasMemory = mOperandMemoryMap.at(inputs[2].Get());
+            DNNL_TRY(GetMemoryDesc(biasMemory, &biasMemoryDesc));
+            std::vector<dnnl_dim_t> biasDims(biasMemoryDesc->dims,
+                                             biasMemoryDesc->dims + biasMemoryDesc->ndims);
+            if (biasDims.size() < 2) {
+                biasDims = ExpandDimensions(biasDims, 2);
+                DNNL_TRY(dnnl_memory_desc_reshape(&biasReshapedMemoryDesc, biasMemoryDesc,
+                                                  biasDims.size(), biasDims.data()));
+                biasMemoryDesc = &biasReshapedMemoryDesc;
+            }
+            if (quantize != nullptr) {
+                scaledBiasMemoryDesc = WithDataType(*biasMemoryDesc, dnnl_f32);
+                biasMemoryDesc = &scaledBiasMemoryDesc;
+                DNNL_TRY(CreateQuantizedBias(inputs[2].Get(), biasMemoryDesc,
+                                             aQuantization.Scale(0), bQuantization, &biasMemory));
+            }
+        }
+
+        dnnl_memory_desc_t aInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&aInitDesc, aDims.size(), aDims.data(), dataType,
+                                              dnnl_format_tag_any));
+        dnnl_memory_desc_t bInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&bInitDesc, bDims.size(), bDims.data(), bDataType,
+                                              dnnl_format_tag_any));
+        dnnl_memory_desc_t cInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&cInitDesc, cDims.size(), cDims.data(), cDataType,
+                                              dnnl_format_tag_any));
+        dnnl_matmul_desc_t matmulDesc;
+        DNNL_TRY(
+            dnnl_matmul_desc_init(&matmulDesc, &aInitDesc, &bInitDesc, biasMemoryDesc, &cInitDesc));
+
+        dnnl_post_ops_t postops;
+        DNNL_TRY(dnnl_post_ops_create(&postops));
+        DNNL_TRY(AppendQuantizedActivation(postops, gemm->GetActivation(), quantizedOutputScale));
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(CreatePostOpsAttr(postops, &attr));
+        DNNL_TRY(dnnl_post_ops_destroy(postops));
+        std::vector<dnnl_exec_arg_t> zeroPointArgs;
+        if (quantize != nullptr || options->alpha != 1.0f) {
+            if (attr == nullptr) {
+                DNNL_TRY(dnnl_primitive_attr_create(&attr));
+            }
+            const int mask = outputScales.size() > 1 ? 1 << 1 : 0;
+            DNNL_TRY(dnnl_primitive_attr_set_output_scales(attr, outputScales.size(), mask,
+                                                           outputScales.data()));
+        }
+        if (quantize != nullptr) {
+            DNNL_TRY(SetZeroPoints(attr, aQuantization.ZeroPoint(0),
+                                   quantize->PrimaryOutput()->GetQuantization().ZeroPoint(0),
+                                   zeroPointArgs));
+        }
+        dnnl_primitive_desc_t primitiveDesc;
+        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &matmulDesc, attr, GetEngine(), NULL));
+        if (attr) {
+            DNNL_TRY(dnnl_primitive_attr_destroy(attr));
+        }
+        const dnnl_memory_desc_t* aInternalMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_src_md, 0);
+        DNNL_TRY(ReorderIfNeeded(aMemoryDesc, aMemory, aInternalMemoryDesc, &aMemory));
+        const dnnl_memory_desc_t* bInternalMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_weights_md, 0);
+        DNNL_TRY(ReorderIfNeeded(bMemoryDesc, bMemory, bInternalMemoryDesc, &bMemory));
+        const dnnl_memory_desc_t* cMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
+        dnnl_memory_t cMemory;
+        DNNL_TRY(dnnl_memory_create(&cMemory, cMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        dnnl_primitive_t primitive;
+        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
+        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
+        std::vector<dnnl_exec_arg_t> args = {
+            {DNNL_ARG_SRC, aMemory}, {DNNL_ARG_WEIGHTS, bMemory}, {DNNL_ARG_DST, cMemory}};
+        if (biasMemory != nullptr) {
+            args.push_back({DNNL_ARG_BIAS, biasMemory});
+        }
+        args.insert(args.end(), zeroPointArgs.begin(), zeroPointArgs.end());
+        mOperations.push_back({primitive, args});
+        mMemories.push_back(cMemory);
+        const OperandBase* output = quantize != nullptr ? quantize->PrimaryOutput()
+                                                        : gemm->PrimaryOutput();
+        mOperandMemoryMap.insert(std::make_pair(output, cMemory));
+        return dnnl_success;
+    }
+
+    MaybeError Graph::AddReshape(const op::Reshape* reshape) {
+        mOperators.push_back(reshape);
+        return {};
+    }
+
+    dnnl_status_t Graph::AddReshapeImpl(const op::Reshape* reshape) {
+        dnnl_memory_t inputMemory = mOperandMemoryMap.at(reshape->Inputs()[0].Get());
+        const dnnl_memory_desc_t* inputMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
+        // The input is reordered to a memory of the plain format, e.g. from the blocked output of
+        // a pool2d before gemm, whose descriptor is then reinterpreted to the new shape. The
+        // input memory isn't reinterpreted in place because it may be read by other operators.
+        std::vector<int32_t> inputShape(inputMemoryDesc->dims,
+                                        inputMemoryDesc->dims + inputMemoryDesc->ndims);
+        std::vector<dnnl_dim_t> plainDims;
+        dnnl_format_tag_t tag;
+        DNNL_TRY(GetDnnlDimsAndFormartTag(inputShape.data(), inputShape.size(), plainDims, tag));
+        dnnl_memory_desc_t plainMemoryDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&plainMemoryDesc, plainDims.size(), plainDims.data(),
+                                              inputMemoryDesc->data_type, tag));
+        dnnl_memory_t outputMemory;
+        DNNL_TRY(Reorder(inputMemoryDesc, inputMemory, &plainMemoryDesc, &outputMemory));
+
+        const std::vector<int32_t>& outputShape = reshape->PrimaryOutput()->Shape();
+        std::vector<dnnl_dim_t> outputDims;
+        DNNL_TRY(GetDnnlDimsAndFormartTag(outputShape.data(), outputShape.size(), outputDims, tag));
+        dnnl_memory_desc_t outputMemoryDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputMemoryDesc, outputDims.size(),
+                                              outputDims.data(), inputMemoryDesc->data_type, tag));
+        mMemoryReinterprets.insert(std::make_pair(outputMemory, outputMemoryDesc));
+        mOperandMemoryMap.insert(std::make_pair(reshape->PrimaryOutput(), outputMemory));
+        return dnnl_success;
+    }
+
+    MaybeError Graph::AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear) {
+        mOperators.push_back(quantizeLinear);
+        return {};
+    }
+
+    dnnl_status_t Graph::AddQuantizeLinearImpl(const op::QuantizeLinear* quantizeLinear) {
+        const OperandBase* output = quantizeLinear->PrimaryOutput();
+        return AddQuantizationReorder(quantizeLinear->Inputs()[0].Get(), output,
+                                      output->GetQuantization(), false);
+    }
+
+    MaybeError Graph::AddDequantizeLinear(const op::DequantizeLinear* dequantizeLinear) {
+        mOperators.push_back(dequantizeLinear);
+        return {};
+    }
+
+    dnnl_status_t Graph::AddDequantizeLinearImpl(const op::DequantizeLinear* dequantizeLinear) {
+        const OperandBase* input = dequantizeLinear->Inputs()[0].Get();
+        const OperandBase* output = dequantizeLinear->PrimaryOutput();
+        // The dequantize is skipped if it's only read by the int8 operators, which read its input
+        // instead.
+        bool skipped = mConsumers.find(output) != mConsumers.end();
+        for (auto& namedOutput : mOutputs) {
+            skipped = skipped && namedOutput.second != output;
+        }
+        if (skipped) {
+            for (auto op : mConsumers.at(output)) {
+                skipped = skipped && GetFusableQuantize(op) != nullptr;
+            }
+        }
+        if (skipped) {
+            return dnnl_success;
+        }
+        return AddQuantizationReorder(input, output, input->GetQuantization(), true);
+    }
 
+    dnnl_status_t Graph::AddQuantizationReorder(const OperandBase* input,
+                                                const OperandBase* output,
+                                                const Quantization& quantization,
+                                                bool dequantize) {
+        DAWN_ASSERT(mOperandMemoryMap.find(input) != mOperandMemoryMap.end());
+        dnnl_memory_t inputMemory = mOperandMemoryMap.at(input);
+        const dnnl_memory_desc_t* inputMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
+        // The reorder only takes a common zero point.
+        const size_t channels = quantization.scales.size();
+        for (size_t c = 1; c < channels; ++c) {
+            if (quantization.ZeroPoint(c) != quantization.ZeroPoint(0)) {
+                return dnnl_unimplemented;
+            }
+        }
+        // The reorder computes dst = scale * (src - srcZeroPoint) + dstZeroPoint, the scales
+        // of the quantization are inverted to quantize.
+        std::vector<float> scales(channels);
+        for (size_t c = 0; c < channels; ++c) {
+            scales[c] = dequantize ? quantization.Scale(c) : 1.0f / quantization.Scale(c);
+        }
+        const int mask = quantization.IsPerChannel() ? 1 << quantization.axis : 0;
+        const int32_t zeroPoint = quantization.ZeroPoint(0);
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(dnnl_primitive_attr_create(&attr));
+        DNNL_TRY(dnnl_primitive_attr_set_output_scales(attr, scales.size(), mask, scales.data()));
+        if (zeroPoint != 0) {
+            DNNL_TRY(dnnl_primitive_attr_set_zero_points(
+                attr, dequantize ? DNNL_ARG_SRC : DNNL_ARG_DST, 1, 0, &zeroPoint));
+        }
+
+        // The output is in the plain format.
+        std::vector<int32_t> dimensions(inputMemoryDesc->dims,
+                                        inputMemoryDesc->dims + inputMemoryDesc->ndims);
+        std::vector<dnnl_dim_t> dims;
+        dnnl_format_tag_t tag;
+        DNNL_TRY(GetDnnlDimsAndFormartTag(dimensions.data(), dimensions.size(), dims, tag));
+        // The dequantized output is in the compute type.
+        dnnl_data_type_t dataType = GetComputeDataType();
+        if (!dequantize) {
+            DNNL_TRY(GetDnnlDataType(output->Type(), dataType));
+        }
+        dnnl_memory_desc_t outputMemoryDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputMemoryDesc, dims.size(), dims.data(),
+                                              dataType, tag));
+        dnnl_memory_t outputMemory;
+        DNNL_TRY(dnnl_memory_create(&outputMemory, &outputMemoryDesc, GetEngine(),
+                                    DNNL_MEMORY_ALLOCATE));
+        mMemories.push_back(outputMemory);
+        dnnl_primitive_desc_t reorderDesc;
+        DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, inputMemoryDesc, GetEngine(),
+                                                    &outputMemoryDesc, GetEngine(), attr));
+        DNNL_TRY(dnnl_primitive_attr_destroy(attr));
+        dnnl_primitive_t reorder;
+        DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
+        DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
+        mOperations.push_back(
+            {reorder, {{DNNL_ARG_SRC, inputMemory}, {DNNL_ARG_DST, outputMemory}}});
+        mOperandMemoryMap.insert(std::make_pair(output, outputMemory));
+        return dnnl_success;
+    }
+
+    dnnl_status_t Graph::CreateQuantizedBias(const OperandBase* bias,
+                                             const dnnl_memory_desc_t* biasMemoryDesc,
+                                             float inputScale,
+                                             const Quantization& weightsQuantization,
+                                             dnnl_memory_t* biasMemory) {
+        // The bias is added to the accumulators before they are requantized, so it's divided by
+        // the scales of the input and the weights. The scaled bias stays in f32 whatever the
+        // compute type is.
+        auto constant = static_cast<const op::Constant*>(bias->Operator());
+        const float* values = static_cast<const float*>(constant->GetBuffer());
+        std::vector<float> scaledBias(SizeOfShape(bias->Shape()));
+        for (size_t c = 0; c < scaledBias.size(); ++c) {
+            scaledBias[c] = values[c] / (inputScale * weightsQuantization.Scale(c));
+        }
+        DNNL_TRY(dnnl_memory_create(biasMemory, biasMemoryDesc, GetEngine(),
+                                    DNNL_MEMORY_ALLOCATE));
+        mMemories.push_back(*biasMemory);
+        mConstantMemories.insert(*biasMemory);
+        DNNL_TRY(WriteToMemory(scaledBias.data(), scaledBias.size() * sizeof(float), *biasMemory));
+        return dnnl_success;
+    }
+
+    dnnl_status_t Graph::SetZeroPoints(dnnl_primitive_attr_t attr,
+                                       int32_t inputZeroPoint,
+                                       int32_t outputZeroPoint,
+                                       std::vector<dnnl_exec_arg_t>& args) {
+        // The zero points of the input and the output are passed at execution.
+        const std::vector<std::pair<int, int32_t>> zeroPoints = {{DNNL_ARG_SRC, inputZeroPoint},
+                                                                 {DNNL_ARG_DST, outputZeroPoint}};
+        for (auto& zeroPoint : zeroPoints) {
+            if (zeroPoint.second == 0) {
+                continue;
+            }
+            const int32_t runtimeZeroPoint = DNNL_RUNTIME_S32_VAL;
+            DNNL_TRY(dnnl_primitive_attr_set_zero_points(attr, zeroPoint.first, 1, 0,
+                                                         &runtimeZeroPoint));
+            const dnnl_dim_t dims[] = {1};
+            dnnl_memory_desc_t zeroPointMemoryDesc;
+            DNNL_TRY(dnnl_memory_desc_init_by_tag(&zeroPointMemoryDesc, 1, dims, dnnl_s32,
+                                                  dnnl_a));
+            dnnl_memory_t zeroPointMemory;
+            DNNL_TRY(dnnl_memory_create(&zeroPointMemory, &zeroPointMemoryDesc, GetEngine(),
+                                        DNNL_MEMORY_ALLOCATE));
+            mMemories.push_back(zeroPointMemory);
+            mConstantMemories.insert(zeroPointMemory);
+            DNNL_TRY(WriteToMemory(&zeroPoint.second, sizeof(int32_t), zeroPointMemory));
+            args.push_back({DNNL_ARG_ATTR_ZERO_POINTS | zeroPoint.first, zeroPointMemory});
+        }
         return dnnl_success;
     }
 
     MaybeError Graph::Finish() {
+        for (auto op : mOperators) {
+            for (auto& input : op->Inputs()) {
+                mConsumers[input.Get()].push_back(op);
+            }
+        }
+        // The int8 operators are found before lowering so that the dequantizes that are only
+        // read by them are skipped.
+        for (auto op : mOperators) {
+            const op::QuantizeLinear* quantize = GetFusableQuantize(op);
+            if (quantize != nullptr) {
+                mQuantizedOperators.insert(std::make_pair(quantize, op));
+            }
+        }
+        for (auto op : mOperators) {
+            DAWN_TRY(AddOperatorImpl(op));
+        }
+        for (auto& output : mOutputs) {
+            DAWN_ASSERT(mOperandMemoryMap.find(output.second) != mOperandMemoryMap.end());
+            // The output is converted back from the compute type to the type of the operand.
+            dnnl_data_type_t dataType;
+            DAWN_TRY(GetDnnlDataType(output.second->Type(), dataType));
+            dnnl_memory_t plainOutputMemory;
+            DAWN_TRY(ReorderToPlainFormat(mOperandMemoryMap.at(output.second), dataType,
+                                          &plainOutputMemory));
+            mOutputMemoryMap.insert(std::make_pair(output.first, plainOutputMemory));
+        }
+
+        // Copy the constants that are read by the primitives as is, e.g. the biases, the
+        // filters are only read by the reorders to the packed formats and aren't kept. The
+        // constants reinterpreted as the compute type are converted by the copy.
+        std::map<dnnl_memory_t, dnnl_memory_t> copies;
+        auto copyConstant = [&](dnnl_memory_t& memory) -> dnnl_status_t {
+            auto constant = mConstantOperators.find(memory);
+            if (constant == mConstantOperators.end()) {
+                return dnnl_success;
+            }
+            auto copy = copies.find(memory);
+            if (copy == copies.end()) {
+                const dnnl_memory_desc_t* desc;
+                DNNL_TRY(dnnl_memory_get_memory_desc(memory, &desc));
+                const dnnl_memory_desc_t* computeDesc;
+                DNNL_TRY(GetMemoryDesc(memory, &computeDesc));
+                dnnl_memory_t copyMemory;
+                if (computeDesc->data_type != desc->data_type) {
+                    DNNL_TRY(ExecuteReorder(GetEngine(), desc, memory, computeDesc, &copyMemory));
+                } else {
+                    DNNL_TRY(dnnl_memory_create(&copyMemory, desc, GetEngine(),
+                                                DNNL_MEMORY_ALLOCATE));
+                    DNNL_TRY(WriteToMemory(constant->second->GetBuffer(),
+                                           constant->second->GetByteLength(), copyMemory));
+                    auto reinterpret = mMemoryReinterprets.find(memory);
+                    if (reinterpret != mMemoryReinterprets.end()) {
+                        mMemoryReinterprets.insert(
+                            std::make_pair(copyMemory, reinterpret->second));
+                    }
+                }
+                mMemories.push_back(copyMemory);
+                mConstantMemories.insert(copyMemory);
+                copy = copies.insert(std::make_pair(memory, copyMemory)).first;
+            }
+            memory = copy->second;
+            return dnnl_success;
+        };
+        for (auto& op : mOperations) {
+            for (auto& arg : op.args) {
+                DAWN_TRY(copyConstant(arg.memory));
+            }
+        }
+        for (auto& output : mOutputMemoryMap) {
+            DAWN_TRY(copyConstant(output.second));
+        }
+        mConstantOperators.clear();
+        mOperandMemoryMap.clear();
+        mOperators.clear();
+        mConsumers.clear();
+        mFusedBinaries.clear();
+        mQuantizedOperators.clear();
         return {};
     }
 
     MaybeError Graph::CompileImpl() {
         DAWN_TRY(dnnl_stream_create(&mStream, GetEngine(), dnnl_stream_default_flags));
+        std::set<dnnl_memory_t> boundMemories(mConstantMemories);
+        for (auto& input : mInputMemoryMap) {
+            boundMemories.insert(input.second);
+        }
+        for (auto& output : mOutputMemoryMap) {
+            if (!boundMemories.insert(output.second).second) {
+                continue;
+            }
+            const dnnl_memory_desc_t* outputMemoryDesc;
+            DAWN_TRY(GetMemoryDesc(output.second, &outputMemoryDesc));
+            std::vector<int8_t>& buffer = mOutputBuffers[output.first];
+            buffer.resize(dnnl_memory_desc_get_size(outputMemoryDesc));
+            DAWN_TRY(dnnl_memory_set_data_handle_v2(output.second, buffer.data(), mStream));
+        }
         return {};
     }
 
@@ -1139,31 +2358,40 @@ namespace webnn_native { namespace onednn {
                                                mStream));
         }
 
-        for (auto op : mOperations) {
+        for (auto& output : outputs->GetRecords()) {
+            if (mOutputMemoryMap.find(output.first) == mOutputMemoryMap.end()) {
+                dawn::ErrorLog() << "The output " << output.first << " isn't found.";
+                return MLComputeGraphStatus_Error;
+            }
+        }
+        // The primitives write the outputs to the user buffers directly, including the reorders
+        // from the blocked formats.
+        for (auto& output : mOutputBuffers) {
+            const ArrayBufferView* record = outputs->Get(output.first.c_str());
+            void* buffer = record != nullptr
+                               ? static_cast<int8_t*>(record->buffer) + record->byteOffset
+                               : static_cast<void*>(output.second.data());
+            COMPUTE_TRY(dnnl_memory_set_data_handle_v2(mOutputMemoryMap.at(output.first), buffer,
+                                                       mStream));
+        }
+
+        for (auto& op : mOperations) {
             COMPUTE_TRY(
                 dnnl_primitive_execute(op.primitive, mStream, op.args.size(), op.args.data()));
         }
 
         COMPUTE_TRY(dnnl_stream_wait(mStream));
 
-        std::vector<std::string> outputNames;
         for (auto& output : outputs->GetRecords()) {
-            outputNames.push_back(output.first);
-        }
-
-        for (size_t i = 0; i < outputNames.size(); ++i) {
-            std::string outputName = outputNames[i];
-            dnnl_memory_t outputMemory = mOutputMemoryMap.at(outputName);
+            if (mOutputBuffers.find(output.first) != mOutputBuffers.end()) {
+                continue;
+            }
+            dnnl_memory_t outputMemory = mOutputMemoryMap.at(output.first);
             const dnnl_memory_desc_t* outputMemoryDesc;
             COMPUTE_TRY(GetMemoryDesc(outputMemory, &outputMemoryDesc));
-            size_t bufferLength = dnnl_memory_desc_get_size(outputMemoryDesc);
-            void* outputBuffer = malloc(bufferLength);
-            COMPUTE_TRY(ReadFromMemory(outputBuffer, bufferLength, outputMemory));
-            const ArrayBufferView* output = outputs->GetRecords().at(outputName);
-            if (output->byteLength >= bufferLength) {
-                memcpy(static_cast<int8_t*>(output->buffer) + output->byteOffset, outputBuffer,
-                       bufferLength);
-            }
+            COMPUTE_TRY(ReadFromMemory(static_cast<int8_t*>(output.second->buffer) +
+                                           output.second->byteOffset,
+                                       dnnl_memory_desc_get_size(outputMemoryDesc), outputMemory));
         }
         return MLComputeGraphStatus_Success;
     }
@@ -1172,6 +2400,10 @@ namespace webnn_native { namespace onednn {
         return reinterpret_cast<Context*>(GetContext())->GetEngine();
     }
 
+    dnnl_data_type_t Graph::GetComputeDataType() {
+        return reinterpret_cast<Context*>(GetContext())->GetComputeDataType();
+    }
+
     dnnl_status_t Graph::GetMemoryDesc(dnnl_memory_t memory, const dnnl_memory_desc_t** desc) {
         if (mMemoryReinterprets.find(memory) != mMemoryReinterprets.end()) {
             *desc = &mMemoryReinterprets.at(memory);
@@ -1181,42 +2413,74 @@ namespace webnn_native { namespace onednn {
         return dnnl_success;
     }
 
+    dnnl_status_t Graph::Reorder(const dnnl_memory_desc_t* srcDesc,
+                                 dnnl_memory_t srcMem,
+                                 const dnnl_memory_desc_t* dstDesc,
+                                 dnnl_memory_t* dstMem) {
+        auto constant = mConstantOperators.find(srcMem);
+        if (constant != mConstantOperators.end()) {
+            // The constant is reordered once into the format requested by the primitive and
+            // shared with the other graphs that are built from the same data. The constant
+            // reinterpreted as the compute type is converted from the type of its buffer.
+            const dnnl_memory_desc_t* bufferDesc;
+            DNNL_TRY(dnnl_memory_get_memory_desc(srcMem, &bufferDesc));
+            const dnnl_memory_desc_t plainDesc = WithDataType(*srcDesc, bufferDesc->data_type);
+            const void* buffer = constant->second->GetBuffer();
+            size_t byteLength = constant->second->GetByteLength();
+            PackedConstantKey key = {byteLength, Fingerprint(buffer, byteLength), plainDesc,
+                                     *dstDesc};
+            auto pack = [&](dnnl_memory_t* packedMem) -> dnnl_status_t {
+                dnnl_memory_t plainMem;
+                DNNL_TRY(dnnl_memory_create(&plainMem, &plainDesc, GetEngine(),
+                                            const_cast<void*>(buffer)));
+                dnnl_status_t status =
+                    ExecuteReorder(GetEngine(), &plainDesc, plainMem, dstDesc, packedMem);
+                dnnl_memory_destroy(plainMem);
+                return status;
+            };
+            DNNL_TRY(reinterpret_cast<Context*>(GetContext())
+                         ->AcquirePackedConstant(key, pack, dstMem));
+            mPackedConstants.push_back(*dstMem);
+            mConstantMemories.insert(*dstMem);
+            return dnnl_success;
+        }
+
+        if (mConstantMemories.find(srcMem) != mConstantMemories.end()) {
+            // E.g. a packed constant that is reordered again.
+            DNNL_TRY(ExecuteReorder(GetEngine(), srcDesc, srcMem, dstDesc, dstMem));
+            mMemories.push_back(*dstMem);
+            mConstantMemories.insert(*dstMem);
+            return dnnl_success;
+        }
+        DNNL_TRY(dnnl_memory_create(dstMem, dstDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        mMemories.push_back(*dstMem);
+        dnnl_primitive_desc_t reorderDesc;
+        DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, srcDesc, GetEngine(), dstDesc,
+                                                    GetEngine(), NULL));
+        dnnl_primitive_t reorder;
+        DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
+        DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
+        mOperations.push_back({reorder, {{DNNL_ARG_SRC, srcMem}, {DNNL_ARG_DST, *dstMem}}});
+        return dnnl_success;
+    }
+
     dnnl_status_t Graph::ReorderIfNeeded(const dnnl_memory_desc_t* srcDesc,
                                          dnnl_memory_t srcMem,
                                          const dnnl_memory_desc_t* dstDesc,
                                          dnnl_memory_t* userDstMem) {
+        dnnl_memory_t dstMem = srcMem;
         if (!dnnl_memory_desc_equal(srcDesc, dstDesc)) {
-            dnnl_memory_t dstMem;
-            DNNL_TRY(dnnl_memory_create(&dstMem, dstDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-            dnnl_primitive_desc_t reorderDesc;
-            DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, srcDesc, GetEngine(), dstDesc,
-                                                        GetEngine(), NULL));
-            dnnl_primitive_t reorder;
-            DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
-            DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
-            std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, srcMem}, {DNNL_ARG_DST, dstMem}};
-            if (mConstantMemories.find(srcMem) != mConstantMemories.end()) {
-                dnnl_stream_t stream;
-                DNNL_TRY(dnnl_stream_create(&stream, GetEngine(), dnnl_stream_default_flags));
-
-                DNNL_TRY(dnnl_primitive_execute(reorder, stream, args.size(), args.data()));
-                DNNL_TRY(dnnl_primitive_destroy(reorder));
-            } else {
-                mOperations.push_back({reorder, args});
-            }
-            mMemories.push_back(dstMem);
-            if (userDstMem != nullptr) {
-                *userDstMem = dstMem;
-            }
-        } else {
-            if (userDstMem != nullptr) {
-                *userDstMem = srcMem;
-            }
+            DNNL_TRY(Reorder(srcDesc, srcMem, dstDesc, &dstMem));
+        }
+        if (userDstMem != nullptr) {
+            *userDstMem = dstMem;
         }
         return dnnl_success;
     }
 
-    dnnl_status_t Graph::ReorderToPlainFormat(dnnl_memory_t srcMem, dnnl_memory_t* dstMem) {
+    dnnl_status_t Graph::ReorderToPlainFormat(dnnl_memory_t srcMem,
+                                              dnnl_data_type_t dataType,
+                                              dnnl_memory_t* dstMem) {
         const dnnl_memory_desc_t* srcDesc;
         DNNL_TRY(GetMemoryDesc(srcMem, &srcDesc));
         std::vector<int32_t> dimensions(srcDesc->dims, srcDesc->dims + srcDesc->ndims);
@@ -1224,8 +2488,8 @@ namespace webnn_native { namespace onednn {
         dnnl_format_tag_t tag;
         DNNL_TRY(GetDnnlDimsAndFormartTag(dimensions.data(), dimensions.size(), dims, tag));
         dnnl_memory_desc_t plainDesc;
-        DNNL_TRY(dnnl_memory_desc_init_by_tag(&plainDesc, dims.size(), dims.data(),
-                                              srcDesc->data_type, tag));
+        DNNL_TRY(
+            dnnl_memory_desc_init_by_tag(&plainDesc, dims.size(), dims.data(), dataType, tag));
         DNNL_TRY(ReorderIfNeeded(srcDesc, srcMem, &plainDesc, dstMem));
         return dnnl_success;
     }
@@ -17,6 +17,9 @@
 
 #include <map>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <dnnl.h>
 
@@ -25,10 +28,14 @@
 #include "webnn_native/onednn/ContextDNNL.h"
 #include "webnn_native/ops/Binary.h"
 #include "webnn_native/ops/Clamp.h"
+#include "webnn_native/ops/Concat.h"
 #include "webnn_native/ops/Constant.h"
 #include "webnn_native/ops/Conv2d.h"
+#include "webnn_native/ops/Gemm.h"
 #include "webnn_native/ops/Input.h"
+#include "webnn_native/ops/LeakyRelu.h"
 #include "webnn_native/ops/Pool2d.h"
+#include "webnn_native/ops/Quantize.h"
 #include "webnn_native/ops/Reshape.h"
 #include "webnn_native/ops/Transpose.h"
 #include "webnn_native/ops/Unary.h"
@@ -40,6 +47,10 @@ namespace webnn_native { namespace onednn {
         explicit Graph(Context* context);
         ~Graph() override;
 
+        // Whether the operator is lowered to the primitives, which mirrors the cases that the
+        // lowering rejects so that the partitioner leaves them to the other backends.
+        static bool SupportsOperator(const OperatorBase* op);
+
         virtual MaybeError AddConstant(const op::Constant* constant) override;
         virtual MaybeError AddInput(const op::Input* input) override;
         virtual MaybeError AddOutput(const std::string& name, const OperandBase* output) override;
@@ -48,44 +59,123 @@ namespace webnn_native { namespace onednn {
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
         virtual MaybeError AddUnary(const op::Unary* unary) override;
         virtual MaybeError AddClamp(const op::Clamp* clamp) override;
+        virtual MaybeError AddConcat(const op::Concat* concat) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
+        virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear) override;
+        virtual MaybeError AddDequantizeLinear(
+            const op::DequantizeLinear* dequantizeLinear) override;
         virtual MaybeError Finish() override;
 
       private:
+        // The operators are lowered to the primitives in the topological order when the graph
+        // is finished, the primitives create their outputs in the formats they prefer so that
+        // the blocked formats flow between them. The reorders are only inserted when a primitive
+        // doesn't accept the format of its input, e.g. for the graph inputs, and to the plain
+        // format for the graph outputs.
+        dnnl_status_t AddOperatorImpl(const OperatorBase* op);
+        // The binary that is fused into the conv2d as a post-op, i.e. the only use of the conv2d
+        // output is an elementwise add of another operand of the same shape, which is fused as
+        // a sum, or an add or mul of a per-channel constant. The conv2d is lowered in place of
+        // the binary so that the other operand is computed before.
+        const op::Binary* GetFusableBinary(const op::Conv2d* conv2d) const;
+        // The quantize that is the only use of the output of |op|, unless it's a named output.
+        const op::QuantizeLinear* GetOnlyQuantize(const OperatorBase* op) const;
+        // The quantize that is the only use of a conv2d, a gemm or an add of the dequantized
+        // operands. The operator is lowered to an int8 primitive in place of the quantize, which
+        // reads the quantized operands and requantizes the result to the output by the scales.
+        // The pool2d, the clamp and the concat don't rescale the values, so their operands must
+        // be quantized as the output.
+        const op::QuantizeLinear* GetFusableQuantize(const OperatorBase* op) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Conv2d* conv2d) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Gemm* gemm) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Binary* binary) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Pool2d* pool2d) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Clamp* clamp) const;
+        const op::QuantizeLinear* GetFusableQuantize(const op::Concat* concat) const;
         dnnl_status_t AddConv2dImpl(const op::Conv2d* conv2d,
-                                    const op::Binary* add = nullptr,
-                                    const op::Clamp* clamp = nullptr);
+                                    const op::Binary* binary = nullptr,
+                                    const op::QuantizeLinear* quantize = nullptr);
         dnnl_status_t AddBinaryImpl(const op::Binary* binary);
-        dnnl_status_t AddClampImpl(const op::Clamp* clamp);
-        dnnl_status_t AddPool2dImpl(const op::Pool2d* pool2d);
+        dnnl_status_t AddQuantizedAddImpl(const op::Binary* binary,
+                                          const op::QuantizeLinear* quantize);
+        dnnl_status_t AddClampImpl(const op::Clamp* clamp,
+                                   const op::QuantizeLinear* quantize = nullptr);
+        dnnl_status_t AddConcatImpl(const op::Concat* concat,
+                                    const op::QuantizeLinear* quantize = nullptr);
+        dnnl_status_t AddGemmImpl(const op::Gemm* gemm,
+                                  const op::QuantizeLinear* quantize = nullptr);
+        dnnl_status_t AddPool2dImpl(const op::Pool2d* pool2d,
+                                    const op::QuantizeLinear* quantize = nullptr);
+        dnnl_status_t AddReshapeImpl(const op::Reshape* reshape);
         dnnl_status_t AddUnaryImpl(const op::Unary* unary);
-
-        dnnl_status_t BuildPrimitives();
+        dnnl_status_t AddQuantizeLinearImpl(const op::QuantizeLinear* quantizeLinear);
+        dnnl_status_t AddDequantizeLinearImpl(const op::DequantizeLinear* dequantizeLinear);
+        // Convert between float32 and the quantized type by a reorder with the scales and the
+        // zero point of |quantization|.
+        dnnl_status_t AddQuantizationReorder(const OperandBase* input,
+                                             const OperandBase* output,
+                                             const Quantization& quantization,
+                                             bool dequantize);
+        // Create the f32 memory of the float constant |bias| divided by the scales of the input
+        // and the weights, which is added to the int32 accumulators of an int8 primitive.
+        dnnl_status_t CreateQuantizedBias(const OperandBase* bias,
+                                          const dnnl_memory_desc_t* biasMemoryDesc,
+                                          float inputScale,
+                                          const Quantization& weightsQuantization,
+                                          dnnl_memory_t* biasMemory);
+        // Set the nonzero zero points of the input and the output of an int8 primitive, the
+        // memories that hold them are appended to |args|.
+        dnnl_status_t SetZeroPoints(dnnl_primitive_attr_t attr,
+                                    int32_t inputZeroPoint,
+                                    int32_t outputZeroPoint,
+                                    std::vector<dnnl_exec_arg_t>& args);
 
         MaybeError CompileImpl() override;
         MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
                                          NamedOutputsBase* outputs) override;
         dnnl_engine_t GetEngine();
+        dnnl_data_type_t GetComputeDataType();
         dnnl_status_t GetMemoryDesc(dnnl_memory_t memory, const dnnl_memory_desc_t** desc);
+        dnnl_status_t Reorder(const dnnl_memory_desc_t* srcDesc,
+                              dnnl_memory_t srcMem,
+                              const dnnl_memory_desc_t* dstDesc,
+                              dnnl_memory_t* dstMem);
         dnnl_status_t ReorderIfNeeded(const dnnl_memory_desc_t* srcDesc,
                                       dnnl_memory_t srcMem,
                                       const dnnl_memory_desc_t* dstDesc,
                                       dnnl_memory_t* dstMem);
-        dnnl_status_t ReorderToPlainFormat(dnnl_memory_t srcMem, dnnl_memory_t* dstMem);
+        // Reorder to the plain format of |dataType|, e.g. the type of a graph output.
+        dnnl_status_t ReorderToPlainFormat(dnnl_memory_t srcMem,
+                                           dnnl_data_type_t dataType,
+                                           dnnl_memory_t* dstMem);
 
         std::vector<dnnl_memory_t> mMemories;
         std::set<dnnl_memory_t> mConstantMemories;
+        // The memories of the constants reference the constant buffers while building, the
+        // constants that are reordered are packed into the context, the others are copied when
+        // the graph is finished. The float constants of another type than the compute type are
+        // reinterpreted as the compute type and converted when they are packed or copied.
+        std::map<dnnl_memory_t, const op::Constant*> mConstantOperators;
+        std::vector<dnnl_memory_t> mPackedConstants;
         std::map<dnnl_memory_t, dnnl_memory_desc_t> mMemoryReinterprets;
         std::map<const OperandBase*, dnnl_memory_t> mOperandMemoryMap;
         std::map<std::string, dnnl_memory_t> mInputMemoryMap;
         std::map<std::string, dnnl_memory_t> mOutputMemoryMap;
-
-        enum OperandType { BINARY, CLAMP, CONV2D, POOL2D, UNARY };
-        struct OperandInfo {
-            OperandType opType;
-            const OperandBase* op;
-        };
-        // For op fusion
-        std::vector<OperandInfo> mOperandsToBuild;
+        // The outputs that are bound to the user buffers at compute, the buffers here are bound
+        // instead when the outputs are not requested. The other outputs, e.g. the one that
+        // shares the memory with an input or another output, are read after computing.
+        std::map<std::string, std::vector<int8_t>> mOutputBuffers;
+
+        // The operators and the named outputs that are lowered when the graph is finished, and
+        // the operators that use each operand.
+        std::vector<const OperatorBase*> mOperators;
+        std::vector<std::pair<std::string, const OperandBase*>> mOutputs;
+        std::map<const OperandBase*, std::vector<const OperatorBase*>> mConsumers;
+        // The binaries fused into the conv2d operators that are lowered in their place.
+        std::map<const op::Binary*, const op::Conv2d*> mFusedBinaries;
+        // The int8 operators that are lowered in place of the quantize of their outputs.
+        std::map<const op::QuantizeLinear*, const OperatorBase*> mQuantizedOperators;
 
         typedef struct {
             dnnl_primitive_t primitive;
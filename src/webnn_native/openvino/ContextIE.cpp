@@ -25,9 +25,29 @@ namespace webnn_native { namespace ie {
     }
 
     Context::Context(ContextOptions const* options) : ContextBase(options) {
+        // The activations are appended to the ngraph function, they are fused by the graph
+        // compiler of the Inference Engine.
+        for (auto type : {OperatorType::BatchNorm, OperatorType::Binary, OperatorType::Conv2d,
+                          OperatorType::Gemm}) {
+            mFusionRegistry.Register(type, {FusedOperator::Clamp, FusedOperator::HardSwish,
+                                            FusedOperator::LeakyRelu, FusedOperator::Relu,
+                                            FusedOperator::Sigmoid});
+        }
         IEStatusCode status = ie_core_create("", &mInferEngineCore);
         if (status != IEStatusCode::OK) {
             dawn::ErrorLog() << "Failed to create inference engine core.";
+            return;
+        }
+        // The core caches the compiled networks in the directory, keyed by a hash of the
+        // network, the weights, the device and the config, so that loading the same network
+        // again imports it instead of compiling it.
+        const char* cacheDirectory = GetContextOptions().cacheDirectory;
+        if (cacheDirectory != nullptr && cacheDirectory[0] != '\0') {
+            ie_config_t config = {"CACHE_DIR", cacheDirectory, NULL};
+            status = ie_core_set_config(mInferEngineCore, &config, NULL);
+            if (status != IEStatusCode::OK) {
+                dawn::ErrorLog() << "Failed to set the cache directory of inference engine core.";
+            }
         }
     }
 
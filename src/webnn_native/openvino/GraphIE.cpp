@@ -15,6 +15,8 @@
 #include "webnn_native/openvino/GraphIE.h"
 
 #include <algorithm>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "common/Assert.h"
@@ -134,12 +136,12 @@ namespace webnn_native { namespace ie {
                 return status;
             }
             switch (activation->GetFusedOperator()) {
-                // Workaround(mingming): Currently we implement Relu6 operator by clamp. For
-                // case OperatorType::Clamp, we added a clamp node in GraphBuilder
-                // directly to ensure that we can find the min and max operands from the graph.
-                case FusedOperator::Clamp:
-                    *activationNode = const_cast<ngraph_node_t*>(inputNode);
+                case FusedOperator::Clamp: {
+                    auto clamp = static_cast<const op::Clamp*>(activation);
+                    status = ngraph_clamp(inputNode, clamp->GetMinValue(), clamp->GetMaxValue(),
+                                          activationNode);
                     break;
+                }
                 case FusedOperator::Relu:
                     status = ngraph_relu(inputNode, activationNode);
                     break;
@@ -147,7 +149,7 @@ namespace webnn_native { namespace ie {
                     status = ngraph_sigmoid(inputNode, activationNode);
                     break;
                 case FusedOperator::LeakyRelu: {
-                    auto leakyRelu = reinterpret_cast<const op::LeakyRelu*>(activation);
+                    auto leakyRelu = static_cast<const op::LeakyRelu*>(activation);
                     const ngraph_node_t* constantNode = AddConstantWithGraph<float>(
                         precision_e::FP32, {1}, {leakyRelu->GetAlpha()});
                     status = ngraph_leaky_relu(inputNode, constantNode, activationNode);
@@ -238,20 +240,68 @@ namespace webnn_native { namespace ie {
             }
             return status;
         }
+
+        // Translate the performance options of the context into the plugin config keys, the
+        // unset options keep the defaults of the plugin.
+        std::map<std::string, std::string> GetPluginConfig(const ContextOptions& options,
+                                                           bool useGpu) {
+            std::map<std::string, std::string> config;
+            const std::string prefix = useGpu ? "GPU" : "CPU";
+            if (options.numStreams != 0) {
+                config[prefix + "_THROUGHPUT_STREAMS"] = std::to_string(options.numStreams);
+            } else if (options.performanceHint == ml::PerformanceHint::Throughput) {
+                config[prefix + "_THROUGHPUT_STREAMS"] = prefix + "_THROUGHPUT_AUTO";
+            } else if (options.performanceHint == ml::PerformanceHint::Latency) {
+                config[prefix + "_THROUGHPUT_STREAMS"] = "1";
+            }
+            // The threads and their binding only apply to the CPU plugin.
+            if (useGpu) {
+                return config;
+            }
+            if (options.numThreads != 0) {
+                config["CPU_THREADS_NUM"] = std::to_string(options.numThreads);
+            }
+            switch (options.threadBinding) {
+                case ml::ThreadBinding::None:
+                    config["CPU_BIND_THREAD"] = "NO";
+                    break;
+                case ml::ThreadBinding::Cores:
+                    config["CPU_BIND_THREAD"] = "YES";
+                    break;
+                case ml::ThreadBinding::Numa:
+                    config["CPU_BIND_THREAD"] = "NUMA";
+                    break;
+                default:
+                    break;
+            }
+            return config;
+        }
     }  // namespace
 
     Graph::Graph(Context* context)
-        : GraphBase(context), mInferEngineNetwork(nullptr), mInferEngineRequest(nullptr) {
+        : GraphBase(context),
+          mInferEngineNetwork(nullptr),
+          mInferEngineExecutableNetwork(nullptr),
+          mMaxInferRequests(1) {
         mInferEngineCore = context->InferenceEngineCore();
     }
 
     Graph::~Graph() {
+        {
+            // Wait for the asynchronous computes in flight.
+            std::unique_lock<std::mutex> lock(mInferMutex);
+            mInferCondition.wait(
+                lock, [this] { return mFreeInferRequests.size() == mInferRequests.size(); });
+        }
+        for (auto& inferRequest : mInferRequests) {
+            FreeInferRequest(inferRequest.get());
+        }
+        if (mInferEngineExecutableNetwork) {
+            ie_exec_network_free(&mInferEngineExecutableNetwork);
+        }
         if (mInferEngineNetwork) {
             ie_network_free(&mInferEngineNetwork);
         }
-        if (mInferEngineRequest) {
-            ie_infer_request_free(&mInferEngineRequest);
-        }
         for (auto node : mGraphNodeMap) {
             ngraph_node_free(const_cast<ngraph_node_t**>(&node.second));
         }
@@ -469,7 +519,10 @@ namespace webnn_native { namespace ie {
                 DAWN_ASSERT(0);
         }
         DAWN_TRY(CheckStatusCode(status, "ngraph add binary"));
-        mGraphNodeMap[binary->PrimaryOutput()] = binaryNode;
+        ngraph_node_t* activationNode;
+        status = AddActivationNode(binaryNode, binary->GetActivation(), &activationNode);
+        DAWN_TRY(CheckStatusCode(status, "ngraph activation"));
+        mGraphNodeMap[binary->PrimaryOutput()] = activationNode;
         return {};
     }
 
@@ -918,7 +971,10 @@ namespace webnn_native { namespace ie {
             status = ngraph_add(gemmNode, betaNode, &gemmNode);
             DAWN_TRY(CheckStatusCode(status, "ngraph add"));
         }
-        mGraphNodeMap[gemm->PrimaryOutput()] = gemmNode;
+        ngraph_node_t* activationNode;
+        status = AddActivationNode(gemmNode, gemm->GetActivation(), &activationNode);
+        DAWN_TRY(CheckStatusCode(status, "ngraph activation"));
+        mGraphNodeMap[gemm->PrimaryOutput()] = activationNode;
         return {};
     }
 
@@ -952,88 +1008,333 @@ namespace webnn_native { namespace ie {
     }
 
     MaybeError Graph::CompileImpl() {
-        ml::DevicePreference devicePreference = GetContext()->GetContextOptions().devicePreference;
-        const char* deviceName = devicePreference == ml::DevicePreference::Gpu ? "GPU" : "CPU";
+        ContextOptions options = GetContext()->GetContextOptions();
+        bool useGpu = options.devicePreference == ml::DevicePreference::Gpu;
+        const char* deviceName = useGpu ? "GPU" : "CPU";
 
-        ie_config_t config = {NULL, NULL, NULL};
-        ie_executable_network_t* executableNetwork;
+        // The config is a linked list terminated by an empty entry.
+        std::map<std::string, std::string> pluginConfig = GetPluginConfig(options, useGpu);
+        std::vector<ie_config_t> config(pluginConfig.size() + 1, {NULL, NULL, NULL});
+        size_t index = 0;
+        for (auto& entry : pluginConfig) {
+            config[index] = {entry.first.c_str(), entry.second.c_str(), &config[index + 1]};
+            ++index;
+        }
         IEStatusCode status = ie_core_load_network(mInferEngineCore, mInferEngineNetwork,
-                                                   deviceName, &config, &executableNetwork);
+                                                   deviceName, config.data(),
+                                                   &mInferEngineExecutableNetwork);
         DAWN_TRY(CheckStatusCode(status, "IE load network"));
-        status = ie_exec_network_create_infer_request(executableNetwork, &mInferEngineRequest);
+
+        // Resolve the blob names once so that the concurrent computes only read them.
+        for (auto& input : mInputIdMap) {
+            char* inputName = nullptr;
+            status = ie_network_get_input_name(mInferEngineNetwork, input.second, &inputName);
+            DAWN_TRY(CheckStatusCode(status, "IE get input name"));
+            mInputBlobNames[input.first] = inputName;
+            ie_network_name_free(&inputName);
+        }
+        for (auto& output : mOutputNameMap) {
+            auto originalIndex = mOriginalNameMap.find(output.second);
+            if (originalIndex == mOriginalNameMap.end()) {
+                continue;
+            }
+            char* sinkingName = nullptr;
+            status = ie_network_get_output_name(mInferEngineNetwork, originalIndex->second,
+                                                &sinkingName);
+            DAWN_TRY(CheckStatusCode(status, "IE get output name"));
+            mOutputBlobNames[output.first] = sinkingName;
+            ie_network_name_free(&sinkingName);
+        }
+
+        // The pool is limited by the context options or by the optimal number of the device.
+        mMaxInferRequests = GetContext()->GetContextOptions().maxConcurrentComputes;
+        if (mMaxInferRequests == 0) {
+            ie_param_t param;
+            status = ie_exec_network_get_metric(mInferEngineExecutableNetwork,
+                                                "OPTIMAL_NUMBER_OF_INFER_REQUESTS", &param);
+            mMaxInferRequests = status == IEStatusCode::OK ? std::max(param.number, 1u) : 1;
+        }
+        // Create the first request at compile time to report the errors early.
+        DAWN_TRY(CreateInferRequest());
+        mFreeInferRequests.push_back(mInferRequests.back().get());
+        return {};
+    }
+
+    MaybeError Graph::CreateInferRequest() {
+        std::unique_ptr<InferRequest> inferRequest(new InferRequest());
+        inferRequest->graph = this;
+        IEStatusCode status = ie_exec_network_create_infer_request(mInferEngineExecutableNetwork,
+                                                                   &inferRequest->request);
         DAWN_TRY(CheckStatusCode(status, "IE create infer request"));
-        ie_exec_network_free(&executableNetwork);
+        MaybeError maybeError = InitializeInferRequest(inferRequest.get());
+        if (maybeError.IsError()) {
+            FreeInferRequest(inferRequest.get());
+            return maybeError;
+        }
+        mInferRequests.push_back(std::move(inferRequest));
         return {};
     }
 
-    MLComputeGraphStatus Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
-        auto namedInputs = inputs->GetRecords();
-        for (auto& input : mInputIdMap) {
+    MaybeError Graph::InitializeInferRequest(InferRequest* inferRequest) {
+        inferRequest->completionCallback = {OnInferCompleted, inferRequest};
+        IEStatusCode status = ie_infer_set_completion_callback(inferRequest->request,
+                                                               &inferRequest->completionCallback);
+        DAWN_TRY(CheckStatusCode(status, "IE set completion callback"));
+        for (auto blobNames : {&mInputBlobNames, &mOutputBlobNames}) {
+            for (auto& blobName : *blobNames) {
+                ie_blob_t* blob;
+                status = ie_infer_request_get_blob(inferRequest->request, blobName.second.c_str(),
+                                                   &blob);
+                DAWN_TRY(CheckStatusCode(status, "IE get blob"));
+                inferRequest->blobs[blobName.second] = blob;
+            }
+        }
+        return {};
+    }
+
+    void Graph::FreeInferRequest(InferRequest* inferRequest) {
+        for (auto& blob : inferRequest->blobs) {
+            ie_blob_free(&blob.second);
+        }
+        ie_infer_request_free(&inferRequest->request);
+    }
+
+    Graph::InferRequest* Graph::AcquireInferRequest() {
+        std::unique_lock<std::mutex> lock(mInferMutex);
+        mInferCondition.wait(lock, [this] {
+            return !mFreeInferRequests.empty() || mInferRequests.size() < mMaxInferRequests;
+        });
+        if (!mFreeInferRequests.empty()) {
+            InferRequest* inferRequest = mFreeInferRequests.back();
+            mFreeInferRequests.pop_back();
+            return inferRequest;
+        }
+        // Grow the pool on demand. The error is logged instead of being consumed by the context,
+        // whose error scopes aren't guarded against the concurrent computes.
+        MaybeError maybeError = CreateInferRequest();
+        if (maybeError.IsError()) {
+            dawn::ErrorLog() << maybeError.AcquireError()->GetMessage();
+            return nullptr;
+        }
+        return mInferRequests.back().get();
+    }
+
+    void Graph::ReleaseInferRequest(InferRequest* inferRequest) {
+        UnbindBuffers(inferRequest);
+        {
+            std::lock_guard<std::mutex> lock(mInferMutex);
+            mFreeInferRequests.push_back(inferRequest);
+        }
+        mInferCondition.notify_all();
+    }
+
+    bool Graph::BindBuffer(InferRequest* inferRequest,
+                           const std::string& blobName,
+                           const ArrayBufferView& view) {
+        ie_blob_t* blob = inferRequest->blobs.at(blobName);
+        int byteSize;
+        if (ie_blob_byte_size(blob, &byteSize) != IEStatusCode::OK ||
+            view.byteLength != static_cast<size_t>(byteSize)) {
+            return false;
+        }
+        tensor_desc_t tensorDesc;
+        if (ie_blob_get_dims(blob, &tensorDesc.dims) != IEStatusCode::OK ||
+            ie_blob_get_layout(blob, &tensorDesc.layout) != IEStatusCode::OK ||
+            ie_blob_get_precision(blob, &tensorDesc.precision) != IEStatusCode::OK) {
+            return false;
+        }
+        // The plugin reads the elements in place, so the buffer must be aligned to the size of
+        // the element.
+        size_t elementCount = 1;
+        for (size_t i = 0; i < tensorDesc.dims.ranks; ++i) {
+            elementCount *= tensorDesc.dims.dims[i];
+        }
+        void* buffer = static_cast<int8_t*>(view.buffer) + view.byteOffset;
+        if (elementCount == 0 ||
+            reinterpret_cast<uintptr_t>(buffer) % (view.byteLength / elementCount) != 0) {
+            return false;
+        }
+        ie_blob_t* userBlob;
+        if (ie_blob_make_memory_from_preallocated(&tensorDesc, buffer, view.byteLength,
+                                                  &userBlob) != IEStatusCode::OK) {
+            return false;
+        }
+        if (ie_infer_request_set_blob(inferRequest->request, blobName.c_str(), userBlob) !=
+            IEStatusCode::OK) {
+            ie_blob_free(&userBlob);
+            return false;
+        }
+        inferRequest->userBlobs[blobName] = userBlob;
+        return true;
+    }
+
+    void Graph::UnbindBuffers(InferRequest* inferRequest) {
+        // Restore the blobs of the request so that the user buffers aren't referenced after the
+        // compute.
+        for (auto& userBlob : inferRequest->userBlobs) {
+            ie_infer_request_set_blob(inferRequest->request, userBlob.first.c_str(),
+                                      inferRequest->blobs.at(userBlob.first));
+            ie_blob_free(&userBlob.second);
+        }
+        inferRequest->userBlobs.clear();
+    }
+
+    MLComputeGraphStatus Graph::SetInputs(InferRequest* inferRequest, NamedInputsBase* inputs) {
+        auto& namedInputs = inputs->GetRecords();
+        for (auto& input : mInputBlobNames) {
             // All the inputs must be set.
             if (namedInputs.find(input.first) == namedInputs.end()) {
                 dawn::ErrorLog() << "The input isn't set";
                 return MLComputeGraphStatus_Error;
             }
-            ie_blob_t* blob;
-            char* inputName = nullptr;
-            IEStatusCode status =
-                ie_network_get_input_name(mInferEngineNetwork, input.second, &inputName);
+            auto& resource = namedInputs.at(input.first)->resource;
+            if (BindBuffer(inferRequest, input.second, resource)) {
+                continue;
+            }
+            // Fall back to copy the input into the blob of the request.
+            ie_blob_buffer_t buffer;
+            IEStatusCode status = ie_blob_get_buffer(inferRequest->blobs.at(input.second), &buffer);
             if (status != IEStatusCode::OK) {
-                dawn::ErrorLog() << "IE Failed to ie_network_get_input_name";
+                dawn::ErrorLog() << "IE Failed to ie_blob_get_buffer";
                 return MLComputeGraphStatus_Error;
             }
-            status = ie_infer_request_get_blob(mInferEngineRequest, inputName, &blob);
+            int byteSize;
+            status = ie_blob_byte_size(inferRequest->blobs.at(input.second), &byteSize);
             if (status != IEStatusCode::OK) {
-                dawn::ErrorLog() << "IE Failed to ie_infer_request_get_blob";
+                dawn::ErrorLog() << "IE Failed to ie_blob_byte_size";
                 return MLComputeGraphStatus_Error;
             }
-            ie_blob_buffer_t buffer;
-            status = ie_blob_get_buffer(blob, &buffer);
-            if (status != IEStatusCode::OK) {
-                dawn::ErrorLog() << "IE Failed to ie_blob_get_buffer";
+            if (resource.byteLength != static_cast<size_t>(byteSize)) {
+                dawn::ErrorLog() << "The size of input " << input.first
+                                 << " differs from the size of the blob";
                 return MLComputeGraphStatus_Error;
             }
-            auto& resource = namedInputs[input.first]->resource;
             memcpy(buffer.buffer, static_cast<int8_t*>(resource.buffer) + resource.byteOffset,
-                   resource.byteLength);
+                   byteSize);
         }
+        return MLComputeGraphStatus_Success;
+    }
 
-        // Compute the compiled model.
-        IEStatusCode code = ie_infer_request_infer(mInferEngineRequest);
-        if (code != IEStatusCode::OK) {
-            dawn::ErrorLog() << "IE Failed to compute model";
-            return MLComputeGraphStatus_Error;
+    MLComputeGraphStatus Graph::SetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs) {
+        for (auto namedOutput : outputs->GetRecords()) {
+            auto outputBlobName = mOutputBlobNames.find(namedOutput.first);
+            if (outputBlobName == mOutputBlobNames.end()) {
+                dawn::ErrorLog() << "IE Failed to compute model";
+                return MLComputeGraphStatus_Error;
+            }
+            // The output that isn't bound is copied by GetOutputs.
+            BindBuffer(inferRequest, outputBlobName->second, *namedOutput.second);
         }
+        return MLComputeGraphStatus_Success;
+    }
 
+    MLComputeGraphStatus Graph::GetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs) {
         // Get Data from nGraph with output.
         for (auto namedOutput : outputs->GetRecords()) {
             const ArrayBufferView* output = namedOutput.second;
             DAWN_ASSERT(output->buffer != nullptr && output->byteLength != 0);
-            // Get output id with friendly name.
-            auto originalName = mOutputNameMap[namedOutput.first];
-            if (mOriginalNameMap.find(originalName) == mOriginalNameMap.end()) {
-                dawn::ErrorLog() << "IE Failed to compute model";
-                return MLComputeGraphStatus_Error;
+            const std::string& outputBlobName = mOutputBlobNames.at(namedOutput.first);
+            if (inferRequest->userBlobs.find(outputBlobName) != inferRequest->userBlobs.end()) {
+                // The output has been written in place.
+                continue;
             }
-            char* sinkingName;
-            IEStatusCode status = ie_network_get_output_name(
-                mInferEngineNetwork, mOriginalNameMap[originalName], &sinkingName);
-            ie_blob_t* outputBlob;
-            status = ie_infer_request_get_blob(mInferEngineRequest, sinkingName, &outputBlob);
+            ie_blob_t* outputBlob = inferRequest->blobs.at(outputBlobName);
+            ie_blob_buffer_t outputBuffer;
+            IEStatusCode status = ie_blob_get_cbuffer(outputBlob, &outputBuffer);
             if (status != IEStatusCode::OK) {
-                dawn::ErrorLog() << "IE Failed to ie_infer_request_get_blob";
+                dawn::ErrorLog() << "IE Failed to ie_blob_get_cbuffer";
                 return MLComputeGraphStatus_Error;
             }
-            ie_blob_buffer_t outputBuffer;
-            status = ie_blob_get_cbuffer(outputBlob, &outputBuffer);
             int bufferLength;
             status = ie_blob_byte_size(outputBlob, &bufferLength);
-            if (output->byteLength >= static_cast<size_t>(bufferLength)) {
-                memcpy(static_cast<int8_t*>(output->buffer) + output->byteOffset,
-                       outputBuffer.cbuffer, bufferLength);
+            if (status != IEStatusCode::OK) {
+                dawn::ErrorLog() << "IE Failed to ie_blob_byte_size";
+                return MLComputeGraphStatus_Error;
+            }
+            if (output->byteLength < static_cast<size_t>(bufferLength)) {
+                dawn::ErrorLog() << "The buffer of output " << namedOutput.first
+                                 << " is too small";
+                return MLComputeGraphStatus_Error;
             }
+            memcpy(static_cast<int8_t*>(output->buffer) + output->byteOffset,
+                   outputBuffer.cbuffer, bufferLength);
         }
-
         return MLComputeGraphStatus_Success;
     }
+
+    bool Graph::SupportsConcurrentCompute() const {
+        return true;
+    }
+
+    MLComputeGraphStatus Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
+        InferRequest* inferRequest = AcquireInferRequest();
+        if (inferRequest == nullptr) {
+            return MLComputeGraphStatus_Error;
+        }
+        MLComputeGraphStatus status = SetInputs(inferRequest, inputs);
+        if (status == MLComputeGraphStatus_Success) {
+            status = SetOutputs(inferRequest, outputs);
+        }
+        if (status == MLComputeGraphStatus_Success) {
+            // Compute the compiled model.
+            IEStatusCode code = ie_infer_request_infer(inferRequest->request);
+            if (code != IEStatusCode::OK) {
+                dawn::ErrorLog() << "IE Failed to compute model";
+                status = MLComputeGraphStatus_Error;
+            } else {
+                status = GetOutputs(inferRequest, outputs);
+            }
+        }
+        ReleaseInferRequest(inferRequest);
+        return status;
+    }
+
+    // The infer request runs asynchronously on the threads of the inference engine, the outputs
+    // are read and the callback is called when it completes.
+    void Graph::ComputeAsyncImpl(NamedInputsBase* inputs,
+                                 NamedOutputsBase* outputs,
+                                 ml::ComputeAsyncCallback callback,
+                                 void* userdata) {
+        InferRequest* inferRequest = AcquireInferRequest();
+        if (inferRequest == nullptr) {
+            callback(MLComputeGraphStatus_Error, userdata);
+            return;
+        }
+        if (SetInputs(inferRequest, inputs) != MLComputeGraphStatus_Success ||
+            SetOutputs(inferRequest, outputs) != MLComputeGraphStatus_Success) {
+            ReleaseInferRequest(inferRequest);
+            callback(MLComputeGraphStatus_Error, userdata);
+            return;
+        }
+        inferRequest->outputs = outputs;
+        inferRequest->callback = callback;
+        inferRequest->userdata = userdata;
+        // The graph is referenced until the request completes, it may be released by the user
+        // before then.
+        inferRequest->pendingGraph = this;
+        IEStatusCode code = ie_infer_request_infer_async(inferRequest->request);
+        if (code != IEStatusCode::OK) {
+            dawn::ErrorLog() << "IE Failed to compute model asynchronously";
+            inferRequest->outputs = nullptr;
+            inferRequest->pendingGraph = nullptr;
+            ReleaseInferRequest(inferRequest);
+            callback(MLComputeGraphStatus_Error, userdata);
+        }
+    }
+
+    void Graph::OnInferCompleted(void* args) {
+        InferRequest* inferRequest = static_cast<InferRequest*>(args);
+        Graph* graph = inferRequest->graph;
+        MLComputeGraphStatus status =
+            graph->GetOutputs(inferRequest, inferRequest->outputs.Get());
+        inferRequest->outputs = nullptr;
+        ml::ComputeAsyncCallback callback = inferRequest->callback;
+        void* userdata = inferRequest->userdata;
+        Ref<GraphBase> pendingGraph = std::move(inferRequest->pendingGraph);
+        graph->ReleaseInferRequest(inferRequest);
+        callback(status, userdata);
+        // The graph frees its infer requests when it's destroyed, which must not happen in the
+        // completion callback of one of them.
+        graph->ReleaseOnWorkerThread(std::move(pendingGraph));
+    }
 }}  // namespace webnn_native::ie
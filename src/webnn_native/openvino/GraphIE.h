@@ -16,12 +16,16 @@
 #define WEBNN_NATIVE_IE_MODEL_IE_H_
 
 #include <ngraph_c_api.h>
+#include <condition_variable>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 
 #include "webnn_native/Error.h"
 #include "webnn_native/Graph.h"
+#include "webnn_native/NamedOutputs.h"
 #include "webnn_native/Operand.h"
 #include "webnn_native/Operator.h"
 #include "webnn_native/openvino/ContextIE.h"
@@ -77,6 +81,48 @@ namespace webnn_native { namespace ie {
         MaybeError CompileImpl() override;
         MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
                                          NamedOutputsBase* outputs) override;
+        void ComputeAsyncImpl(NamedInputsBase* inputs,
+                              NamedOutputsBase* outputs,
+                              ml::ComputeAsyncCallback callback,
+                              void* userdata) override;
+        bool SupportsConcurrentCompute() const override;
+
+        // An infer request of the pool, which is used by one compute at a time.
+        struct InferRequest {
+            Graph* graph;
+            ie_infer_request_t* request;
+            // The inference engine references the callback until the request is freed.
+            ie_complete_call_back_t completionCallback;
+            // The blobs allocated by the request, keyed by the blob name.
+            std::map<std::string, ie_blob_t*> blobs;
+            // The user buffers bound in place of the blobs of the request for a compute.
+            std::map<std::string, ie_blob_t*> userBlobs;
+            // The asynchronous compute in flight, the outputs are referenced until it completes.
+            Ref<NamedOutputsBase> outputs;
+            ml::ComputeAsyncCallback callback;
+            void* userdata;
+            Ref<GraphBase> pendingGraph;
+        };
+        // Append a new infer request to the pool.
+        MaybeError CreateInferRequest();
+        MaybeError InitializeInferRequest(InferRequest* inferRequest);
+        void FreeInferRequest(InferRequest* inferRequest);
+        // Check out a free infer request, the pool grows on demand up to the limit beyond which
+        // the compute waits for a request to be released. Returns nullptr if the request can't
+        // be created.
+        InferRequest* AcquireInferRequest();
+        void ReleaseInferRequest(InferRequest* inferRequest);
+        static void OnInferCompleted(void* args);
+        // Wrap the user buffer into a blob that replaces the blob of the request, so that the
+        // plugin reads or writes it in place. Returns false if the size or the alignment of the
+        // buffer doesn't allow it, in which case the data is copied.
+        bool BindBuffer(InferRequest* inferRequest,
+                        const std::string& blobName,
+                        const ArrayBufferView& view);
+        void UnbindBuffers(InferRequest* inferRequest);
+        MLComputeGraphStatus SetInputs(InferRequest* inferRequest, NamedInputsBase* inputs);
+        MLComputeGraphStatus SetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs);
+        MLComputeGraphStatus GetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs);
 
         // Map the input name to IE internal input number.
         std::map<std::string, size_t> mInputIdMap;
@@ -95,7 +141,17 @@ namespace webnn_native { namespace ie {
         std::vector<ngraph_node_t*> mGraphInputs;
         ie_core_t* mInferEngineCore;
         ie_network_t* mInferEngineNetwork;
-        ie_infer_request_t* mInferEngineRequest;
+        ie_executable_network_t* mInferEngineExecutableNetwork;
+
+        // The blob names of the named inputs and outputs.
+        std::map<std::string, std::string> mInputBlobNames;
+        std::map<std::string, std::string> mOutputBlobNames;
+
+        std::mutex mInferMutex;
+        std::condition_variable mInferCondition;
+        std::vector<std::unique_ptr<InferRequest>> mInferRequests;
+        std::vector<InferRequest*> mFreeInferRequests;
+        size_t mMaxInferRequests;
     };
 
 }}  // namespace webnn_native::ie
@@ -87,4 +87,19 @@ namespace webnn_native { namespace op {
         return {};
     }
 
+    void BatchNorm::ReplaceInput(const OperandBase* input, OperandBase* replacement) {
+        OperatorBase::ReplaceInput(input, replacement);
+        if (mOptions.scale == input) {
+            mOptions.scale = replacement;
+        }
+        if (mOptions.bias == input) {
+            mOptions.bias = replacement;
+        }
+    }
+
+    OperatorBase* BatchNorm::CloneImpl(GraphBuilderBase* builder) const {
+        return new BatchNorm(builder, mInputs[0].Get(), mInputs[1].Get(), mInputs[2].Get(),
+                             &mOptions);
+    }
+
 }}  // namespace webnn_native::op
@@ -33,13 +33,24 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddBatchNorm(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::BatchNorm;
+        }
         MaybeError Validate() override;
+        void ReplaceInput(const OperandBase* input, OperandBase* replacement) override;
 
         BatchNormOptions const* GetOptions() const {
             return &mOptions;
         }
+        // Set the activation fused by the OperatorFusion pass.
+        void SetActivation(OperatorBase* activation) {
+            mOptions.activation = activation;
+            mActivation = Ref<OperatorBase>(activation);
+        }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+
         BatchNormOptions mOptions;
         Ref<OperatorBase> mActivation;
     };
@@ -16,6 +16,7 @@
 
 #include "common/Log.h"
 #include "webnn_native/Error.h"
+#include "webnn_native/ShapeUtils.h"
 
 namespace webnn_native { namespace op {
 
@@ -30,7 +31,65 @@ namespace webnn_native { namespace op {
         if (a->Type() != b->Type()) {
             return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
         }
+        return CalculateShape();
+    }
+
+    MaybeError Binary::CalculateShape() {
+        std::vector<int32_t> aShape = mInputs[0]->Shape();
+        std::vector<int32_t> bShape = mInputs[1]->Shape();
+        if (mOpType != kMatMul) {
+            std::vector<int32_t> outputShape;
+            if (!BroadcastShapes(aShape, bShape, outputShape)) {
+                return DAWN_VALIDATION_ERROR("Shapes are not compatible for broadcasting.");
+            }
+            mOutputs[0]->SetShape(std::move(outputShape));
+            return {};
+        }
+
+        // For matmul, a 1-D operand is promoted to a matrix by prepending (for a) or appending
+        // (for b) a dimension of 1, the other dimensions are broadcasted as batch dimensions.
+        if (aShape.empty() || bShape.empty()) {
+            return DAWN_VALIDATION_ERROR("Argument of matmul must not be a scalar.");
+        }
+        bool aIsVector = aShape.size() == 1;
+        bool bIsVector = bShape.size() == 1;
+        if (aIsVector) {
+            aShape.insert(aShape.begin(), 1);
+        }
+        if (bIsVector) {
+            bShape.push_back(1);
+        }
+        int32_t aColumns = aShape[aShape.size() - 1];
+        int32_t bRows = bShape[bShape.size() - 2];
+        if (aColumns >= 0 && bRows >= 0 && aColumns != bRows) {
+            return DAWN_VALIDATION_ERROR("The inner dimensions of matmul are inconsistent.");
+        }
+        std::vector<int32_t> outputShape;
+        if (!BroadcastShapes(aShape, bShape, outputShape, 2)) {
+            return DAWN_VALIDATION_ERROR("Shapes are not compatible for broadcasting.");
+        }
+        size_t outputRank = outputShape.size();
+        outputShape[outputRank - 2] = aShape[aShape.size() - 2];
+        outputShape[outputRank - 1] = bShape[bShape.size() - 1];
+        // Keep the rank rules of the constructor: 1-D x 1-D is a scalar, 1-D x 2-D and
+        // 2-D x 1-D are 2-D.
+        if (aIsVector && bIsVector) {
+            outputShape.clear();
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    bool Binary::IsSameOperation(const OperatorBase* other) const {
+        const Binary* binary = static_cast<const Binary*>(other);
+        return binary->GetType() == mOpType && binary->GetActivation() == nullptr &&
+               mActivation.Get() == nullptr;
+    }
+
+    OperatorBase* Binary::CloneImpl(GraphBuilderBase* builder) const {
+        Binary* binary = new Binary(builder, mOpType, mInputs[0].Get(), mInputs[1].Get());
+        binary->SetActivation(mActivation.Get());
+        return binary;
+    }
+
 }}  // namespace webnn_native::op
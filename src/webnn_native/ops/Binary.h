@@ -58,13 +58,28 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddBinary(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Binary;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
         BinaryOpType GetType() const {
             return mOpType;
         }
+        // The activation fused by the OperatorFusion pass, it's applied to the output.
+        OperatorBase* GetActivation() const {
+            return mActivation.Get();
+        }
+        void SetActivation(OperatorBase* activation) {
+            mActivation = Ref<OperatorBase>(activation);
+        }
         MaybeError Validate() override;
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         BinaryOpType mOpType;
+        Ref<OperatorBase> mActivation;
     };
 
 }}  // namespace webnn_native::op
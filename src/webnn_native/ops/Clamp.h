@@ -15,9 +15,12 @@
 #ifndef WEBNN_NATIVE_OPS_CLAMP_H_
 #define WEBNN_NATIVE_OPS_CLAMP_H_
 
+#include <limits>
+
 #include "webnn_native/Graph.h"
 #include "webnn_native/Operand.h"
 #include "webnn_native/Operator.h"
+#include "webnn_native/ops/Constant.h"
 
 namespace webnn_native { namespace op {
 
@@ -37,8 +40,38 @@ namespace webnn_native { namespace op {
             return &mOptions;
         }
 
-      private:
+        // Whether the bounds are absent or scalar float32 constants, which allows the clamp to
+        // be fused as an activation.
+        bool IsClampByValue() const {
+            return IsScalarConstant(mOptions.minValue) && IsScalarConstant(mOptions.maxValue);
+        }
+        // The bounds of a clamp by value.
+        float GetMinValue() const {
+            return mOptions.minValue == nullptr ? std::numeric_limits<float>::lowest()
+                                                : GetScalarValue(mOptions.minValue);
+        }
+        float GetMaxValue() const {
+            return mOptions.maxValue == nullptr ? std::numeric_limits<float>::max()
+                                                : GetScalarValue(mOptions.maxValue);
+        }
+
+      protected:
         ClampOptions mOptions;
+
+      private:
+        static bool IsScalarConstant(OperandBase* operand) {
+            if (operand == nullptr) {
+                return true;
+            }
+            return operand->Operator()->GetOperatorType() == OperatorType::Constant &&
+                   operand->Type() == ml::OperandType::Float32 &&
+                   static_cast<const Constant*>(operand->Operator())->GetByteLength() ==
+                       sizeof(float);
+        }
+        static float GetScalarValue(OperandBase* operand) {
+            return *static_cast<const float*>(
+                static_cast<const Constant*>(operand->Operator())->GetBuffer());
+        }
     };
 
     class Clamp final : public ClampBase, public OperatorBase {
@@ -56,12 +89,40 @@ namespace webnn_native { namespace op {
         }
         Clamp(GraphBuilderBase* builder, ClampOptions const* options)
             : ClampBase(options), OperatorBase(builder, FusedOperator::Clamp) {
+            // Reference the bounds so that they outlive the graph operators when the clamp is
+            // fused into another operator.
+            if (options != nullptr) {
+                if (options->minValue != nullptr) {
+                    mInputs.push_back(options->minValue);
+                }
+                if (options->maxValue != nullptr) {
+                    mInputs.push_back(options->maxValue);
+                }
+            }
         }
         ~Clamp() override = default;
 
+        void ReplaceInput(const OperandBase* input, OperandBase* replacement) override {
+            OperatorBase::ReplaceInput(input, replacement);
+            if (mOptions.minValue == input) {
+                mOptions.minValue = replacement;
+            }
+            if (mOptions.maxValue == input) {
+                mOptions.maxValue = replacement;
+            }
+        }
+
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddClamp(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Clamp;
+        }
+
+      private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            return new Clamp(builder, mInputs[0].Get(), &mOptions);
+        }
     };
 
 }}  // namespace webnn_native::op
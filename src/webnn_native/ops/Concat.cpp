@@ -40,7 +40,38 @@ namespace webnn_native { namespace op {
         if (mAxis >= inputRank) {
             return DAWN_VALIDATION_ERROR("The axis is out of rank range.");
         }
+        return CalculateShape();
+    }
+
+    MaybeError Concat::CalculateShape() {
+        std::vector<int32_t> outputShape = mInputs[0]->Shape();
+        for (size_t i = 1; i < mInputs.size(); ++i) {
+            const std::vector<int32_t>& inputShape = mInputs[i]->Shape();
+            for (size_t j = 0; j < outputShape.size(); ++j) {
+                if (j == mAxis) {
+                    outputShape[j] = outputShape[j] < 0 || inputShape[j] < 0
+                                         ? -1
+                                         : outputShape[j] + inputShape[j];
+                } else if (outputShape[j] >= 0 && inputShape[j] >= 0 &&
+                           outputShape[j] != inputShape[j]) {
+                    return DAWN_VALIDATION_ERROR(
+                        "Argument inputs must have same shape except for the size of the "
+                        "dimension to concatenate on.");
+                } else if (outputShape[j] < 0) {
+                    outputShape[j] = inputShape[j];
+                }
+            }
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    bool Concat::IsSameOperation(const OperatorBase* other) const {
+        return static_cast<const Concat*>(other)->GetAxis() == mAxis;
+    }
+
+    OperatorBase* Concat::CloneImpl(GraphBuilderBase* builder) const {
+        return new Concat(builder, mInputs, mAxis);
+    }
+
 }}  // namespace webnn_native::op
@@ -32,12 +32,19 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddConcat(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Concat;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
         uint32_t GetAxis() const {
             return mAxis;
         }
         MaybeError Validate() override;
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         uint32_t mAxis;
     };
 
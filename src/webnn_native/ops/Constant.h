@@ -15,6 +15,8 @@
 #ifndef WEBNN_NATIVE_OPS_CONSTANT_H_
 #define WEBNN_NATIVE_OPS_CONSTANT_H_
 
+#include <vector>
+
 #include "webnn_native/Graph.h"
 #include "webnn_native/Operand.h"
 
@@ -29,15 +31,16 @@ namespace webnn_native { namespace op {
             if (desc == nullptr || arrayBuffer == nullptr) {
                 return;
             }
-            mDimensions.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
-            mDescriptor.dimensions = mDimensions.data();
-            mDescriptor.dimensionsCount = mDimensions.size();
-            mDescriptor.type = desc->type;
-            mBuffer = static_cast<int8_t*>(arrayBuffer->buffer) + arrayBuffer->byteOffset;
-            mByteLength = arrayBuffer->byteLength;
-
-            mOutputs[0]->SetRank(desc->dimensionsCount);
-            mOutputs[0]->SetType(desc->type);
+            Initialize(desc, static_cast<int8_t*>(arrayBuffer->buffer) + arrayBuffer->byteOffset,
+                       arrayBuffer->byteLength);
+        }
+        // The constant owns the data, e.g. the result of folding a constant subgraph at build
+        // time.
+        Constant(GraphBuilderBase* builder,
+                 const OperandDescriptor* desc,
+                 std::vector<uint8_t> data)
+            : OperatorBase(builder), mData(std::move(data)) {
+            Initialize(desc, mData.data(), mData.size());
         }
         ~Constant() override = default;
 
@@ -49,7 +52,10 @@ namespace webnn_native { namespace op {
             if (mBuffer == nullptr || mByteLength == 0) {
                 return DAWN_VALIDATION_ERROR("Constant array buffer is invalid.");
             }
-            return {};
+            return ValidateQuantization(mOutputs[0].Get());
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Constant;
         }
 
         const OperandDescriptor* GetOperandDescriptor() const {
@@ -61,12 +67,44 @@ namespace webnn_native { namespace op {
         size_t GetByteLength() const {
             return mByteLength;
         }
+        // Copy the constant with its own copy of the data, for the graphs that are built again
+        // after the buffer of the user may have been released.
+        ResultOrError<Ref<OperatorBase>> CloneWithData(GraphBuilderBase* builder) const {
+            const uint8_t* data = static_cast<const uint8_t*>(mBuffer);
+            Ref<OperatorBase> clone = AcquireRef(new Constant(
+                builder, &mDescriptor, std::vector<uint8_t>(data, data + mByteLength)));
+            CopyOutputsTo(clone.Get());
+            DAWN_TRY(clone->Validate());
+            return clone;
+        }
 
       private:
+        // The copy references the data of the constant, which must outlive it.
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            ArrayBufferView arrayBuffer = {};
+            arrayBuffer.buffer = const_cast<void*>(mBuffer);
+            arrayBuffer.byteLength = mByteLength;
+            return new Constant(builder, &mDescriptor, &arrayBuffer);
+        }
+
+        void Initialize(const OperandDescriptor* desc, void const* buffer, size_t byteLength) {
+            mDimensions.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
+            mDescriptor.dimensions = mDimensions.data();
+            mDescriptor.dimensionsCount = mDimensions.size();
+            mDescriptor.type = desc->type;
+            mBuffer = buffer;
+            mByteLength = byteLength;
+
+            mOutputs[0]->SetShape(mDimensions);
+            mOutputs[0]->SetType(desc->type);
+            mOutputs[0]->SetQuantization(MakeQuantization(desc));
+        }
+
         OperandDescriptor mDescriptor;
         std::vector<int32_t> mDimensions;
-        void const* mBuffer;
-        size_t mByteLength;
+        void const* mBuffer = nullptr;
+        size_t mByteLength = 0;
+        std::vector<uint8_t> mData;
     };
 
 }}  // namespace webnn_native::op
@@ -17,6 +17,7 @@
 #include "common/Log.h"
 #include "webnn_native/Error.h"
 #include "webnn_native/Operator.h"
+#include "webnn_native/ShapeUtils.h"
 
 namespace webnn_native { namespace op {
 
@@ -109,8 +110,114 @@ namespace webnn_native { namespace op {
         if (mOptions.dilationsCount != 2) {
             return DAWN_VALIDATION_ERROR("dilationsCount is incorrect.");
         }
+        if (mOptions.groups < 1) {
+            return DAWN_VALIDATION_ERROR("groups is invalid.");
+        }
+
+        return CalculateShape();
+    }
+
+    MaybeError Conv2d::CalculateShape() {
+        if (mStride[0] <= 0 || mStride[1] <= 0 || mDilations[0] <= 0 || mDilations[1] <= 0) {
+            return DAWN_VALIDATION_ERROR("The strides and dilations must be positive.");
+        }
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        const std::vector<int32_t>& filterShape = mInputs[1]->Shape();
+        bool nchw = mOptions.inputLayout == ml::InputOperandLayout::Nchw;
+        int32_t batches = inputShape[0];
+        int32_t inputChannels = nchw ? inputShape[1] : inputShape[3];
+        int32_t inputHeight = nchw ? inputShape[2] : inputShape[1];
+        int32_t inputWidth = nchw ? inputShape[3] : inputShape[2];
+
+        int32_t filterInputChannels, outputChannels, filterHeight, filterWidth;
+        switch (mOptions.filterLayout) {
+            case ml::FilterOperandLayout::Oihw:
+                outputChannels = filterShape[0];
+                filterInputChannels = filterShape[1];
+                filterHeight = filterShape[2];
+                filterWidth = filterShape[3];
+                break;
+            case ml::FilterOperandLayout::Hwio:
+                filterHeight = filterShape[0];
+                filterWidth = filterShape[1];
+                filterInputChannels = filterShape[2];
+                outputChannels = filterShape[3];
+                break;
+            case ml::FilterOperandLayout::Ohwi:
+                outputChannels = filterShape[0];
+                filterHeight = filterShape[1];
+                filterWidth = filterShape[2];
+                filterInputChannels = filterShape[3];
+                break;
+            case ml::FilterOperandLayout::Ihwo:
+                filterInputChannels = filterShape[0];
+                filterHeight = filterShape[1];
+                filterWidth = filterShape[2];
+                outputChannels = filterShape[3];
+                break;
+            default:
+                return DAWN_VALIDATION_ERROR("The filter layout is unsupported.");
+        }
+
+        // The input channels must be evenly divided into groups, each group of the input
+        // channels is convolved with the input channels of the filter.
+        if (inputChannels >= 0 && filterInputChannels >= 0 &&
+            (inputChannels % mOptions.groups != 0 ||
+             inputChannels / mOptions.groups != filterInputChannels)) {
+            return DAWN_VALIDATION_ERROR("The input channels are inconsistent.");
+        }
+        if (mOptions.bias != nullptr) {
+            const std::vector<int32_t>& biasShape = mInputs[2]->Shape();
+            if (biasShape[0] >= 0 && outputChannels >= 0 && biasShape[0] != outputChannels) {
+                return DAWN_VALIDATION_ERROR("The bias size is not equal to output channels.");
+            }
+        }
+
+        int32_t paddingBeginHeight = mPadding[0], paddingEndHeight = mPadding[1];
+        int32_t paddingBeginWidth = mPadding[2], paddingEndWidth = mPadding[3];
+        if (mOptions.autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(mOptions.autoPad, inputHeight, filterHeight,
+                                             mStride[0], mDilations[0], paddingBeginHeight,
+                                             paddingEndHeight);
+            ComputeImplicitPaddingForAutoPad(mOptions.autoPad, inputWidth, filterWidth,
+                                             mStride[1], mDilations[1], paddingBeginWidth,
+                                             paddingEndWidth);
+        }
+        int32_t outputHeight = -1, outputWidth = -1;
+        if (inputHeight >= 0 && filterHeight >= 0) {
+            outputHeight = ComputeConv2dOutputSize(inputHeight, filterHeight, paddingBeginHeight,
+                                                   paddingEndHeight, mStride[0], mDilations[0]);
+        }
+        if (inputWidth >= 0 && filterWidth >= 0) {
+            outputWidth = ComputeConv2dOutputSize(inputWidth, filterWidth, paddingBeginWidth,
+                                                  paddingEndWidth, mStride[1], mDilations[1]);
+        }
+        if ((inputHeight >= 0 && outputHeight <= 0) || (inputWidth >= 0 && outputWidth <= 0)) {
+            return DAWN_VALIDATION_ERROR("The output size of conv2d is invalid.");
+        }
 
+        if (nchw) {
+            mOutputs[0]->SetShape({batches, outputChannels, outputHeight, outputWidth});
+        } else {
+            mOutputs[0]->SetShape({batches, outputHeight, outputWidth, outputChannels});
+        }
         return {};
     }
 
+    void Conv2d::SetActivation(OperatorBase* activation) {
+        mOptions.activation = activation;
+        mActivation = Ref<OperatorBase>(activation);
+    }
+
+    void Conv2d::ReplaceInput(const OperandBase* input, OperandBase* replacement) {
+        OperatorBase::ReplaceInput(input, replacement);
+        if (mOptions.bias == input) {
+            mOptions.bias = replacement;
+        }
+    }
+
+    OperatorBase* Conv2d::CloneImpl(GraphBuilderBase* builder) const {
+        return new Conv2d(builder, mInputs[0].Get(), mInputs[1].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
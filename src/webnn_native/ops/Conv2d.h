@@ -29,11 +29,20 @@ namespace webnn_native { namespace op {
         ~Conv2d() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override;
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Conv2d;
+        }
         MaybeError Validate() override;
+        void ReplaceInput(const OperandBase* input, OperandBase* replacement) override;
 
         Conv2dOptions const* GetOptions() const;
+        // Set the activation fused by the OperatorFusion pass.
+        void SetActivation(OperatorBase* activation);
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         Conv2dOptions mOptions;
         std::vector<int32_t> mPadding;
         std::vector<int32_t> mStride;
@@ -18,6 +18,7 @@
 
 #include "common/Log.h"
 #include "webnn_native/Error.h"
+#include "webnn_native/ShapeUtils.h"
 
 namespace webnn_native { namespace op {
     Gemm::Gemm(GraphBuilderBase* builder,
@@ -29,7 +30,7 @@ namespace webnn_native { namespace op {
         mOptions.beta = options == nullptr ? 1.0 : options->beta;
         mOptions.aTranspose = options == nullptr ? false : options->aTranspose;
         mOptions.bTranspose = options == nullptr ? false : options->bTranspose;
-        if (options->c) {
+        if (options != nullptr && options->c != nullptr) {
             mInputs.push_back(options->c);
         }
     }
@@ -53,7 +54,37 @@ namespace webnn_native { namespace op {
             }
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Gemm::CalculateShape() {
+        const std::vector<int32_t>& aShape = mInputs[0]->Shape();
+        const std::vector<int32_t>& bShape = mInputs[1]->Shape();
+        // The shape of a is [M, K] or [K, M] if aTranspose, the shape of b is [K, N] or [N, K] if
+        // bTranspose.
+        int32_t m = mOptions.aTranspose ? aShape[1] : aShape[0];
+        int32_t aK = mOptions.aTranspose ? aShape[0] : aShape[1];
+        int32_t bK = mOptions.bTranspose ? bShape[1] : bShape[0];
+        int32_t n = mOptions.bTranspose ? bShape[0] : bShape[1];
+        if (aK >= 0 && bK >= 0 && aK != bK) {
+            return DAWN_VALIDATION_ERROR("The K dimensions of a and b are inconsistent.");
+        }
+        std::vector<int32_t> outputShape = {m, n};
+        if (mInputs.size() == 3 &&
+            !IsUnidirectionalBroadcastable(mInputs[2]->Shape(), outputShape)) {
+            return DAWN_VALIDATION_ERROR(
+                "The third input is not unidirectionally broadcastable to [M, N].");
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    OperatorBase* Gemm::CloneImpl(GraphBuilderBase* builder) const {
+        GemmOptions options = mOptions;
+        options.c = mInputs.size() > 2 ? mInputs[2].Get() : nullptr;
+        Gemm* gemm = new Gemm(builder, mInputs[0].Get(), mInputs[1].Get(), &options);
+        gemm->SetActivation(mActivation.Get());
+        return gemm;
+    }
+
 }}  // namespace webnn_native::op
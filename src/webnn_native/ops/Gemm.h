@@ -28,14 +28,28 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddGemm(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Gemm;
+        }
         MaybeError Validate() override;
 
         GemmOptions const* GetOptions() const {
             return &mOptions;
         }
+        // The activation fused by the OperatorFusion pass, it's applied to the output.
+        OperatorBase* GetActivation() const {
+            return mActivation.Get();
+        }
+        void SetActivation(OperatorBase* activation) {
+            mActivation = Ref<OperatorBase>(activation);
+        }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         GemmOptions mOptions;
+        Ref<OperatorBase> mActivation;
     };
 
 }}  // namespace webnn_native::op
@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "webnn_native/Graph.h"
 #include "webnn_native/Operand.h"
@@ -32,16 +34,20 @@ namespace webnn_native { namespace op {
             mDescriptor.dimensions = mDimensions.data();
             mDescriptor.dimensionsCount = mDimensions.size();
 
-            mOutputs[0]->SetRank(desc->dimensionsCount);
+            mOutputs[0]->SetShape(mDimensions);
             mOutputs[0]->SetType(desc->type);
+            mOutputs[0]->SetQuantization(MakeQuantization(desc));
         }
         ~Input() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddInput(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Input;
+        }
         MaybeError Validate() override {
-            return {};
+            return ValidateQuantization(mOutputs[0].Get());
         }
 
         const std::string& GetName() const {
@@ -50,8 +56,20 @@ namespace webnn_native { namespace op {
         const OperandDescriptor* GetOperandDescriptor() const {
             return &mDescriptor;
         }
+        // Change the shape of the input to build the graph for another batch size, the shapes
+        // of the dependent operands are calculated again by validating their operators.
+        void SetDimensions(std::vector<int32_t> dimensions) {
+            mDimensions = std::move(dimensions);
+            mDescriptor.dimensions = mDimensions.data();
+            mDescriptor.dimensionsCount = mDimensions.size();
+            mOutputs[0]->SetShape(mDimensions);
+        }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            return new Input(builder, mName, &mDescriptor);
+        }
+
         std::string mName;
         OperandDescriptor mDescriptor;
         std::vector<int32_t> mDimensions;
@@ -68,4 +68,18 @@ namespace webnn_native { namespace op {
         return {};
     }
 
+    void InstanceNorm::ReplaceInput(const OperandBase* input, OperandBase* replacement) {
+        OperatorBase::ReplaceInput(input, replacement);
+        if (mOptions.scale == input) {
+            mOptions.scale = replacement;
+        }
+        if (mOptions.bias == input) {
+            mOptions.bias = replacement;
+        }
+    }
+
+    OperatorBase* InstanceNorm::CloneImpl(GraphBuilderBase* builder) const {
+        return new InstanceNorm(builder, mInputs[0].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
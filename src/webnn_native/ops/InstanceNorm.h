@@ -30,13 +30,19 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddInstanceNorm(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::InstanceNorm;
+        }
         MaybeError Validate() override;
+        void ReplaceInput(const OperandBase* input, OperandBase* replacement) override;
 
         InstanceNormOptions const* GetOptions() const {
             return &mOptions;
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+
         InstanceNormOptions mOptions;
     };
 
@@ -44,6 +44,18 @@ namespace webnn_native { namespace op {
             : LeakyReluBase(options), Unary(builder, kLeakyRelu, FusedOperator::LeakyRelu) {
         }
         ~LeakyRelu() override = default;
+
+        bool IsSameOperation(const OperatorBase* other) const override {
+            return Unary::IsSameOperation(other) &&
+                   static_cast<const LeakyRelu*>(other)->GetAlpha() == GetAlpha();
+        }
+
+      private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            LeakyReluOptions options;
+            options.alpha = GetAlpha();
+            return new LeakyRelu(builder, mInputs[0].Get(), &options);
+        }
     };
 
 }}  // namespace webnn_native::op
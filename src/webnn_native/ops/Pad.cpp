@@ -36,7 +36,45 @@ namespace webnn_native { namespace op {
             return DAWN_VALIDATION_ERROR("The padding is not 2D.");
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Pad::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        const std::vector<int32_t>& paddingShape = mInputs[1]->Shape();
+        size_t inputRank = inputShape.size();
+        if ((paddingShape[0] >= 0 && static_cast<size_t>(paddingShape[0]) != inputRank) ||
+            (paddingShape[1] >= 0 && paddingShape[1] != 2)) {
+            return DAWN_VALIDATION_ERROR("The padding shape is not [rank of input, 2].");
+        }
+
+        // The output shape can only be inferred from a constant padding, otherwise the padded
+        // dimensions are unknown until compute.
+        const OperatorBase* paddingOperator = mInputs[1]->Operator();
+        if (paddingOperator->GetOperatorType() != OperatorType::Constant ||
+            mInputs[1]->Type() != ml::OperandType::Int32) {
+            mOutputs[0]->SetShape(std::vector<int32_t>(inputRank, -1));
+            return {};
+        }
+        const op::Constant* constant = static_cast<const op::Constant*>(paddingOperator);
+        if (constant->GetByteLength() < inputRank * 2 * sizeof(int32_t)) {
+            return DAWN_VALIDATION_ERROR("The padding constant is too small.");
+        }
+        const int32_t* padding = static_cast<const int32_t*>(constant->GetBuffer());
+        std::vector<int32_t> outputShape(inputRank);
+        for (size_t i = 0; i < inputRank; ++i) {
+            outputShape[i] =
+                inputShape[i] < 0 ? -1 : inputShape[i] + padding[2 * i] + padding[2 * i + 1];
+            if (inputShape[i] >= 0 && outputShape[i] <= 0) {
+                return DAWN_VALIDATION_ERROR("The padding value is invalid.");
+            }
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    OperatorBase* Pad::CloneImpl(GraphBuilderBase* builder) const {
+        return new Pad(builder, mInputs[0].Get(), mInputs[1].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
\ No newline at end of file
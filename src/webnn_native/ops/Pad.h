@@ -32,6 +32,9 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddPad(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Pad;
+        }
         MaybeError Validate() override;
 
         PadOptions const* GetOptions() const {
@@ -39,6 +42,9 @@ namespace webnn_native { namespace op {
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         PadOptions mOptions;
     };
 
@@ -16,6 +16,7 @@
 
 #include "common/Log.h"
 #include "webnn_native/Error.h"
+#include "webnn_native/ShapeUtils.h"
 
 namespace webnn_native { namespace op {
 
@@ -104,7 +105,58 @@ namespace webnn_native { namespace op {
             return DAWN_VALIDATION_ERROR("dilationsCount is incorrect.");
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Pool2d::CalculateShape() {
+        if (mStride[0] <= 0 || mStride[1] <= 0 || mDilations[0] <= 0 || mDilations[1] <= 0) {
+            return DAWN_VALIDATION_ERROR("The strides and dilations must be positive.");
+        }
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        bool nchw = mOptions.layout == ml::InputOperandLayout::Nchw;
+        int32_t batches = inputShape[0];
+        int32_t channels = nchw ? inputShape[1] : inputShape[3];
+        int32_t inputHeight = nchw ? inputShape[2] : inputShape[1];
+        int32_t inputWidth = nchw ? inputShape[3] : inputShape[2];
+        int32_t windowHeight = inputHeight, windowWidth = inputWidth;
+        if (mOptions.windowDimensions != nullptr) {
+            windowHeight = mWindowDimensions[0];
+            windowWidth = mWindowDimensions[1];
+        }
+
+        int32_t paddingBeginHeight = mPadding[0], paddingEndHeight = mPadding[1];
+        int32_t paddingBeginWidth = mPadding[2], paddingEndWidth = mPadding[3];
+        if (mOptions.autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(mOptions.autoPad, inputHeight, windowHeight,
+                                             mStride[0], mDilations[0], paddingBeginHeight,
+                                             paddingEndHeight);
+            ComputeImplicitPaddingForAutoPad(mOptions.autoPad, inputWidth, windowWidth,
+                                             mStride[1], mDilations[1], paddingBeginWidth,
+                                             paddingEndWidth);
+        }
+        int32_t outputHeight = -1, outputWidth = -1;
+        if (inputHeight >= 0 && windowHeight >= 0) {
+            outputHeight = ComputeConv2dOutputSize(inputHeight, windowHeight, paddingBeginHeight,
+                                                   paddingEndHeight, mStride[0], mDilations[0]);
+        }
+        if (inputWidth >= 0 && windowWidth >= 0) {
+            outputWidth = ComputeConv2dOutputSize(inputWidth, windowWidth, paddingBeginWidth,
+                                                  paddingEndWidth, mStride[1], mDilations[1]);
+        }
+        if ((inputHeight >= 0 && outputHeight <= 0) || (inputWidth >= 0 && outputWidth <= 0)) {
+            return DAWN_VALIDATION_ERROR("The output size of pool2d is invalid.");
+        }
+
+        if (nchw) {
+            mOutputs[0]->SetShape({batches, channels, outputHeight, outputWidth});
+        } else {
+            mOutputs[0]->SetShape({batches, outputHeight, outputWidth, channels});
+        }
         return {};
     }
 
+    OperatorBase* Pool2d::CloneImpl(GraphBuilderBase* builder) const {
+        return new Pool2d(builder, mOpType, mInputs[0].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
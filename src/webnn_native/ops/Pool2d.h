@@ -35,12 +35,18 @@ namespace webnn_native { namespace op {
         ~Pool2d() override = default;
 
         MaybeError AddToGraph(GraphBase* graph) const override;
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Pool2d;
+        }
         MaybeError Validate() override;
 
         Pool2dOptions const* GetOptions() const;
         Pool2dType GetType() const;
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         Pool2dOptions mOptions;
         std::vector<int32_t> mWindowDimensions;
         std::vector<int32_t> mPadding;
@@ -0,0 +1,106 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_OPS_QUANTIZE_H_
+#define WEBNN_NATIVE_OPS_QUANTIZE_H_
+
+#include "webnn_native/Graph.h"
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+
+namespace webnn_native { namespace op {
+
+    // Quantize the float32 input to the int8 or uint8 type with the scales and the zero points
+    // of the descriptor, the quantized values are rounded to the nearest even and saturated.
+    class QuantizeLinear final : public OperatorBase {
+      public:
+        QuantizeLinear(GraphBuilderBase* builder,
+                       OperandBase* input,
+                       const OperandDescriptor* desc)
+            : OperatorBase(builder, {input}) {
+            mOutputs[0]->SetType(desc->type);
+            mOutputs[0]->SetQuantization(MakeQuantization(desc));
+        }
+        ~QuantizeLinear() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddQuantizeLinear(this);
+        }
+        MaybeError Validate() override {
+            MaybeError maybeError = OperatorBase::Validate();
+            if (maybeError.IsError()) {
+                return maybeError;
+            }
+            if (mInputs[0]->Type() != ml::OperandType::Float32) {
+                return DAWN_VALIDATION_ERROR("The quantized input must be float32.");
+            }
+            if (!mOutputs[0]->IsQuantized()) {
+                return DAWN_VALIDATION_ERROR("The scales of the quantization are missing.");
+            }
+            mOutputs[0]->SetShape(mInputs[0]->Shape());
+            return ValidateQuantization(mOutputs[0].Get());
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::QuantizeLinear;
+        }
+
+      private:
+        // The quantization of the output is copied by Clone.
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            OperandDescriptor desc = {};
+            desc.type = mOutputs[0]->Type();
+            return new QuantizeLinear(builder, mInputs[0].Get(), &desc);
+        }
+    };
+
+    // Dequantize the int8 or uint8 input to float32 with the quantization of the input.
+    class DequantizeLinear final : public OperatorBase {
+      public:
+        DequantizeLinear(GraphBuilderBase* builder, OperandBase* input)
+            : OperatorBase(builder, {input}) {
+            mOutputs[0]->SetType(ml::OperandType::Float32);
+            mOutputs[0]->SetQuantization({});
+        }
+        ~DequantizeLinear() override = default;
+
+        MaybeError AddToGraph(GraphBase* graph) const override {
+            return graph->AddDequantizeLinear(this);
+        }
+        MaybeError Validate() override {
+            MaybeError maybeError = OperatorBase::Validate();
+            if (maybeError.IsError()) {
+                return maybeError;
+            }
+            if (!mInputs[0]->IsQuantized()) {
+                return DAWN_VALIDATION_ERROR("The dequantized input isn't quantized.");
+            }
+            mOutputs[0]->SetShape(mInputs[0]->Shape());
+            return {};
+        }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::DequantizeLinear;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override {
+            return true;
+        }
+
+      private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override {
+            return new DequantizeLinear(builder, mInputs[0].Get());
+        }
+    };
+
+}}  // namespace webnn_native::op
+
+#endif  // WEBNN_NATIVE_OPS_QUANTIZE_H_
@@ -65,7 +65,35 @@ namespace webnn_native { namespace op {
             axesMap[mAxes[i]] = i;
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError ReduceMean::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::vector<bool> reduced(inputShape.size(), false);
+        for (auto axis : mAxes) {
+            reduced[axis == -1 ? inputShape.size() - 1 : axis] = true;
+        }
+        std::vector<int32_t> outputShape;
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            if (!reduced[i]) {
+                outputShape.push_back(inputShape[i]);
+            } else if (mOptions.keepDimensions) {
+                outputShape.push_back(1);
+            }
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    bool ReduceMean::IsSameOperation(const OperatorBase* other) const {
+        const ReduceMeanOptions* options = static_cast<const ReduceMean*>(other)->GetOptions();
+        return options->keepDimensions == mOptions.keepDimensions &&
+               std::vector<int32_t>(options->axes, options->axes + options->axesCount) == mAxes;
+    }
+
+    OperatorBase* ReduceMean::CloneImpl(GraphBuilderBase* builder) const {
+        return new ReduceMean(builder, mInputs[0].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
\ No newline at end of file
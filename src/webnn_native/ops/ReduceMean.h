@@ -29,6 +29,10 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddReduceMean(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::ReduceMean;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
 
         MaybeError Validate() override;
 
@@ -37,6 +41,9 @@ namespace webnn_native { namespace op {
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         ReduceMeanOptions mOptions;
         std::vector<int32_t> mAxes;
     };
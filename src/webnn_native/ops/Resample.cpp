@@ -60,7 +60,33 @@ namespace webnn_native { namespace op {
             return DAWN_VALIDATION_ERROR("Argument scales is not a 4D tensor.");
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Resample::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::vector<int32_t> outputShape(4);
+        for (size_t i = 0; i < 4; ++i) {
+            // The sizes take precedence over the scales if both are specified.
+            if (!mSizes.empty()) {
+                if (mSizes[i] <= 0) {
+                    return DAWN_VALIDATION_ERROR("Argument sizes is invalid.");
+                }
+                outputShape[i] = mSizes[i];
+            } else {
+                if (mScales[i] <= 0) {
+                    return DAWN_VALIDATION_ERROR("Argument scales is invalid.");
+                }
+                outputShape[i] =
+                    inputShape[i] < 0 ? -1 : static_cast<int32_t>(inputShape[i] * mScales[i]);
+            }
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    OperatorBase* Resample::CloneImpl(GraphBuilderBase* builder) const {
+        return new Resample(builder, mInputs[0].Get(), &mOptions);
+    }
+
 }}  // namespace webnn_native::op
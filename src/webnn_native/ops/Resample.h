@@ -28,6 +28,9 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddResample(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Resample;
+        }
         MaybeError Validate() override;
 
         ResampleOptions const* GetOptions() const {
@@ -35,6 +38,9 @@ namespace webnn_native { namespace op {
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         ResampleOptions mOptions;
         std::vector<float> mScales;
         std::vector<int32_t> mSizes;
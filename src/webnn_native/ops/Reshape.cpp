@@ -38,7 +38,50 @@ namespace webnn_native { namespace op {
             }
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Reshape::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        for (auto dim : inputShape) {
+            if (dim < 0) {
+                // The element count is unknown, so the -1 of newShape can't be resolved.
+                mOutputs[0]->SetShape(mNewShape);
+                return {};
+            }
+        }
+        int64_t inputSize = 1;
+        for (auto dim : inputShape) {
+            inputSize *= dim;
+        }
+        int64_t knownSize = 1;
+        int32_t minus1Index = -1;
+        for (size_t i = 0; i < mNewShape.size(); ++i) {
+            if (mNewShape[i] == -1) {
+                minus1Index = i;
+            } else {
+                knownSize *= mNewShape[i];
+            }
+        }
+        std::vector<int32_t> outputShape = mNewShape;
+        if (minus1Index != -1) {
+            if (inputSize % knownSize != 0) {
+                return DAWN_VALIDATION_ERROR("Argument newShape is incompatible with input.");
+            }
+            outputShape[minus1Index] = inputSize / knownSize;
+        } else if (knownSize != inputSize) {
+            return DAWN_VALIDATION_ERROR("Argument newShape is incompatible with input.");
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    bool Reshape::IsSameOperation(const OperatorBase* other) const {
+        return static_cast<const Reshape*>(other)->GetNewShape() == mNewShape;
+    }
+
+    OperatorBase* Reshape::CloneImpl(GraphBuilderBase* builder) const {
+        return new Reshape(builder, mInputs[0].Get(), mNewShape.data(), mNewShape.size());
+    }
+
 }}  // namespace webnn_native::op
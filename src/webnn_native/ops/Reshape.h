@@ -37,12 +37,19 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddReshape(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Reshape;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
         MaybeError Validate() override;
         std::vector<int32_t> GetNewShape() const {
             return mNewShape;
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         std::vector<int32_t> mNewShape;
     };
 
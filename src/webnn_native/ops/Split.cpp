@@ -0,0 +1,74 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/ops/Split.h"
+
+#include "webnn_native/Error.h"
+
+namespace webnn_native { namespace op {
+
+    MaybeError Split::Validate() {
+        MaybeError maybeError = OperatorBase::Validate();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+        if (mSplits.empty()) {
+            return DAWN_VALIDATION_ERROR("Argument splits is invalid.");
+        }
+        int32_t inputRank = mInputs[0]->Rank();
+        if (mAxis >= inputRank || mAxis < -inputRank) {
+            return DAWN_VALIDATION_ERROR("The axis is out of rank range.");
+        }
+
+        return CalculateShape();
+    }
+
+    MaybeError Split::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        size_t axis = mAxis < 0 ? mAxis + inputShape.size() : mAxis;
+        int32_t dimension = inputShape[axis];
+        std::vector<int32_t> outputShape = inputShape;
+        if (mSplits.size() == 1) {
+            // The input is split into mSplits[0] tensors of the same shape along the axis.
+            uint32_t count = mSplits[0];
+            if (count == 0 || (dimension >= 0 && dimension % count != 0)) {
+                return DAWN_VALIDATION_ERROR("The dimension can't be evenly split.");
+            }
+            outputShape[axis] = dimension >= 0 ? dimension / count : -1;
+            for (auto& output : mOutputs) {
+                output->SetShape(outputShape);
+            }
+            return {};
+        }
+
+        int64_t sum = 0;
+        for (size_t i = 0; i < mSplits.size(); ++i) {
+            sum += mSplits[i];
+            outputShape[axis] = mSplits[i];
+            mOutputs[i]->SetShape(outputShape);
+        }
+        if (dimension >= 0 && sum != dimension) {
+            return DAWN_VALIDATION_ERROR(
+                "The sum of splits must be equal to the dimension size of input along the axis.");
+        }
+        return {};
+    }
+
+    OperatorBase* Split::CloneImpl(GraphBuilderBase* builder) const {
+        SplitOptions options;
+        options.axis = mAxis;
+        return new Split(builder, mInputs[0].Get(), mSplits.data(), mSplits.size(), &options);
+    }
+
+}}  // namespace webnn_native::op
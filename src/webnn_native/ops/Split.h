@@ -38,12 +38,12 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddSplit(this);
         }
-
-        MaybeError Validate() override {
-            return mSplits.empty() ? DAWN_VALIDATION_ERROR("Argument splits is invalid.")
-                                   : MaybeError();
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Split;
         }
 
+        MaybeError Validate() override;
+
         std::vector<uint32_t> GetSplits() const {
             return mSplits;
         }
@@ -53,6 +53,9 @@ namespace webnn_native { namespace op {
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         std::vector<uint32_t> mSplits;
         int32_t mAxis;
     };
@@ -0,0 +1,80 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/ops/Squeeze.h"
+
+#include <set>
+
+#include "webnn_native/Error.h"
+
+namespace webnn_native { namespace op {
+
+    MaybeError Squeeze::Validate() {
+        MaybeError maybeError = OperatorBase::Validate();
+        if (maybeError.IsError()) {
+            return maybeError;
+        }
+
+        int32_t inputRank = mInputs[0]->Rank();
+        for (auto axis : mAxes) {
+            if (axis >= inputRank || axis < -inputRank) {
+                return DAWN_VALIDATION_ERROR("The axis is out of rank range.");
+            }
+        }
+
+        return CalculateShape();
+    }
+
+    MaybeError Squeeze::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::set<size_t> squeezedAxes;
+        if (mAxes.empty()) {
+            // All the dimensions of size 1 are squeezed if axes is not present.
+            for (size_t i = 0; i < inputShape.size(); ++i) {
+                if (inputShape[i] == 1) {
+                    squeezedAxes.insert(i);
+                }
+            }
+        } else {
+            for (auto axis : mAxes) {
+                size_t index = axis < 0 ? axis + inputShape.size() : axis;
+                if (inputShape[index] >= 0 && inputShape[index] != 1) {
+                    return DAWN_VALIDATION_ERROR("The squeezed dimension is not 1.");
+                }
+                squeezedAxes.insert(index);
+            }
+        }
+
+        std::vector<int32_t> outputShape;
+        for (size_t i = 0; i < inputShape.size(); ++i) {
+            if (squeezedAxes.find(i) == squeezedAxes.end()) {
+                outputShape.push_back(inputShape[i]);
+            }
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
+        return {};
+    }
+
+    bool Squeeze::IsSameOperation(const OperatorBase* other) const {
+        return static_cast<const Squeeze*>(other)->GetAxes() == mAxes;
+    }
+
+    OperatorBase* Squeeze::CloneImpl(GraphBuilderBase* builder) const {
+        SqueezeOptions options;
+        options.axes = mAxes.data();
+        options.axesCount = mAxes.size();
+        return new Squeeze(builder, mInputs[0].Get(), &options);
+    }
+
+}}  // namespace webnn_native::op
@@ -34,12 +34,20 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddSqueeze(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Squeeze;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
+        MaybeError Validate() override;
 
         std::vector<int32_t> GetAxes() const {
             return mAxes;
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         std::vector<int32_t> mAxes;
     };
 
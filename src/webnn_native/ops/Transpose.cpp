@@ -38,13 +38,34 @@ namespace webnn_native { namespace op {
         std::vector<uint32_t> newPermutation;
         newPermutation.assign(mPermutation.begin(), mPermutation.end());
         std::sort(newPermutation.begin(), newPermutation.end());
-        for (uint32_t i = 0; i < inputRank - 1; i++) {
+        for (uint32_t i = 0; i < inputRank; i++) {
             if (newPermutation[i] != i) {
                 return DAWN_VALIDATION_ERROR("permutation value is invalid.");
             }
         }
 
+        return CalculateShape();
+    }
+
+    MaybeError Transpose::CalculateShape() {
+        const std::vector<int32_t>& inputShape = mInputs[0]->Shape();
+        std::vector<int32_t> outputShape(inputShape.size());
+        for (size_t i = 0; i < mPermutation.size(); ++i) {
+            outputShape[i] = inputShape[mPermutation[i]];
+        }
+        mOutputs[0]->SetShape(std::move(outputShape));
         return {};
     }
 
+    bool Transpose::IsSameOperation(const OperatorBase* other) const {
+        return static_cast<const Transpose*>(other)->GetPermutation() == mPermutation;
+    }
+
+    OperatorBase* Transpose::CloneImpl(GraphBuilderBase* builder) const {
+        TransposeOptions options;
+        options.permutation = mPermutation.data();
+        options.permutationCount = mPermutation.size();
+        return new Transpose(builder, mInputs[0].Get(), &options);
+    }
+
 }}  // namespace webnn_native::op
@@ -41,13 +41,23 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddTranspose(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Transpose;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
         MaybeError Validate() override;
 
         std::vector<int32_t> GetPermutation() const {
             return mPermutation;
         }
+        void SetPermutation(std::vector<int32_t> permutation) {
+            mPermutation = std::move(permutation);
+        }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+        MaybeError CalculateShape();
+
         std::vector<int32_t> mPermutation;
     };
 
@@ -35,4 +35,12 @@ namespace webnn_native { namespace op {
         return {};
     }
 
+    bool Unary::IsSameOperation(const OperatorBase* other) const {
+        return static_cast<const Unary*>(other)->GetType() == mOpType;
+    }
+
+    OperatorBase* Unary::CloneImpl(GraphBuilderBase* builder) const {
+        return new Unary(builder, mOpType, mInputs[0].Get());
+    }
+
 }}  // namespace webnn_native::op
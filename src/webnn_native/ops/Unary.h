@@ -44,12 +44,18 @@ namespace webnn_native { namespace op {
         MaybeError AddToGraph(GraphBase* graph) const override {
             return graph->AddUnary(this);
         }
+        OperatorType GetOperatorType() const override {
+            return OperatorType::Unary;
+        }
+        bool IsSameOperation(const OperatorBase* other) const override;
         MaybeError Validate() override;
         UnaryOpType GetType() const {
             return mOpType;
         }
 
       private:
+        OperatorBase* CloneImpl(GraphBuilderBase* builder) const override;
+
         UnaryOpType mOpType;
     };
 
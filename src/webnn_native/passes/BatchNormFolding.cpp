@@ -0,0 +1,252 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/BatchNormFolding.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ShapeUtils.h"
+#include "webnn_native/ops/BatchNorm.h"
+#include "webnn_native/ops/Binary.h"
+#include "webnn_native/ops/Constant.h"
+#include "webnn_native/ops/Conv2d.h"
+
+namespace webnn_native { namespace pass {
+
+    namespace {
+        // The folded operator computes output = conv * scale + shift along the channel axis.
+        struct ScaleShift {
+            std::vector<float> scale;
+            std::vector<float> shift;
+            OperatorBase* activation = nullptr;
+        };
+
+        const float* GetConstantData(const OperandBase* operand) {
+            const OperatorBase* op = const_cast<OperandBase*>(operand)->Operator();
+            if (op->GetOperatorType() != OperatorType::Constant ||
+                operand->Type() != ml::OperandType::Float32) {
+                return nullptr;
+            }
+            return static_cast<const float*>(static_cast<const op::Constant*>(op)->GetBuffer());
+        }
+
+        const float* GetChannelData(const OperandBase* operand, int32_t channels) {
+            const std::vector<int32_t>& shape = operand->Shape();
+            if (shape.size() != 1 || shape[0] != channels) {
+                return nullptr;
+            }
+            return GetConstantData(operand);
+        }
+
+        bool GetBatchNormScaleShift(const op::BatchNorm* batchNorm,
+                                    uint32_t channelAxis,
+                                    int32_t channels,
+                                    ScaleShift& scaleShift) {
+            const BatchNormOptions* options = batchNorm->GetOptions();
+            if (options->axis != channelAxis) {
+                return false;
+            }
+            const std::vector<Ref<OperandBase>>& inputs = batchNorm->Inputs();
+            const float* mean = GetChannelData(inputs[1].Get(), channels);
+            const float* variance = GetChannelData(inputs[2].Get(), channels);
+            size_t index = 3;
+            const float* scale = nullptr;
+            if (options->scale != nullptr) {
+                scale = GetChannelData(inputs[index++].Get(), channels);
+                if (scale == nullptr) {
+                    return false;
+                }
+            }
+            const float* bias = nullptr;
+            if (options->bias != nullptr) {
+                bias = GetChannelData(inputs[index].Get(), channels);
+                if (bias == nullptr) {
+                    return false;
+                }
+            }
+            if (mean == nullptr || variance == nullptr) {
+                return false;
+            }
+
+            scaleShift.scale.resize(channels);
+            scaleShift.shift.resize(channels);
+            for (int32_t c = 0; c < channels; ++c) {
+                float factor = (scale != nullptr ? scale[c] : 1.0f) /
+                               std::sqrt(variance[c] + options->epsilon);
+                scaleShift.scale[c] = factor;
+                scaleShift.shift[c] = (bias != nullptr ? bias[c] : 0.0f) - mean[c] * factor;
+            }
+            scaleShift.activation = options->activation;
+            return true;
+        }
+
+        bool GetBinaryScaleShift(const op::Binary* binary,
+                                 const OperandBase* convOutput,
+                                 uint32_t channelAxis,
+                                 int32_t channels,
+                                 ScaleShift& scaleShift) {
+            if (binary->GetType() != op::BinaryOpType::kMul &&
+                binary->GetType() != op::BinaryOpType::kAdd) {
+                return false;
+            }
+            const std::vector<Ref<OperandBase>>& inputs = binary->Inputs();
+            const OperandBase* other =
+                inputs[0].Get() == convOutput ? inputs[1].Get() : inputs[0].Get();
+            const float* data = GetConstantData(other);
+            if (other == convOutput || data == nullptr) {
+                return false;
+            }
+            // The constant must only vary along the channel axis of the 4-D output, so the
+            // linear index of its data is the channel.
+            const std::vector<int32_t>& shape = other->Shape();
+            if (shape.size() > 4) {
+                return false;
+            }
+            bool perChannel = false;
+            for (size_t i = 0; i < shape.size(); ++i) {
+                size_t axis = 4 - shape.size() + i;
+                if (axis == channelAxis && shape[i] == channels) {
+                    perChannel = true;
+                } else if (shape[i] != 1) {
+                    return false;
+                }
+            }
+
+            bool isMul = binary->GetType() == op::BinaryOpType::kMul;
+            scaleShift.activation = binary->GetActivation();
+            scaleShift.scale.assign(channels, 1.0f);
+            scaleShift.shift.assign(channels, 0.0f);
+            for (int32_t c = 0; c < channels; ++c) {
+                float value = data[perChannel ? c : 0];
+                if (isMul) {
+                    scaleShift.scale[c] = value;
+                } else {
+                    scaleShift.shift[c] = value;
+                }
+            }
+            return true;
+        }
+
+        std::vector<uint8_t> ToBytes(const std::vector<float>& data) {
+            std::vector<uint8_t> bytes(data.size() * sizeof(float));
+            std::memcpy(bytes.data(), data.data(), bytes.size());
+            return bytes;
+        }
+
+        Ref<OperatorBase> CreateConstant(GraphBuilderBase* builder,
+                                         std::vector<int32_t> shape,
+                                         const std::vector<float>& data) {
+            OperandDescriptor desc;
+            desc.type = ml::OperandType::Float32;
+            desc.dimensions = shape.data();
+            desc.dimensionsCount = shape.size();
+            return AcquireRef(new op::Constant(builder, &desc, ToBytes(data)));
+        }
+    }  // namespace
+
+    ResultOrError<bool> BatchNormFolding::Run(PassContext& context) {
+        bool changed = false;
+        for (size_t i = 0; i < context.operators.size(); ++i) {
+            const OperatorBase* op = context.operators[i].Get();
+            OperatorType type = op->GetOperatorType();
+            if (type != OperatorType::BatchNorm && type != OperatorType::Binary) {
+                continue;
+            }
+            if (context.outputs.find(op->PrimaryOutput()) != context.outputs.end()) {
+                continue;
+            }
+            // Find the Conv2d that produces the input, the Mul and Add may take the convolution
+            // as the second operand.
+            const OperandBase* convOutput = nullptr;
+            for (auto& input : op->Inputs()) {
+                if (input->Operator()->GetOperatorType() == OperatorType::Conv2d) {
+                    convOutput = input.Get();
+                    break;
+                }
+            }
+            if (convOutput == nullptr || !HasSingleUse(context, convOutput)) {
+                continue;
+            }
+            auto conv = static_cast<const op::Conv2d*>(
+                const_cast<OperandBase*>(convOutput)->Operator());
+            const Conv2dOptions* options = conv->GetOptions();
+            const std::vector<Ref<OperandBase>>& convInputs = conv->Inputs();
+            const float* filter = GetConstantData(convInputs[1].Get());
+            const float* bias = options->bias != nullptr ? GetConstantData(convInputs[2].Get())
+                                                         : nullptr;
+            if (options->activation != nullptr || filter == nullptr ||
+                (options->bias != nullptr && bias == nullptr)) {
+                continue;
+            }
+
+            const std::vector<int32_t>& filterShape = convInputs[1]->Shape();
+            bool outputChannelFirst = options->filterLayout == ml::FilterOperandLayout::Oihw ||
+                                      options->filterLayout == ml::FilterOperandLayout::Ohwi;
+            int32_t channels = outputChannelFirst ? filterShape[0] : filterShape[3];
+            uint32_t channelAxis = options->inputLayout == ml::InputOperandLayout::Nchw ? 1 : 3;
+            ScaleShift scaleShift;
+            bool foldable =
+                type == OperatorType::BatchNorm
+                    ? GetBatchNormScaleShift(static_cast<const op::BatchNorm*>(op), channelAxis,
+                                             channels, scaleShift)
+                    : GetBinaryScaleShift(static_cast<const op::Binary*>(op), convOutput,
+                                          channelAxis, channels, scaleShift);
+            if (!foldable) {
+                continue;
+            }
+
+            // Scale each output channel of the filter, the output channel is the outermost
+            // dimension of the oihw and ohwi layouts and the innermost of the hwio and ihwo.
+            size_t filterSize = SizeOfShape(filterShape);
+            size_t channelSize = filterSize / channels;
+            std::vector<float> newFilter(filter, filter + filterSize);
+            for (size_t j = 0; j < filterSize; ++j) {
+                newFilter[j] *= scaleShift.scale[outputChannelFirst ? j / channelSize
+                                                                    : j % channels];
+            }
+            std::vector<float> newBias(channels);
+            for (int32_t c = 0; c < channels; ++c) {
+                newBias[c] = (bias != nullptr ? bias[c] : 0.0f) * scaleShift.scale[c] +
+                             scaleShift.shift[c];
+            }
+
+            Ref<OperatorBase> filterConstant =
+                CreateConstant(context.builder, filterShape, newFilter);
+            Ref<OperatorBase> biasConstant = CreateConstant(context.builder, {channels}, newBias);
+            DAWN_TRY(filterConstant->Validate());
+            DAWN_TRY(biasConstant->Validate());
+            Conv2dOptions newOptions = *options;
+            newOptions.bias = biasConstant->PrimaryOutput();
+            newOptions.activation = scaleShift.activation;
+            Ref<OperatorBase> newConv =
+                AcquireRef(new op::Conv2d(context.builder, convInputs[0].Get(),
+                                          filterConstant->PrimaryOutput(), &newOptions));
+            DAWN_TRY(newConv->Validate());
+
+            // The folded operator is replaced by the new constants and Conv2d in place, the
+            // original Conv2d is removed by DeadOperatorElimination.
+            OperandBase* output = op->PrimaryOutput();
+            context.operators[i] = filterConstant;
+            context.operators.insert(context.operators.begin() + i + 1, {biasConstant, newConv});
+            i += 2;
+            ReplaceAllUsesWith(context, i, output, newConv->PrimaryOutput());
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
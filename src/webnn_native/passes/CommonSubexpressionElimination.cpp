@@ -0,0 +1,70 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/CommonSubexpressionElimination.h"
+
+#include <unordered_map>
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+
+namespace webnn_native { namespace pass {
+
+    namespace {
+        bool HaveSameInputs(const OperatorBase* a, const OperatorBase* b) {
+            const std::vector<Ref<OperandBase>>& aInputs = a->Inputs();
+            const std::vector<Ref<OperandBase>>& bInputs = b->Inputs();
+            if (aInputs.size() != bInputs.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < aInputs.size(); ++i) {
+                if (aInputs[i].Get() != bInputs[i].Get()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }  // namespace
+
+    ResultOrError<bool> CommonSubexpressionElimination::Run(PassContext& context) {
+        bool changed = false;
+        // The candidates are indexed by their first input to avoid comparing all the pairs.
+        std::unordered_map<const OperandBase*, std::vector<const OperatorBase*>> candidates;
+        for (size_t i = 0; i < context.operators.size(); ++i) {
+            const OperatorBase* op = context.operators[i].Get();
+            if (op->Inputs().empty() || op->Outputs().size() != 1) {
+                continue;
+            }
+            const OperandBase* output = op->PrimaryOutput();
+            std::vector<const OperatorBase*>& sameInputOperators =
+                candidates[op->Inputs()[0].Get()];
+            const OperatorBase* existing = nullptr;
+            for (auto candidate : sameInputOperators) {
+                if (candidate->GetOperatorType() == op->GetOperatorType() &&
+                    HaveSameInputs(candidate, op) && candidate->IsSameOperation(op)) {
+                    existing = candidate;
+                    break;
+                }
+            }
+            if (existing == nullptr || context.outputs.find(output) != context.outputs.end()) {
+                sameInputOperators.push_back(op);
+                continue;
+            }
+            ReplaceAllUsesWith(context, i, output, existing->PrimaryOutput());
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
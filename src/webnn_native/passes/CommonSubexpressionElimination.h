@@ -0,0 +1,34 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_PASSES_COMMONSUBEXPRESSIONELIMINATION_H_
+#define WEBNN_NATIVE_PASSES_COMMONSUBEXPRESSIONELIMINATION_H_
+
+#include "webnn_native/PassManager.h"
+
+namespace webnn_native { namespace pass {
+
+    // Replace the uses of an operator with an earlier operator of the same type, inputs and
+    // attributes. The operators that don't implement IsSameOperation() are left alone.
+    class CommonSubexpressionElimination final : public GraphPass {
+      public:
+        const char* GetName() const override {
+            return "CommonSubexpressionElimination";
+        }
+        ResultOrError<bool> Run(PassContext& context) override;
+    };
+
+}}  // namespace webnn_native::pass
+
+#endif  // WEBNN_NATIVE_PASSES_COMMONSUBEXPRESSIONELIMINATION_H_
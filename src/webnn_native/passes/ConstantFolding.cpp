@@ -0,0 +1,332 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/ConstantFolding.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ShapeUtils.h"
+#include "webnn_native/ops/Binary.h"
+#include "webnn_native/ops/Clamp.h"
+#include "webnn_native/ops/Concat.h"
+#include "webnn_native/ops/Constant.h"
+#include "webnn_native/ops/LeakyRelu.h"
+#include "webnn_native/ops/Transpose.h"
+#include "webnn_native/ops/Unary.h"
+
+namespace webnn_native { namespace pass {
+
+    namespace {
+        const void* GetInputData(const OperatorBase* op, size_t index) {
+            const OperatorBase* constant = op->Inputs()[index]->Operator();
+            return static_cast<const op::Constant*>(constant)->GetBuffer();
+        }
+
+        std::vector<size_t> ComputeStrides(const std::vector<int32_t>& shape) {
+            std::vector<size_t> strides(shape.size());
+            size_t stride = 1;
+            for (size_t i = shape.size(); i > 0; --i) {
+                strides[i - 1] = stride;
+                stride *= shape[i - 1];
+            }
+            return strides;
+        }
+
+        // The strides to read |shape| broadcasted to |outputShape|, the broadcasted dimensions
+        // have the stride of 0.
+        std::vector<size_t> ComputeBroadcastStrides(const std::vector<int32_t>& shape,
+                                                    const std::vector<int32_t>& outputShape) {
+            std::vector<size_t> strides = ComputeStrides(shape);
+            std::vector<size_t> broadcastStrides(outputShape.size(), 0);
+            size_t offset = outputShape.size() - shape.size();
+            for (size_t i = 0; i < shape.size(); ++i) {
+                broadcastStrides[offset + i] = shape[i] == 1 ? 0 : strides[i];
+            }
+            return broadcastStrides;
+        }
+
+        // Map the linear index of the output to the offset of an input with |inputStrides|.
+        size_t ComputeOffset(size_t index,
+                             const std::vector<size_t>& outputStrides,
+                             const std::vector<size_t>& inputStrides) {
+            size_t offset = 0;
+            for (size_t i = 0; i < outputStrides.size(); ++i) {
+                offset += index / outputStrides[i] * inputStrides[i];
+                index %= outputStrides[i];
+            }
+            return offset;
+        }
+
+        // Broadcast |b| to the shape of the output and combine it with |a| element-wise.
+        template <typename Function>
+        void EvaluateBroadcast(const float* a,
+                               const std::vector<int32_t>& aShape,
+                               const float* b,
+                               const std::vector<int32_t>& bShape,
+                               const std::vector<int32_t>& outputShape,
+                               float* output,
+                               Function function) {
+            std::vector<size_t> outputStrides = ComputeStrides(outputShape);
+            std::vector<size_t> aStrides = ComputeBroadcastStrides(aShape, outputShape);
+            std::vector<size_t> bStrides = ComputeBroadcastStrides(bShape, outputShape);
+            size_t size = SizeOfShape(outputShape);
+            for (size_t i = 0; i < size; ++i) {
+                output[i] = function(a[ComputeOffset(i, outputStrides, aStrides)],
+                                     b[ComputeOffset(i, outputStrides, bStrides)]);
+            }
+        }
+
+        bool EvaluateBinary(const op::Binary* binary, float* output) {
+            if (binary->GetActivation() != nullptr) {
+                return false;
+            }
+            const float* a = static_cast<const float*>(GetInputData(binary, 0));
+            const float* b = static_cast<const float*>(GetInputData(binary, 1));
+            const std::vector<int32_t>& aShape = binary->Inputs()[0]->Shape();
+            const std::vector<int32_t>& bShape = binary->Inputs()[1]->Shape();
+            const std::vector<int32_t>& outputShape = binary->PrimaryOutput()->Shape();
+            switch (binary->GetType()) {
+                case op::BinaryOpType::kAdd:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return x + y; });
+                    return true;
+                case op::BinaryOpType::kSub:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return x - y; });
+                    return true;
+                case op::BinaryOpType::kMul:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return x * y; });
+                    return true;
+                case op::BinaryOpType::kDiv:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return x / y; });
+                    return true;
+                case op::BinaryOpType::kMax:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return std::max(x, y); });
+                    return true;
+                case op::BinaryOpType::kMin:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return std::min(x, y); });
+                    return true;
+                case op::BinaryOpType::kPower:
+                    EvaluateBroadcast(a, aShape, b, bShape, outputShape, output,
+                                      [](float x, float y) { return std::pow(x, y); });
+                    return true;
+                default:
+                    // Matmul of constants is rare in the models, leave it to the backend.
+                    return false;
+            }
+        }
+
+        bool EvaluateUnary(const op::Unary* unary, float* output) {
+            const float* input = static_cast<const float*>(GetInputData(unary, 0));
+            const std::vector<int32_t>& shape = unary->Inputs()[0]->Shape();
+            size_t size = SizeOfShape(shape);
+            switch (unary->GetType()) {
+                case op::UnaryOpType::kRelu:
+                    std::transform(input, input + size, output,
+                                   [](float x) { return std::max(x, 0.0f); });
+                    return true;
+                case op::UnaryOpType::kLeakyRelu: {
+                    float alpha = static_cast<const op::LeakyRelu*>(unary)->GetAlpha();
+                    std::transform(input, input + size, output,
+                                   [alpha](float x) { return x < 0 ? alpha * x : x; });
+                    return true;
+                }
+                case op::UnaryOpType::kSigmoid:
+                    std::transform(input, input + size, output,
+                                   [](float x) { return 1.0f / (1.0f + std::exp(-x)); });
+                    return true;
+                case op::UnaryOpType::kTanh:
+                    std::transform(input, input + size, output,
+                                   [](float x) { return std::tanh(x); });
+                    return true;
+                case op::UnaryOpType::kHardSwish:
+                    std::transform(input, input + size, output, [](float x) {
+                        return x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+                    });
+                    return true;
+                case op::UnaryOpType::kSoftmax: {
+                    // The input of softmax is 2-D, the softmax is computed along each row.
+                    size_t columns = shape[1];
+                    for (size_t row = 0; row < size / columns; ++row) {
+                        const float* in = input + row * columns;
+                        float* out = output + row * columns;
+                        float maxValue = *std::max_element(in, in + columns);
+                        float sum = 0;
+                        for (size_t i = 0; i < columns; ++i) {
+                            out[i] = std::exp(in[i] - maxValue);
+                            sum += out[i];
+                        }
+                        for (size_t i = 0; i < columns; ++i) {
+                            out[i] /= sum;
+                        }
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        bool EvaluateClamp(const op::Clamp* clamp, float* output) {
+            const std::vector<int32_t>& shape = clamp->Inputs()[0]->Shape();
+            std::memcpy(output, GetInputData(clamp, 0), SizeOfShape(shape) * sizeof(float));
+            const ClampOptions* options = clamp->GetOptions();
+            size_t index = 1;
+            if (options->minValue != nullptr) {
+                const float* minValue = static_cast<const float*>(GetInputData(clamp, index));
+                EvaluateBroadcast(output, shape, minValue, clamp->Inputs()[index]->Shape(), shape,
+                                  output, [](float x, float y) { return std::max(x, y); });
+                ++index;
+            }
+            if (options->maxValue != nullptr) {
+                const float* maxValue = static_cast<const float*>(GetInputData(clamp, index));
+                EvaluateBroadcast(output, shape, maxValue, clamp->Inputs()[index]->Shape(), shape,
+                                  output, [](float x, float y) { return std::min(x, y); });
+            }
+            return true;
+        }
+
+        void EvaluateTranspose(const op::Transpose* transpose,
+                               size_t elementSize,
+                               uint8_t* output) {
+            const uint8_t* input = static_cast<const uint8_t*>(GetInputData(transpose, 0));
+            const std::vector<int32_t>& outputShape = transpose->PrimaryOutput()->Shape();
+            std::vector<size_t> inputStrides = ComputeStrides(transpose->Inputs()[0]->Shape());
+            std::vector<int32_t> permutation = transpose->GetPermutation();
+            std::vector<size_t> permutedStrides(permutation.size());
+            for (size_t i = 0; i < permutation.size(); ++i) {
+                permutedStrides[i] = inputStrides[permutation[i]];
+            }
+            std::vector<size_t> outputStrides = ComputeStrides(outputShape);
+            size_t size = SizeOfShape(outputShape);
+            for (size_t i = 0; i < size; ++i) {
+                size_t offset = ComputeOffset(i, outputStrides, permutedStrides);
+                std::memcpy(output + i * elementSize, input + offset * elementSize, elementSize);
+            }
+        }
+
+        void EvaluateConcat(const op::Concat* concat, size_t elementSize, uint8_t* output) {
+            const std::vector<int32_t>& outputShape = concat->PrimaryOutput()->Shape();
+            uint32_t axis = concat->GetAxis();
+            size_t outerSize = 1;
+            for (size_t i = 0; i < axis; ++i) {
+                outerSize *= outputShape[i];
+            }
+            size_t outputBlockSize = SizeOfShape(outputShape) / outerSize * elementSize;
+            size_t blockOffset = 0;
+            for (size_t i = 0; i < concat->Inputs().size(); ++i) {
+                const uint8_t* input = static_cast<const uint8_t*>(GetInputData(concat, i));
+                size_t blockSize =
+                    SizeOfShape(concat->Inputs()[i]->Shape()) / outerSize * elementSize;
+                for (size_t j = 0; j < outerSize; ++j) {
+                    std::memcpy(output + j * outputBlockSize + blockOffset,
+                                input + j * blockSize, blockSize);
+                }
+                blockOffset += blockSize;
+            }
+        }
+
+        // Return false if the operator can't be evaluated at build time.
+        bool Evaluate(const OperatorBase* op, std::vector<uint8_t>& result) {
+            ml::OperandType type = op->PrimaryOutput()->Type();
+            size_t elementSize = SizeOfOperandType(type);
+            result.resize(SizeOfShape(op->PrimaryOutput()->Shape()) * elementSize);
+            float* output = reinterpret_cast<float*>(result.data());
+            switch (op->GetOperatorType()) {
+                case OperatorType::Reshape:
+                case OperatorType::Squeeze:
+                    // The data layout is unchanged.
+                    std::memcpy(result.data(), GetInputData(op, 0), result.size());
+                    return true;
+                case OperatorType::Transpose:
+                    EvaluateTranspose(static_cast<const op::Transpose*>(op), elementSize,
+                                      result.data());
+                    return true;
+                case OperatorType::Concat:
+                    EvaluateConcat(static_cast<const op::Concat*>(op), elementSize,
+                                   result.data());
+                    return true;
+                case OperatorType::Binary:
+                    return type == ml::OperandType::Float32 &&
+                           EvaluateBinary(static_cast<const op::Binary*>(op), output);
+                case OperatorType::Unary:
+                    return type == ml::OperandType::Float32 &&
+                           EvaluateUnary(static_cast<const op::Unary*>(op), output);
+                case OperatorType::Clamp:
+                    return type == ml::OperandType::Float32 &&
+                           EvaluateClamp(static_cast<const op::Clamp*>(op), output);
+                default:
+                    return false;
+            }
+        }
+
+        bool CanFold(const PassContext& context, const OperatorBase* op) {
+            OperatorType type = op->GetOperatorType();
+            if (type == OperatorType::Input || type == OperatorType::Constant ||
+                op->Inputs().empty() || op->Outputs().size() != 1) {
+                return false;
+            }
+            // The backends expect an operator to produce the named outputs.
+            if (context.outputs.find(op->PrimaryOutput()) != context.outputs.end()) {
+                return false;
+            }
+            for (auto& input : op->Inputs()) {
+                if (input->Operator()->GetOperatorType() != OperatorType::Constant) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }  // namespace
+
+    ResultOrError<bool> ConstantFolding::Run(PassContext& context) {
+        bool changed = false;
+        for (size_t i = 0; i < context.operators.size(); ++i) {
+            const OperatorBase* op = context.operators[i].Get();
+            if (!CanFold(context, op)) {
+                continue;
+            }
+            std::vector<uint8_t> result;
+            if (!Evaluate(op, result) || result.empty()) {
+                continue;
+            }
+
+            OperandBase* output = op->PrimaryOutput();
+            std::vector<int32_t> shape = output->Shape();
+            OperandDescriptor desc;
+            desc.type = output->Type();
+            desc.dimensions = shape.data();
+            desc.dimensionsCount = shape.size();
+            Ref<OperatorBase> constant =
+                AcquireRef(new op::Constant(context.builder, &desc, std::move(result)));
+            constant->PrimaryOutput()->SetQuantization(output->GetQuantization());
+            DAWN_TRY(constant->Validate());
+            // The folded operator is replaced by the constant in place, which keeps the
+            // operators sorted.
+            ReplaceAllUsesWith(context, i, output, constant->PrimaryOutput());
+            context.operators[i] = constant;
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
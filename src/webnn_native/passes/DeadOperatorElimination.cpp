@@ -0,0 +1,52 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/DeadOperatorElimination.h"
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+
+namespace webnn_native { namespace pass {
+
+    ResultOrError<bool> DeadOperatorElimination::Run(PassContext& context) {
+        std::unordered_set<const OperandBase*> liveOperands = context.outputs;
+        std::vector<Ref<OperatorBase>> liveOperators;
+        // Walk in reverse topological order so all the uses of an operand are visited before
+        // its producer.
+        for (auto iter = context.operators.rbegin(); iter != context.operators.rend(); ++iter) {
+            const Ref<OperatorBase>& op = *iter;
+            bool isLive = op->GetOperatorType() == OperatorType::Input;
+            for (auto& output : op->Outputs()) {
+                if (liveOperands.find(output.Get()) != liveOperands.end()) {
+                    isLive = true;
+                    break;
+                }
+            }
+            if (!isLive) {
+                continue;
+            }
+            for (auto& input : op->Inputs()) {
+                liveOperands.insert(input.Get());
+            }
+            liveOperators.push_back(op);
+        }
+
+        if (liveOperators.size() == context.operators.size()) {
+            return false;
+        }
+        context.operators.assign(liveOperators.rbegin(), liveOperators.rend());
+        return true;
+    }
+
+}}  // namespace webnn_native::pass
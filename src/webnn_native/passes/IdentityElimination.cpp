@@ -0,0 +1,70 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/IdentityElimination.h"
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ops/Transpose.h"
+
+namespace webnn_native { namespace pass {
+
+    namespace {
+        bool IsIdentity(const OperatorBase* op) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::Transpose: {
+                    std::vector<int32_t> permutation =
+                        static_cast<const op::Transpose*>(op)->GetPermutation();
+                    for (size_t i = 0; i < permutation.size(); ++i) {
+                        if (permutation[i] != static_cast<int32_t>(i)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                case OperatorType::Reshape: {
+                    const std::vector<int32_t>& inputShape = op->Inputs()[0]->Shape();
+                    for (auto dim : inputShape) {
+                        if (dim < 0) {
+                            return false;
+                        }
+                    }
+                    return inputShape == op->PrimaryOutput()->Shape();
+                }
+                default:
+                    return false;
+            }
+        }
+    }  // namespace
+
+    ResultOrError<bool> IdentityElimination::Run(PassContext& context) {
+        bool changed = false;
+        for (size_t i = 0; i < context.operators.size(); ++i) {
+            const OperatorBase* op = context.operators[i].Get();
+            if (!IsIdentity(op)) {
+                continue;
+            }
+            const OperandBase* output = op->PrimaryOutput();
+            // The operand bound to a named output is kept, the backend needs an operator to
+            // produce it.
+            if (context.outputs.find(output) != context.outputs.end()) {
+                continue;
+            }
+            ReplaceAllUsesWith(context, i, output, op->Inputs()[0].Get());
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
@@ -0,0 +1,163 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/OperatorFusion.h"
+
+#include "common/Assert.h"
+#include "webnn_native/Context.h"
+#include "webnn_native/FusionRegistry.h"
+#include "webnn_native/GraphBuilder.h"
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ops/BatchNorm.h"
+#include "webnn_native/ops/Binary.h"
+#include "webnn_native/ops/Clamp.h"
+#include "webnn_native/ops/Conv2d.h"
+#include "webnn_native/ops/Gemm.h"
+#include "webnn_native/ops/LeakyRelu.h"
+#include "webnn_native/ops/Unary.h"
+
+namespace webnn_native { namespace pass {
+
+    namespace {
+        // Get the kind of activation computed by |op|, return false if it can't be fused.
+        bool GetActivationType(const OperatorBase* op, FusedOperator& activationType) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::Clamp:
+                    activationType = FusedOperator::Clamp;
+                    return static_cast<const op::Clamp*>(op)->IsClampByValue();
+                case OperatorType::Unary:
+                    switch (static_cast<const op::Unary*>(op)->GetType()) {
+                        case op::UnaryOpType::kRelu:
+                            activationType = FusedOperator::Relu;
+                            return true;
+                        case op::UnaryOpType::kSigmoid:
+                            activationType = FusedOperator::Sigmoid;
+                            return true;
+                        case op::UnaryOpType::kLeakyRelu:
+                            activationType = FusedOperator::LeakyRelu;
+                            return true;
+                        case op::UnaryOpType::kHardSwish:
+                            activationType = FusedOperator::HardSwish;
+                            return true;
+                        default:
+                            return false;
+                    }
+                default:
+                    return false;
+            }
+        }
+
+        // Whether an activation has been fused into |op|.
+        bool HasActivation(const OperatorBase* op) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::BatchNorm:
+                    return static_cast<const op::BatchNorm*>(op)->GetOptions()->activation !=
+                           nullptr;
+                case OperatorType::Binary:
+                    return static_cast<const op::Binary*>(op)->GetActivation() != nullptr;
+                case OperatorType::Conv2d:
+                    return static_cast<const op::Conv2d*>(op)->GetOptions()->activation != nullptr;
+                case OperatorType::Gemm:
+                    return static_cast<const op::Gemm*>(op)->GetActivation() != nullptr;
+                default:
+                    DAWN_UNREACHABLE();
+                    return true;
+            }
+        }
+
+        void SetActivation(OperatorBase* op, OperatorBase* activation) {
+            switch (op->GetOperatorType()) {
+                case OperatorType::BatchNorm:
+                    static_cast<op::BatchNorm*>(op)->SetActivation(activation);
+                    break;
+                case OperatorType::Binary:
+                    static_cast<op::Binary*>(op)->SetActivation(activation);
+                    break;
+                case OperatorType::Conv2d:
+                    static_cast<op::Conv2d*>(op)->SetActivation(activation);
+                    break;
+                case OperatorType::Gemm:
+                    static_cast<op::Gemm*>(op)->SetActivation(activation);
+                    break;
+                default:
+                    DAWN_UNREACHABLE();
+            }
+        }
+
+        // Create the activation in the form that's passed as the option of an operator.
+        Ref<OperatorBase> CreateFusedActivation(GraphBuilderBase* builder,
+                                                const OperatorBase* op,
+                                                FusedOperator activationType) {
+            switch (activationType) {
+                case FusedOperator::Clamp:
+                    return AcquireRef(
+                        new op::Clamp(builder, static_cast<const op::Clamp*>(op)->GetOptions()));
+                case FusedOperator::Relu:
+                    return AcquireRef(
+                        new op::Unary(builder, op::UnaryOpType::kRelu, FusedOperator::Relu));
+                case FusedOperator::Sigmoid:
+                    return AcquireRef(
+                        new op::Unary(builder, op::UnaryOpType::kSigmoid, FusedOperator::Sigmoid));
+                case FusedOperator::LeakyRelu: {
+                    LeakyReluOptions options;
+                    options.alpha = static_cast<const op::LeakyRelu*>(op)->GetAlpha();
+                    return AcquireRef(new op::LeakyRelu(builder, &options));
+                }
+                case FusedOperator::HardSwish:
+                    return AcquireRef(new op::Unary(builder, op::UnaryOpType::kHardSwish,
+                                                    FusedOperator::HardSwish));
+                default:
+                    DAWN_UNREACHABLE();
+                    return nullptr;
+            }
+        }
+    }  // namespace
+
+    ResultOrError<bool> OperatorFusion::Run(PassContext& context) {
+        const FusionRegistry& registry = context.builder->GetContext()->GetFusionRegistry();
+        bool changed = false;
+        for (size_t i = 0; i < context.operators.size(); ++i) {
+            const OperatorBase* op = context.operators[i].Get();
+            FusedOperator activationType;
+            if (!GetActivationType(op, activationType)) {
+                continue;
+            }
+            OperandBase* input = op->Inputs()[0].Get();
+            OperatorBase* producer = const_cast<OperatorBase*>(input->Operator());
+            OperatorType producerType = producer->GetOperatorType();
+            if (producerType != OperatorType::BatchNorm && producerType != OperatorType::Binary &&
+                producerType != OperatorType::Conv2d && producerType != OperatorType::Gemm) {
+                continue;
+            }
+            if (!registry.CanFuse(producerType, activationType) || HasActivation(producer) ||
+                !HasSingleUse(context, input)) {
+                continue;
+            }
+
+            Ref<OperatorBase> activation =
+                CreateFusedActivation(context.builder, op, activationType);
+            SetActivation(producer, activation.Get());
+            // The activation operator is removed by DeadOperatorElimination.
+            const OperandBase* output = op->PrimaryOutput();
+            if (context.outputs.find(output) != context.outputs.end()) {
+                ReplaceOutput(context, output, input);
+            }
+            ReplaceAllUsesWith(context, i, output, input);
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
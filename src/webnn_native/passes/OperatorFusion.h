@@ -0,0 +1,36 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_PASSES_OPERATORFUSION_H_
+#define WEBNN_NATIVE_PASSES_OPERATORFUSION_H_
+
+#include "webnn_native/PassManager.h"
+
+namespace webnn_native { namespace pass {
+
+    // Fuse the activation operators into the preceding operator for the patterns registered in
+    // the FusionRegistry of the context, so the backend computes them in a single kernel without
+    // materializing the intermediate operand. The activation is set on the copies of the build,
+    // so the other builds from the same builder don't see it.
+    class OperatorFusion final : public GraphPass {
+      public:
+        const char* GetName() const override {
+            return "OperatorFusion";
+        }
+        ResultOrError<bool> Run(PassContext& context) override;
+    };
+
+}}  // namespace webnn_native::pass
+
+#endif  // WEBNN_NATIVE_PASSES_OPERATORFUSION_H_
@@ -0,0 +1,53 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/passes/TransposeMerge.h"
+
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ops/Transpose.h"
+
+namespace webnn_native { namespace pass {
+
+    ResultOrError<bool> TransposeMerge::Run(PassContext& context) {
+        bool changed = false;
+        for (auto& op : context.operators) {
+            if (op->GetOperatorType() != OperatorType::Transpose) {
+                continue;
+            }
+            OperandBase* input = op->Inputs()[0].Get();
+            const OperatorBase* producer = input->Operator();
+            if (producer->GetOperatorType() != OperatorType::Transpose) {
+                continue;
+            }
+
+            // The output of the second transpose is output[i] = input[second[i]] and
+            // input[j] = source[first[j]], so output[i] = source[first[second[i]]].
+            auto first = static_cast<const op::Transpose*>(producer);
+            auto second = static_cast<op::Transpose*>(op.Get());
+            std::vector<int32_t> firstPermutation = first->GetPermutation();
+            std::vector<int32_t> secondPermutation = second->GetPermutation();
+            std::vector<int32_t> permutation(secondPermutation.size());
+            for (size_t i = 0; i < secondPermutation.size(); ++i) {
+                permutation[i] = firstPermutation[secondPermutation[i]];
+            }
+            // The first transpose is removed by DeadOperatorElimination if it has no other uses.
+            second->ReplaceInput(input, first->Inputs()[0].Get());
+            second->SetPermutation(std::move(permutation));
+            changed = true;
+        }
+        return changed;
+    }
+
+}}  // namespace webnn_native::pass
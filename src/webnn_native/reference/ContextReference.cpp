@@ -0,0 +1,40 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/reference/ContextReference.h"
+
+#include "common/RefCounted.h"
+#include "webnn_native/reference/GraphReference.h"
+
+namespace webnn_native { namespace reference {
+
+    ContextBase* Create(MLContextOptions const* options) {
+        return new Context(reinterpret_cast<ContextOptions const*>(options));
+    }
+
+    Context::Context(ContextOptions const* options) : ContextBase(options) {
+        // The activations are applied in place on the output of the fused operator.
+        for (auto type : {OperatorType::BatchNorm, OperatorType::Binary, OperatorType::Conv2d,
+                          OperatorType::Gemm}) {
+            mFusionRegistry.Register(type, {FusedOperator::Clamp, FusedOperator::Relu,
+                                            FusedOperator::Sigmoid, FusedOperator::LeakyRelu,
+                                            FusedOperator::HardSwish});
+        }
+    }
+
+    GraphBase* Context::CreateGraphImpl() {
+        return new Graph(this);
+    }
+
+}}  // namespace webnn_native::reference
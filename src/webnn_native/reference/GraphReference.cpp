@@ -0,0 +1,1029 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/reference/GraphReference.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "common/Assert.h"
+#include "common/Log.h"
+#include "webnn_native/Bindings.h"
+#include "webnn_native/ErrorData.h"
+#include "webnn_native/Float16.h"
+#include "webnn_native/NamedInputs.h"
+#include "webnn_native/NamedOutputs.h"
+#include "webnn_native/ShapeUtils.h"
+#include "webnn_native/reference/Kernels.h"
+
+namespace webnn_native { namespace reference {
+
+    namespace {
+
+        // The activation applied in place on the output of an operator. The parameters are
+        // captured by value because the operators don't outlive the graph builder.
+        using Activation = std::function<void(float*, size_t)>;
+
+        Activation MakeActivation(const OperatorBase* activation) {
+            if (activation == nullptr) {
+                return nullptr;
+            }
+            switch (activation->GetFusedOperator()) {
+                case FusedOperator::Clamp: {
+                    auto clamp = static_cast<const op::Clamp*>(activation);
+                    float minValue = clamp->GetMinValue(), maxValue = clamp->GetMaxValue();
+                    return [minValue, maxValue](float* data, size_t size) {
+                        Clamp(data, size, minValue, maxValue);
+                    };
+                }
+                case FusedOperator::Relu:
+                    return Relu;
+                case FusedOperator::Sigmoid:
+                    return Sigmoid;
+                case FusedOperator::LeakyRelu: {
+                    float alpha = static_cast<const op::LeakyRelu*>(activation)->GetAlpha();
+                    return [alpha](float* data, size_t size) { LeakyRelu(data, size, alpha); };
+                }
+                case FusedOperator::HardSwish:
+                    return HardSwish;
+                default:
+                    DAWN_UNREACHABLE();
+            }
+        }
+
+        bool IsStaticShape(const std::vector<int32_t>& shape) {
+            return std::all_of(shape.begin(), shape.end(), [](int32_t d) { return d >= 0; });
+        }
+
+        // The flat index into |shape| of each element of |shape| broadcasted to |outputShape|.
+        std::vector<size_t> BroadcastIndices(const std::vector<int32_t>& shape,
+                                             const std::vector<int32_t>& outputShape) {
+            const size_t size = SizeOfShape(outputShape);
+            const size_t skip = outputShape.size() - shape.size();
+            std::vector<size_t> indices(size);
+            for (size_t i = 0; i < size; ++i) {
+                size_t remaining = i, index = 0, stride = 1;
+                for (size_t d = outputShape.size(); d-- > skip;) {
+                    const size_t coordinate = remaining % outputShape[d];
+                    remaining /= outputShape[d];
+                    const int32_t dimension = shape[d - skip];
+                    if (dimension != 1) {
+                        index += coordinate * stride;
+                    }
+                    stride *= dimension;
+                }
+                indices[i] = index;
+            }
+            return indices;
+        }
+
+        // The product of the dimensions in [begin, end).
+        size_t SizeOfDimensions(const std::vector<int32_t>& shape, size_t begin, size_t end) {
+            size_t size = 1;
+            for (size_t i = begin; i < end; ++i) {
+                size *= shape[i];
+            }
+            return size;
+        }
+
+        bool IsSupportedType(ml::OperandType type) {
+            return type == ml::OperandType::Float32 || type == ml::OperandType::Float16 ||
+                   type == ml::OperandType::Int8 || type == ml::OperandType::Uint8;
+        }
+
+        // Convert the float16, int8 or uint8 values of a buffer to the floats of a tensor and
+        // back.
+        void ReadBuffer(ml::OperandType type, const void* buffer, size_t size, float* output) {
+            if (type == ml::OperandType::Float16) {
+                Float16ToFloat32(static_cast<const uint16_t*>(buffer), output, size);
+            } else if (type == ml::OperandType::Int8) {
+                std::copy_n(static_cast<const int8_t*>(buffer), size, output);
+            } else {
+                std::copy_n(static_cast<const uint8_t*>(buffer), size, output);
+            }
+        }
+        void WriteBuffer(ml::OperandType type, const float* input, size_t size, void* buffer) {
+            if (type == ml::OperandType::Float16) {
+                Float32ToFloat16(input, static_cast<uint16_t*>(buffer), size);
+            } else if (type == ml::OperandType::Int8) {
+                std::transform(input, input + size, static_cast<int8_t*>(buffer),
+                               [](float value) { return static_cast<int8_t>(value); });
+            } else {
+                std::transform(input, input + size, static_cast<uint8_t*>(buffer),
+                               [](float value) { return static_cast<uint8_t>(value); });
+            }
+        }
+
+        // The scales and zero points of each channel along the quantization axis of |shape|,
+        // which is viewed as [outer, channels, inner].
+        struct ChannelQuantization {
+            std::vector<float> scales;
+            std::vector<int32_t> zeroPoints;
+            size_t outer = 1;
+            size_t inner = 1;
+        };
+
+        ChannelQuantization GetChannelQuantization(const Quantization& quantization,
+                                                   const std::vector<int32_t>& shape) {
+            ChannelQuantization channelQuantization;
+            size_t channels = 1;
+            if (quantization.IsPerChannel()) {
+                const size_t axis = quantization.axis;
+                channels = shape[axis];
+                for (size_t i = 0; i < axis; ++i) {
+                    channelQuantization.outer *= shape[i];
+                }
+                for (size_t i = axis + 1; i < shape.size(); ++i) {
+                    channelQuantization.inner *= shape[i];
+                }
+            } else {
+                channelQuantization.inner = SizeOfShape(shape);
+            }
+            for (size_t c = 0; c < channels; ++c) {
+                channelQuantization.scales.push_back(quantization.Scale(c));
+                channelQuantization.zeroPoints.push_back(quantization.ZeroPoint(c));
+            }
+            return channelQuantization;
+        }
+
+        const std::vector<int32_t> kNhwcToNchw = {0, 3, 1, 2};
+        const std::vector<int32_t> kNchwToNhwc = {0, 2, 3, 1};
+
+        std::vector<int32_t> PermuteShape(const std::vector<int32_t>& shape,
+                                          const std::vector<int32_t>& permutation) {
+            std::vector<int32_t> permutedShape(shape.size());
+            for (size_t i = 0; i < shape.size(); ++i) {
+                permutedShape[i] = shape[permutation[i]];
+            }
+            return permutedShape;
+        }
+
+    }  // namespace
+
+    Graph::Graph(Context* context) : GraphBase(context) {
+    }
+
+    bool Graph::UsesMemoryPlan() const {
+        return true;
+    }
+
+    Tensor* Graph::GetTensor(const OperandBase* operand) {
+        DAWN_ASSERT(mTensors.find(operand) != mTensors.end());
+        return &mTensors.at(operand);
+    }
+
+    ResultOrError<Tensor*> Graph::AddIntermediate(const OperandBase* operand) {
+        if (!IsSupportedType(operand->Type())) {
+            return DAWN_UNIMPLEMENTED_ERROR(
+                "The reference backend only supports float32, float16, int8 and uint8.");
+        }
+        if (!IsStaticShape(operand->Shape())) {
+            return DAWN_UNIMPLEMENTED_ERROR("The reference backend requires static shapes.");
+        }
+        Tensor& tensor = mTensors[operand];
+        tensor.kind = Tensor::Kind::Intermediate;
+        tensor.type = operand->Type();
+        tensor.shape = operand->Shape();
+        tensor.size = SizeOfShape(tensor.shape);
+        return &tensor;
+    }
+
+    MaybeError Graph::AddCopy(const OperatorBase* op) {
+        Tensor* input = GetTensor(op->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(op->PrimaryOutput()));
+        mKernels.push_back([input, output]() {
+            memcpy(output->data, input->data, output->size * sizeof(float));
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddConstant(const op::Constant* constant) {
+        const OperandBase* operand = constant->PrimaryOutput();
+        // The int32 constants are the parameters of the operators, e.g. the padding of pad.
+        if (!IsSupportedType(operand->Type()) && operand->Type() != ml::OperandType::Int32) {
+            return DAWN_UNIMPLEMENTED_ERROR("The constant type isn't supported.");
+        }
+        Tensor& tensor = mTensors[operand];
+        tensor.kind = Tensor::Kind::Constant;
+        tensor.type = operand->Type();
+        tensor.shape = operand->Shape();
+        tensor.size = SizeOfShape(tensor.shape);
+        tensor.storage.resize(tensor.size);
+        DAWN_ASSERT(constant->GetByteLength() >=
+                    tensor.size * SizeOfOperandType(operand->Type()));
+        if (operand->Type() == ml::OperandType::Float32 ||
+            operand->Type() == ml::OperandType::Int32) {
+            memcpy(tensor.storage.data(), constant->GetBuffer(), tensor.size * sizeof(float));
+        } else {
+            ReadBuffer(operand->Type(), constant->GetBuffer(), tensor.size,
+                       tensor.storage.data());
+        }
+        tensor.data = tensor.storage.data();
+        return {};
+    }
+
+    MaybeError Graph::AddInput(const op::Input* input) {
+        const OperandBase* operand = input->PrimaryOutput();
+        if (!IsSupportedType(operand->Type())) {
+            return DAWN_UNIMPLEMENTED_ERROR(
+                "The reference backend only supports float32, float16, int8 and uint8.");
+        }
+        if (!IsStaticShape(operand->Shape())) {
+            return DAWN_UNIMPLEMENTED_ERROR("The reference backend requires static shapes.");
+        }
+        Tensor& tensor = mTensors[operand];
+        tensor.kind = Tensor::Kind::Input;
+        tensor.type = operand->Type();
+        tensor.shape = operand->Shape();
+        tensor.size = SizeOfShape(tensor.shape);
+        mInputs[input->GetName()] = &tensor;
+        return {};
+    }
+
+    MaybeError Graph::AddOutput(const std::string& name, const OperandBase* output) {
+        if (mTensors.find(output) == mTensors.end()) {
+            return DAWN_INTERNAL_ERROR("The output operand isn't added to the graph.");
+        }
+        mOutputs[name] = GetTensor(output);
+        return {};
+    }
+
+    MaybeError Graph::AddBatchNorm(const op::BatchNorm* batchNorm) {
+        auto inputs = batchNorm->Inputs();
+        const BatchNormOptions* options = batchNorm->GetOptions();
+        Tensor* input = GetTensor(inputs[0].Get());
+        Tensor* mean = GetTensor(inputs[1].Get());
+        Tensor* variance = GetTensor(inputs[2].Get());
+        Tensor* scale = options->scale != nullptr ? GetTensor(options->scale) : nullptr;
+        Tensor* bias = options->bias != nullptr ? GetTensor(options->bias) : nullptr;
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(batchNorm->PrimaryOutput()));
+        const size_t axis = options->axis;
+        const size_t outer = SizeOfDimensions(input->shape, 0, axis);
+        const size_t channels = input->shape[axis];
+        const size_t inner = SizeOfDimensions(input->shape, axis + 1, input->shape.size());
+        const float epsilon = options->epsilon;
+        Activation activation = MakeActivation(options->activation);
+        std::vector<float> scales(channels), shifts(channels);
+        mKernels.push_back([=]() mutable {
+            for (size_t c = 0; c < channels; ++c) {
+                scales[c] = (scale != nullptr ? scale->data[c] : 1.0f) /
+                            std::sqrt(variance->data[c] + epsilon);
+                shifts[c] = (bias != nullptr ? bias->data[c] : 0.0f) - mean->data[c] * scales[c];
+            }
+            for (size_t o = 0; o < outer; ++o) {
+                const float* src = input->data + o * channels * inner;
+                float* dst = output->data + o * channels * inner;
+                if (inner == 1) {
+                    // The channels are the innermost dimension, e.g. the nhwc layout.
+                    for (size_t c = 0; c < channels; ++c) {
+                        dst[c] = src[c] * scales[c] + shifts[c];
+                    }
+                    continue;
+                }
+                for (size_t c = 0; c < channels; ++c) {
+                    ScaleShift(src + c * inner, scales[c], shifts[c], dst + c * inner, inner);
+                }
+            }
+            if (activation) {
+                activation(output->data, output->size);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddBinary(const op::Binary* binary) {
+        auto inputs = binary->Inputs();
+        Tensor* a = GetTensor(inputs[0].Get());
+        Tensor* b = GetTensor(inputs[1].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(binary->PrimaryOutput()));
+        Activation activation = MakeActivation(binary->GetActivation());
+
+        if (binary->GetType() == op::BinaryOpType::kMatMul) {
+            // The 1-D operands are promoted to matrices, then the batch dimensions are
+            // broadcasted.
+            std::vector<int32_t> aShape = a->shape, bShape = b->shape;
+            if (aShape.size() == 1) {
+                aShape.insert(aShape.begin(), 1);
+            }
+            if (bShape.size() == 1) {
+                bShape.push_back(1);
+            }
+            const size_t m = aShape[aShape.size() - 2];
+            const size_t k = aShape[aShape.size() - 1];
+            const size_t n = bShape[bShape.size() - 1];
+            std::vector<int32_t> aBatch(aShape.begin(), aShape.end() - 2);
+            std::vector<int32_t> bBatch(bShape.begin(), bShape.end() - 2);
+            std::vector<int32_t> batch;
+            if (!BroadcastShapes(aBatch, bBatch, batch)) {
+                return DAWN_VALIDATION_ERROR("The batch dimensions are not broadcastable.");
+            }
+            std::vector<size_t> aIndices = BroadcastIndices(aBatch, batch);
+            std::vector<size_t> bIndices = BroadcastIndices(bBatch, batch);
+            mKernels.push_back([=]() {
+                std::fill(output->data, output->data + output->size, 0.0f);
+                for (size_t i = 0; i < aIndices.size(); ++i) {
+                    Gemm(m, n, k, 1.0f, a->data + aIndices[i] * m * k, false,
+                         b->data + bIndices[i] * k * n, false, output->data + i * m * n);
+                }
+                if (activation) {
+                    activation(output->data, output->size);
+                }
+            });
+            return {};
+        }
+
+        ElementWiseType type;
+        switch (binary->GetType()) {
+            case op::BinaryOpType::kAdd:
+                type = ElementWiseType::kAdd;
+                break;
+            case op::BinaryOpType::kSub:
+                type = ElementWiseType::kSub;
+                break;
+            case op::BinaryOpType::kMul:
+                type = ElementWiseType::kMul;
+                break;
+            case op::BinaryOpType::kDiv:
+                type = ElementWiseType::kDiv;
+                break;
+            case op::BinaryOpType::kMax:
+                type = ElementWiseType::kMax;
+                break;
+            case op::BinaryOpType::kMin:
+                type = ElementWiseType::kMin;
+                break;
+            case op::BinaryOpType::kPower:
+                type = ElementWiseType::kPow;
+                break;
+            default:
+                return DAWN_UNIMPLEMENTED_ERROR("The binary type isn't supported.");
+        }
+        mKernels.push_back([=]() {
+            ElementWise(type, a->data, a->shape, b->data, b->shape, output->data, output->shape);
+            if (activation) {
+                activation(output->data, output->size);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
+        auto inputs = conv2d->Inputs();
+        const Conv2dOptions* options = conv2d->GetOptions();
+        Tensor* input = GetTensor(inputs[0].Get());
+        Tensor* filter = GetTensor(inputs[1].Get());
+        Tensor* bias = options->bias != nullptr ? GetTensor(inputs[2].Get()) : nullptr;
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(conv2d->PrimaryOutput()));
+        Activation activation = MakeActivation(options->activation);
+
+        const bool nhwc = options->inputLayout == ml::InputOperandLayout::Nhwc;
+        const std::vector<int32_t> inputShape =
+            nhwc ? PermuteShape(input->shape, kNhwcToNchw) : input->shape;
+        const std::vector<int32_t> outputShape =
+            nhwc ? PermuteShape(output->shape, kNhwcToNchw) : output->shape;
+        // The filter is transformed to the oihw layout.
+        std::vector<int32_t> filterPermutation;
+        switch (options->filterLayout) {
+            case ml::FilterOperandLayout::Oihw:
+                break;
+            case ml::FilterOperandLayout::Hwio:
+                filterPermutation = {3, 2, 0, 1};
+                break;
+            case ml::FilterOperandLayout::Ohwi:
+                filterPermutation = {0, 3, 1, 2};
+                break;
+            case ml::FilterOperandLayout::Ihwo:
+                filterPermutation = {3, 0, 1, 2};
+                break;
+            default:
+                return DAWN_UNIMPLEMENTED_ERROR("The filter layout isn't supported.");
+        }
+        const std::vector<int32_t> filterShape =
+            filterPermutation.empty() ? filter->shape
+                                      : PermuteShape(filter->shape, filterPermutation);
+
+        const size_t batches = inputShape[0], inputChannels = inputShape[1];
+        const size_t inputHeight = inputShape[2], inputWidth = inputShape[3];
+        const size_t outputChannels = filterShape[0], groupChannels = filterShape[1];
+        const size_t filterHeight = filterShape[2], filterWidth = filterShape[3];
+        const size_t outputHeight = outputShape[2], outputWidth = outputShape[3];
+        const size_t groups = options->groups;
+        const size_t groupOutputChannels = outputChannels / groups;
+        const int32_t strideHeight = options->strides[0], strideWidth = options->strides[1];
+        const int32_t dilationHeight = options->dilations[0];
+        const int32_t dilationWidth = options->dilations[1];
+        int32_t paddingTop = options->padding[0], paddingBottom = options->padding[1];
+        int32_t paddingLeft = options->padding[2], paddingRight = options->padding[3];
+        if (options->autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputShape[2], filterShape[2],
+                                             strideHeight, dilationHeight, paddingTop,
+                                             paddingBottom);
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputShape[3], filterShape[3],
+                                             strideWidth, dilationWidth, paddingLeft,
+                                             paddingRight);
+        }
+        // The input of a 1x1 convolution without stride and padding is already the im2col
+        // matrix.
+        const bool pointwise = filterHeight == 1 && filterWidth == 1 && strideHeight == 1 &&
+                               strideWidth == 1 && paddingTop == 0 && paddingBottom == 0 &&
+                               paddingLeft == 0 && paddingRight == 0;
+        const size_t columnRows = groupChannels * filterHeight * filterWidth;
+        const size_t spatialSize = outputHeight * outputWidth;
+
+        // The scratch buffers are allocated once and reused by every compute.
+        std::vector<float> columns(pointwise ? 0 : columnRows * spatialSize);
+        std::vector<float> nchwInput(nhwc ? input->size : 0);
+        std::vector<float> nchwOutput(nhwc ? output->size : 0);
+        std::vector<float> oihwFilter(filterPermutation.empty() ? 0 : filter->size);
+        bool packFilter = !filterPermutation.empty();
+        if (packFilter && filter->kind == Tensor::Kind::Constant) {
+            // The constant filter is transformed only once.
+            Transpose(filter->data, filter->shape, filterPermutation, oihwFilter.data());
+            packFilter = false;
+        }
+
+        mKernels.push_back([=]() mutable {
+            const float* x = input->data;
+            if (nhwc) {
+                Transpose(x, input->shape, kNhwcToNchw, nchwInput.data());
+                x = nchwInput.data();
+            }
+            if (packFilter) {
+                Transpose(filter->data, filter->shape, filterPermutation, oihwFilter.data());
+            }
+            const float* w = filterPermutation.empty() ? filter->data : oihwFilter.data();
+            float* y = nhwc ? nchwOutput.data() : output->data;
+            for (size_t n = 0; n < batches; ++n) {
+                for (size_t g = 0; g < groups; ++g) {
+                    const float* image =
+                        x + (n * inputChannels + g * groupChannels) * inputHeight * inputWidth;
+                    const float* matrix = image;
+                    if (!pointwise) {
+                        Im2Col(image, groupChannels, inputHeight, inputWidth, filterHeight,
+                               filterWidth, paddingTop, paddingLeft, strideHeight, strideWidth,
+                               dilationHeight, dilationWidth, outputHeight, outputWidth,
+                               columns.data());
+                        matrix = columns.data();
+                    }
+                    float* result =
+                        y + (n * outputChannels + g * groupOutputChannels) * spatialSize;
+                    for (size_t o = 0; o < groupOutputChannels; ++o) {
+                        float value = bias != nullptr ? bias->data[g * groupOutputChannels + o]
+                                                      : 0.0f;
+                        std::fill(result + o * spatialSize, result + (o + 1) * spatialSize,
+                                  value);
+                    }
+                    Gemm(groupOutputChannels, spatialSize, columnRows, 1.0f,
+                         w + g * groupOutputChannels * columnRows, false, matrix, false, result);
+                }
+            }
+            if (activation) {
+                activation(y, output->size);
+            }
+            if (nhwc) {
+                Transpose(y, outputShape, kNchwToNhwc, output->data);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddPad(const op::Pad* pad) {
+        auto inputs = pad->Inputs();
+        Tensor* input = GetTensor(inputs[0].Get());
+        Tensor* padding = GetTensor(inputs[1].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(pad->PrimaryOutput()));
+        // The output shape is static only if the padding is a constant.
+        DAWN_ASSERT(padding->kind == Tensor::Kind::Constant);
+        const int32_t* paddingData = reinterpret_cast<const int32_t*>(padding->data);
+        std::vector<int32_t> paddingBegin(input->shape.size());
+        for (size_t i = 0; i < paddingBegin.size(); ++i) {
+            paddingBegin[i] = paddingData[2 * i];
+        }
+        const ml::PaddingMode mode = pad->GetOptions()->mode;
+        const float value = pad->GetOptions()->value;
+        mKernels.push_back([=]() {
+            Pad(input->data, input->shape, paddingBegin, mode, value, output->data,
+                output->shape);
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddPool2d(const op::Pool2d* pool2d) {
+        Tensor* input = GetTensor(pool2d->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(pool2d->PrimaryOutput()));
+        const Pool2dOptions* options = pool2d->GetOptions();
+        Pool2dKernelType type;
+        switch (pool2d->GetType()) {
+            case op::Pool2dType::kAveragePool2d:
+                type = Pool2dKernelType::kAverage;
+                break;
+            case op::Pool2dType::kL2Pool2d:
+                type = Pool2dKernelType::kL2;
+                break;
+            case op::Pool2dType::kMaxPool2d:
+                type = Pool2dKernelType::kMax;
+                break;
+            default:
+                return DAWN_UNIMPLEMENTED_ERROR("The pool2d type isn't supported.");
+        }
+
+        const bool nhwc = options->layout == ml::InputOperandLayout::Nhwc;
+        const std::vector<int32_t> inputShape =
+            nhwc ? PermuteShape(input->shape, kNhwcToNchw) : input->shape;
+        const std::vector<int32_t> outputShape =
+            nhwc ? PermuteShape(output->shape, kNhwcToNchw) : output->shape;
+        const int32_t inputHeight = inputShape[2], inputWidth = inputShape[3];
+        int32_t windowHeight = inputHeight, windowWidth = inputWidth;
+        if (options->windowDimensions != nullptr) {
+            windowHeight = options->windowDimensions[0];
+            windowWidth = options->windowDimensions[1];
+        }
+        const int32_t strideHeight = options->strides[0], strideWidth = options->strides[1];
+        const int32_t dilationHeight = options->dilations[0];
+        const int32_t dilationWidth = options->dilations[1];
+        int32_t paddingTop = options->padding[0], paddingBottom = options->padding[1];
+        int32_t paddingLeft = options->padding[2], paddingRight = options->padding[3];
+        if (options->autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputHeight, windowHeight,
+                                             strideHeight, dilationHeight, paddingTop,
+                                             paddingBottom);
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputWidth, windowWidth,
+                                             strideWidth, dilationWidth, paddingLeft,
+                                             paddingRight);
+        }
+
+        std::vector<float> nchwInput(nhwc ? input->size : 0);
+        std::vector<float> nchwOutput(nhwc ? output->size : 0);
+        mKernels.push_back([=]() mutable {
+            const float* x = input->data;
+            if (nhwc) {
+                Transpose(x, input->shape, kNhwcToNchw, nchwInput.data());
+                x = nchwInput.data();
+            }
+            float* y = nhwc ? nchwOutput.data() : output->data;
+            Pool2d(type, x, inputShape, windowHeight, windowWidth, paddingTop, paddingLeft,
+                   strideHeight, strideWidth, dilationHeight, dilationWidth, y, outputShape);
+            if (nhwc) {
+                Transpose(y, outputShape, kNchwToNhwc, output->data);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddReduceMean(const op::ReduceMean* reduceMean) {
+        Tensor* input = GetTensor(reduceMean->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(reduceMean->PrimaryOutput()));
+        const ReduceMeanOptions* options = reduceMean->GetOptions();
+        const int32_t rank = input->shape.size();
+        std::vector<bool> reduced(rank, false);
+        for (uint32_t i = 0; i < options->axesCount; ++i) {
+            int32_t axis = options->axes[i];
+            reduced[axis < 0 ? axis + rank : axis] = true;
+        }
+        mKernels.push_back([=]() { ReduceMean(input->data, input->shape, reduced, output->data); });
+        return {};
+    }
+
+    MaybeError Graph::AddResample(const op::Resample* resample) {
+        Tensor* input = GetTensor(resample->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(resample->PrimaryOutput()));
+        const ml::InterpolationMode mode = resample->GetOptions()->mode;
+        // The interpolation is separable, the dimensions are resampled one by one.
+        std::vector<size_t> axes;
+        std::vector<std::vector<int32_t>> shapes;
+        std::vector<int32_t> shape = input->shape;
+        for (size_t axis = 0; axis < shape.size(); ++axis) {
+            if (shape[axis] != output->shape[axis]) {
+                axes.push_back(axis);
+                shapes.push_back(shape);
+                shape[axis] = output->shape[axis];
+            }
+        }
+        std::vector<std::vector<float>> buffers;
+        for (size_t i = 1; i < shapes.size(); ++i) {
+            buffers.emplace_back(SizeOfShape(shapes[i]));
+        }
+        mKernels.push_back([=]() mutable {
+            if (axes.empty()) {
+                memcpy(output->data, input->data, output->size * sizeof(float));
+                return;
+            }
+            const float* src = input->data;
+            for (size_t i = 0; i < axes.size(); ++i) {
+                float* dst = i + 1 == axes.size() ? output->data : buffers[i].data();
+                ResampleAxis(mode, src, shapes[i], axes[i], output->shape[axes[i]], dst);
+                src = dst;
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddReshape(const op::Reshape* reshape) {
+        return AddCopy(reshape);
+    }
+
+    MaybeError Graph::AddSqueeze(const op::Squeeze* squeeze) {
+        return AddCopy(squeeze);
+    }
+
+    MaybeError Graph::AddSplit(const op::Split* split) {
+        Tensor* input = GetTensor(split->Inputs()[0].Get());
+        const int32_t rank = input->shape.size();
+        const size_t axis = split->GetAxis() < 0 ? split->GetAxis() + rank : split->GetAxis();
+        const size_t outer = SizeOfDimensions(input->shape, 0, axis);
+        const size_t inputSlice = SizeOfDimensions(input->shape, axis, rank);
+        std::vector<Tensor*> outputs;
+        for (auto& operand : split->Outputs()) {
+            Tensor* output;
+            DAWN_TRY_ASSIGN(output, AddIntermediate(operand.Get()));
+            outputs.push_back(output);
+        }
+        mKernels.push_back([=]() {
+            size_t offset = 0;
+            for (auto output : outputs) {
+                const size_t slice = output->size / outer;
+                for (size_t o = 0; o < outer; ++o) {
+                    memcpy(output->data + o * slice, input->data + o * inputSlice + offset,
+                           slice * sizeof(float));
+                }
+                offset += slice;
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddTranspose(const op::Transpose* transpose) {
+        Tensor* input = GetTensor(transpose->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(transpose->PrimaryOutput()));
+        const std::vector<int32_t> permutation = transpose->GetPermutation();
+        mKernels.push_back(
+            [=]() { Transpose(input->data, input->shape, permutation, output->data); });
+        return {};
+    }
+
+    MaybeError Graph::AddUnary(const op::Unary* unary) {
+        Tensor* input = GetTensor(unary->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(unary->PrimaryOutput()));
+        Activation activation;
+        switch (unary->GetType()) {
+            case op::UnaryOpType::kRelu:
+                activation = Relu;
+                break;
+            case op::UnaryOpType::kSigmoid:
+                activation = Sigmoid;
+                break;
+            case op::UnaryOpType::kTanh:
+                activation = Tanh;
+                break;
+            case op::UnaryOpType::kHardSwish:
+                activation = HardSwish;
+                break;
+            case op::UnaryOpType::kSoftmax: {
+                // The softmax is computed along the last dimension.
+                const size_t columns = input->shape.back();
+                const size_t rows = input->size / columns;
+                activation = [rows, columns](float* data, size_t) {
+                    Softmax(data, rows, columns);
+                };
+                break;
+            }
+            default:
+                return DAWN_UNIMPLEMENTED_ERROR("The unary type isn't supported.");
+        }
+        mKernels.push_back([=]() {
+            memcpy(output->data, input->data, output->size * sizeof(float));
+            activation(output->data, output->size);
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddLeakyRelu(const op::LeakyRelu* leakyRelu) {
+        Tensor* input = GetTensor(leakyRelu->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(leakyRelu->PrimaryOutput()));
+        const float alpha = leakyRelu->GetAlpha();
+        mKernels.push_back([=]() {
+            memcpy(output->data, input->data, output->size * sizeof(float));
+            LeakyRelu(output->data, output->size, alpha);
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddConcat(const op::Concat* concat) {
+        std::vector<Tensor*> inputs;
+        for (auto& operand : concat->Inputs()) {
+            inputs.push_back(GetTensor(operand.Get()));
+        }
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(concat->PrimaryOutput()));
+        const size_t axis = concat->GetAxis();
+        const size_t outer = SizeOfDimensions(output->shape, 0, axis);
+        const size_t outputSlice = SizeOfDimensions(output->shape, axis, output->shape.size());
+        mKernels.push_back([=]() {
+            size_t offset = 0;
+            for (auto input : inputs) {
+                const size_t slice = input->size / outer;
+                for (size_t o = 0; o < outer; ++o) {
+                    memcpy(output->data + o * outputSlice + offset, input->data + o * slice,
+                           slice * sizeof(float));
+                }
+                offset += slice;
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        auto inputs = gemm->Inputs();
+        const GemmOptions* options = gemm->GetOptions();
+        Tensor* a = GetTensor(inputs[0].Get());
+        Tensor* b = GetTensor(inputs[1].Get());
+        Tensor* c = options->c != nullptr && options->beta != 0.0f ? GetTensor(inputs[2].Get())
+                                                                   : nullptr;
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(gemm->PrimaryOutput()));
+        Activation activation = MakeActivation(gemm->GetActivation());
+        const bool aTranspose = options->aTranspose, bTranspose = options->bTranspose;
+        const size_t m = aTranspose ? a->shape[1] : a->shape[0];
+        const size_t k = aTranspose ? a->shape[0] : a->shape[1];
+        const size_t n = bTranspose ? b->shape[0] : b->shape[1];
+        const float alpha = options->alpha, beta = options->beta;
+        mKernels.push_back([=]() {
+            if (c != nullptr) {
+                Broadcast(c->data, c->shape, output->data, output->shape);
+                ScaleShift(output->data, beta, 0.0f, output->data, output->size);
+            } else {
+                std::fill(output->data, output->data + output->size, 0.0f);
+            }
+            Gemm(m, n, k, alpha, a->data, aTranspose, b->data, bTranspose, output->data);
+            if (activation) {
+                activation(output->data, output->size);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddClamp(const op::Clamp* clamp) {
+        const ClampOptions* options = clamp->GetOptions();
+        Tensor* input = GetTensor(clamp->Inputs()[0].Get());
+        Tensor* minValue = options->minValue != nullptr ? GetTensor(options->minValue) : nullptr;
+        Tensor* maxValue = options->maxValue != nullptr ? GetTensor(options->maxValue) : nullptr;
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(clamp->PrimaryOutput()));
+        // The bounds are broadcasted to the input.
+        mKernels.push_back([=]() {
+            const float* x = input->data;
+            if (minValue != nullptr) {
+                ElementWise(ElementWiseType::kMax, x, input->shape, minValue->data,
+                            minValue->shape, output->data, output->shape);
+                x = output->data;
+            }
+            if (maxValue != nullptr) {
+                ElementWise(ElementWiseType::kMin, x, input->shape, maxValue->data,
+                            maxValue->shape, output->data, output->shape);
+                x = output->data;
+            }
+            if (x != output->data) {
+                memcpy(output->data, x, output->size * sizeof(float));
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddInstanceNorm(const op::InstanceNorm* instanceNorm) {
+        const InstanceNormOptions* options = instanceNorm->GetOptions();
+        Tensor* input = GetTensor(instanceNorm->Inputs()[0].Get());
+        Tensor* scale = options->scale != nullptr ? GetTensor(options->scale) : nullptr;
+        Tensor* bias = options->bias != nullptr ? GetTensor(options->bias) : nullptr;
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(instanceNorm->PrimaryOutput()));
+        const bool nhwc = options->layout == ml::InputOperandLayout::Nhwc;
+        const std::vector<int32_t> shape =
+            nhwc ? PermuteShape(input->shape, kNhwcToNchw) : input->shape;
+        const size_t batches = shape[0], channels = shape[1];
+        const size_t spatialSize = SizeOfDimensions(shape, 2, shape.size());
+        const float epsilon = options->epsilon;
+        std::vector<float> nchwInput(nhwc ? input->size : 0);
+        std::vector<float> nchwOutput(nhwc ? output->size : 0);
+        mKernels.push_back([=]() mutable {
+            const float* x = input->data;
+            if (nhwc) {
+                Transpose(x, input->shape, kNhwcToNchw, nchwInput.data());
+                x = nchwInput.data();
+            }
+            float* y = nhwc ? nchwOutput.data() : output->data;
+            for (size_t n = 0; n < batches; ++n) {
+                for (size_t c = 0; c < channels; ++c) {
+                    const size_t offset = (n * channels + c) * spatialSize;
+                    float mean = 0;
+                    for (size_t i = 0; i < spatialSize; ++i) {
+                        mean += x[offset + i];
+                    }
+                    mean /= spatialSize;
+                    float variance = 0;
+                    for (size_t i = 0; i < spatialSize; ++i) {
+                        const float diff = x[offset + i] - mean;
+                        variance += diff * diff;
+                    }
+                    variance /= spatialSize;
+                    const float factor = (scale != nullptr ? scale->data[c] : 1.0f) /
+                                         std::sqrt(variance + epsilon);
+                    const float shift = (bias != nullptr ? bias->data[c] : 0.0f) - mean * factor;
+                    ScaleShift(x + offset, factor, shift, y + offset, spatialSize);
+                }
+            }
+            if (nhwc) {
+                Transpose(y, shape, kNchwToNhwc, output->data);
+            }
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear) {
+        const OperandBase* operand = quantizeLinear->PrimaryOutput();
+        Tensor* input = GetTensor(quantizeLinear->Inputs()[0].Get());
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(operand));
+        const ChannelQuantization quantization =
+            GetChannelQuantization(operand->GetQuantization(), output->shape);
+        const bool isInt8 = operand->Type() == ml::OperandType::Int8;
+        const float minValue = isInt8 ? -128 : 0, maxValue = isInt8 ? 127 : 255;
+        mKernels.push_back([input, output, quantization, minValue, maxValue]() {
+            QuantizeLinear(input->data, quantization.scales.data(),
+                           quantization.zeroPoints.data(), quantization.outer,
+                           quantization.scales.size(), quantization.inner, minValue, maxValue,
+                           output->data);
+        });
+        return {};
+    }
+
+    MaybeError Graph::AddDequantizeLinear(const op::DequantizeLinear* dequantizeLinear) {
+        const OperandBase* operand = dequantizeLinear->Inputs()[0].Get();
+        Tensor* input = GetTensor(operand);
+        Tensor* output;
+        DAWN_TRY_ASSIGN(output, AddIntermediate(dequantizeLinear->PrimaryOutput()));
+        const ChannelQuantization quantization =
+            GetChannelQuantization(operand->GetQuantization(), input->shape);
+        mKernels.push_back([input, output, quantization]() {
+            DequantizeLinear(input->data, quantization.scales.data(),
+                             quantization.zeroPoints.data(), quantization.outer,
+                             quantization.scales.size(), quantization.inner, output->data);
+        });
+        return {};
+    }
+
+    MaybeError Graph::Finish() {
+        return {};
+    }
+
+    MaybeError Graph::CompileImpl() {
+        // The intermediates in the memory plan share one arena, the offsets are aligned to
+        // kArenaAlignment that is a multiple of the float size. The plan sizes the float16, int8
+        // and uint8 operands by their type, so their float values are stored out of the arena.
+        const MemoryPlan& memoryPlan = GetMemoryPlan();
+        mArena.resize(memoryPlan.GetArenaSize() / sizeof(float));
+        for (auto& tensor : mTensors) {
+            if (tensor.second.kind != Tensor::Kind::Intermediate) {
+                continue;
+            }
+            if (tensor.second.type == ml::OperandType::Float32 &&
+                memoryPlan.HasOffset(tensor.first)) {
+                tensor.second.data =
+                    mArena.data() + memoryPlan.GetOffset(tensor.first) / sizeof(float);
+            } else {
+                tensor.second.storage.resize(tensor.second.size);
+                tensor.second.data = tensor.second.storage.data();
+            }
+        }
+        for (auto& name : GetInputNames()) {
+            mIndexedInputs.push_back(mInputs.at(name));
+        }
+        for (auto& name : GetOutputNames()) {
+            mIndexedOutputs.push_back(mOutputs.at(name));
+        }
+        return {};
+    }
+
+    bool Graph::BindInput(const std::string& name, Tensor* tensor, const Input* input) {
+        const ArrayBufferView& resource = input->resource;
+        if (resource.byteLength < tensor->size * SizeOfOperandType(tensor->type)) {
+            dawn::ErrorLog() << "The buffer of input " << name << " is too small.";
+            return false;
+        }
+        void* buffer = static_cast<int8_t*>(resource.buffer) + resource.byteOffset;
+        if (tensor->type != ml::OperandType::Float32) {
+            tensor->storage.resize(tensor->size);
+            ReadBuffer(tensor->type, buffer, tensor->size, tensor->storage.data());
+            tensor->data = tensor->storage.data();
+            return true;
+        }
+        tensor->data = static_cast<float*>(buffer);
+        return true;
+    }
+
+    void Graph::Run(const std::vector<std::pair<Tensor*, void*>>& outputs) {
+        // The float32 named outputs computed by the graph are written to the user buffers
+        // directly, the others are copied or converted after computing.
+        std::vector<Tensor*> boundOutputs;
+        std::vector<std::pair<const Tensor*, void*>> copiedOutputs;
+        for (auto& output : outputs) {
+            Tensor* tensor = output.first;
+            if (tensor->kind == Tensor::Kind::Intermediate &&
+                tensor->type == ml::OperandType::Float32 &&
+                std::find(boundOutputs.begin(), boundOutputs.end(), tensor) ==
+                    boundOutputs.end()) {
+                tensor->data = static_cast<float*>(output.second);
+                boundOutputs.push_back(tensor);
+            } else {
+                copiedOutputs.emplace_back(tensor, output.second);
+            }
+        }
+
+        for (auto& kernel : mKernels) {
+            kernel();
+        }
+
+        for (auto& output : copiedOutputs) {
+            const Tensor* tensor = output.first;
+            if (tensor->type == ml::OperandType::Float32) {
+                memcpy(output.second, tensor->data, tensor->size * sizeof(float));
+            } else {
+                WriteBuffer(tensor->type, tensor->data, tensor->size, output.second);
+            }
+        }
+        for (auto tensor : boundOutputs) {
+            tensor->data = tensor->storage.data();
+        }
+    }
+
+    MLComputeGraphStatus Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
+        for (auto& input : mInputs) {
+            const Input* record = inputs->Get(input.first.c_str());
+            if (record == nullptr) {
+                dawn::ErrorLog() << "The input " << input.first << " isn't set.";
+                return MLComputeGraphStatus_Error;
+            }
+            if (!BindInput(input.first, input.second, record)) {
+                return MLComputeGraphStatus_Error;
+            }
+        }
+
+        std::vector<std::pair<Tensor*, void*>> boundOutputs;
+        for (auto& output : outputs->GetRecords()) {
+            if (mOutputs.find(output.first) == mOutputs.end()) {
+                dawn::ErrorLog() << "The output " << output.first << " isn't found.";
+                return MLComputeGraphStatus_Error;
+            }
+            void* buffer =
+                static_cast<int8_t*>(output.second->buffer) + output.second->byteOffset;
+            boundOutputs.emplace_back(mOutputs.at(output.first), buffer);
+        }
+        Run(boundOutputs);
+        return MLComputeGraphStatus_Success;
+    }
+
+    MLComputeGraphStatus Graph::ComputeBindingsImpl(BindingsBase* bindings) {
+        // The bindings are validated to bind all the inputs.
+        for (size_t i = 0; i < mIndexedInputs.size(); ++i) {
+            if (!BindInput(GetInputNames()[i], mIndexedInputs[i], bindings->GetInput(i))) {
+                return MLComputeGraphStatus_Error;
+            }
+        }
+
+        std::vector<std::pair<Tensor*, void*>> boundOutputs;
+        boundOutputs.reserve(mIndexedOutputs.size());
+        for (size_t i = 0; i < mIndexedOutputs.size(); ++i) {
+            const ArrayBufferView* resource = bindings->GetOutput(i);
+            if (resource == nullptr) {
+                continue;
+            }
+            void* buffer = static_cast<int8_t*>(resource->buffer) + resource->byteOffset;
+            boundOutputs.emplace_back(mIndexedOutputs[i], buffer);
+        }
+        Run(boundOutputs);
+        return MLComputeGraphStatus_Success;
+    }
+
+}}  // namespace webnn_native::reference
@@ -0,0 +1,133 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_REFERENCE_GRAPH_REFERENCE_H_
+#define WEBNN_NATIVE_REFERENCE_GRAPH_REFERENCE_H_
+
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "webnn_native/Error.h"
+#include "webnn_native/Graph.h"
+#include "webnn_native/Operand.h"
+#include "webnn_native/Operator.h"
+#include "webnn_native/ops/BatchNorm.h"
+#include "webnn_native/ops/Binary.h"
+#include "webnn_native/ops/Clamp.h"
+#include "webnn_native/ops/Concat.h"
+#include "webnn_native/ops/Constant.h"
+#include "webnn_native/ops/Conv2d.h"
+#include "webnn_native/ops/Gemm.h"
+#include "webnn_native/ops/Input.h"
+#include "webnn_native/ops/InstanceNorm.h"
+#include "webnn_native/ops/LeakyRelu.h"
+#include "webnn_native/ops/Pad.h"
+#include "webnn_native/ops/Pool2d.h"
+#include "webnn_native/ops/Quantize.h"
+#include "webnn_native/ops/ReduceMean.h"
+#include "webnn_native/ops/Resample.h"
+#include "webnn_native/ops/Reshape.h"
+#include "webnn_native/ops/Split.h"
+#include "webnn_native/ops/Squeeze.h"
+#include "webnn_native/ops/Transpose.h"
+#include "webnn_native/ops/Unary.h"
+#include "webnn_native/reference/ContextReference.h"
+
+namespace webnn_native { namespace reference {
+
+    // The float32 buffer of an operand, the float16 operands and the quantized values of the int8
+    // and uint8 operands are held as floats that are converted at the boundaries of the graph.
+    struct Tensor {
+        enum class Kind {
+            Constant,
+            Input,
+            Intermediate,
+        };
+
+        Kind kind;
+        ml::OperandType type = ml::OperandType::Float32;
+        std::vector<int32_t> shape;
+        size_t size;
+        // The constants and the intermediates out of the memory plan are stored here, the
+        // intermediates in the plan are bound into the arena at compilation and the inputs and
+        // the named outputs are bound to the user buffers at compute.
+        std::vector<float> storage;
+        float* data = nullptr;
+    };
+
+    class Graph : public GraphBase {
+      public:
+        explicit Graph(Context* context);
+        ~Graph() override = default;
+
+        virtual MaybeError AddConstant(const op::Constant* constant) override;
+        virtual MaybeError AddInput(const op::Input* input) override;
+        virtual MaybeError AddOutput(const std::string& name, const OperandBase* output) override;
+        virtual MaybeError AddBatchNorm(const op::BatchNorm* batchNorm) override;
+        virtual MaybeError AddBinary(const op::Binary* binary) override;
+        virtual MaybeError AddConv2d(const op::Conv2d* conv2d) override;
+        virtual MaybeError AddPad(const op::Pad* pad) override;
+        virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddReduceMean(const op::ReduceMean* reduceMean) override;
+        virtual MaybeError AddResample(const op::Resample* resample) override;
+        virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddSqueeze(const op::Squeeze* squeeze) override;
+        virtual MaybeError AddSplit(const op::Split* split) override;
+        virtual MaybeError AddTranspose(const op::Transpose* transpose) override;
+        virtual MaybeError AddUnary(const op::Unary* unary) override;
+        virtual MaybeError AddLeakyRelu(const op::LeakyRelu* leakyRelu) override;
+        virtual MaybeError AddConcat(const op::Concat* concat) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
+        virtual MaybeError AddClamp(const op::Clamp* clamp) override;
+        virtual MaybeError AddInstanceNorm(const op::InstanceNorm* instanceNorm) override;
+        virtual MaybeError AddQuantizeLinear(const op::QuantizeLinear* quantizeLinear) override;
+        virtual MaybeError AddDequantizeLinear(
+            const op::DequantizeLinear* dequantizeLinear) override;
+        virtual MaybeError Finish() override;
+
+      private:
+        MaybeError CompileImpl() override;
+        MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
+                                         NamedOutputsBase* outputs) override;
+        MLComputeGraphStatus ComputeBindingsImpl(BindingsBase* bindings) override;
+        bool UsesMemoryPlan() const override;
+        bool BindInput(const std::string& name, Tensor* tensor, const Input* input);
+        // Run the kernels with the outputs of the tensors written to the buffers.
+        void Run(const std::vector<std::pair<Tensor*, void*>>& outputs);
+
+        Tensor* GetTensor(const OperandBase* operand);
+        // Create the tensor of an operand that is computed by the graph.
+        ResultOrError<Tensor*> AddIntermediate(const OperandBase* operand);
+        // Copy the input to the output of the same size, e.g. for reshape and squeeze.
+        MaybeError AddCopy(const OperatorBase* op);
+
+        std::unordered_map<const OperandBase*, Tensor> mTensors;
+        std::map<std::string, Tensor*> mInputs;
+        std::map<std::string, Tensor*> mOutputs;
+        // The tensors of the inputs and outputs by the indices of the bindings.
+        std::vector<Tensor*> mIndexedInputs;
+        std::vector<Tensor*> mIndexedOutputs;
+        // The kernels in the topological order, they read the tensor data when they run so that
+        // the inputs and outputs can be rebound for each compute.
+        std::vector<std::function<void()>> mKernels;
+        std::vector<float> mArena;
+    };
+
+}}  // namespace webnn_native::reference
+
+#endif  // WEBNN_NATIVE_REFERENCE_GRAPH_REFERENCE_H_
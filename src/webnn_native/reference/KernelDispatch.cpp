@@ -0,0 +1,194 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/reference/KernelTable.h"
+
+namespace webnn_native { namespace reference {
+
+    namespace {
+
+        const KernelTable& SelectKernelTable() {
+#if defined(WEBNN_REFERENCE_KERNELS_HAVE_AVX2)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return avx2::GetKernelTable();
+            }
+#endif
+            return baseline::GetKernelTable();
+        }
+
+        // The CPU is checked once, at the first kernel call.
+        const KernelTable& GetKernels() {
+            static const KernelTable& table = SelectKernelTable();
+            return table;
+        }
+
+    }  // namespace
+
+    void ElementWise(ElementWiseType type,
+                     const float* a,
+                     const std::vector<int32_t>& aShape,
+                     const float* b,
+                     const std::vector<int32_t>& bShape,
+                     float* output,
+                     const std::vector<int32_t>& outputShape) {
+        GetKernels().elementWise(type, a, aShape, b, bShape, output, outputShape);
+    }
+
+    void Broadcast(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   float* output,
+                   const std::vector<int32_t>& outputShape) {
+        GetKernels().broadcast(input, inputShape, output, outputShape);
+    }
+
+    void ScaleShift(const float* input, float scale, float shift, float* output, size_t size) {
+        GetKernels().scaleShift(input, scale, shift, output, size);
+    }
+
+    void Relu(float* data, size_t size) {
+        GetKernels().relu(data, size);
+    }
+
+    void Clamp(float* data, size_t size, float minValue, float maxValue) {
+        GetKernels().clamp(data, size, minValue, maxValue);
+    }
+
+    void LeakyRelu(float* data, size_t size, float alpha) {
+        GetKernels().leakyRelu(data, size, alpha);
+    }
+
+    void HardSwish(float* data, size_t size) {
+        GetKernels().hardSwish(data, size);
+    }
+
+    void Sigmoid(float* data, size_t size) {
+        GetKernels().sigmoid(data, size);
+    }
+
+    void Tanh(float* data, size_t size) {
+        GetKernels().tanh(data, size);
+    }
+
+    void Softmax(float* data, size_t rows, size_t columns) {
+        GetKernels().softmax(data, rows, columns);
+    }
+
+    void Gemm(size_t m,
+              size_t n,
+              size_t k,
+              float alpha,
+              const float* a,
+              bool aTranspose,
+              const float* b,
+              bool bTranspose,
+              float* c) {
+        GetKernels().gemm(m, n, k, alpha, a, aTranspose, b, bTranspose, c);
+    }
+
+    void Transpose(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   const std::vector<int32_t>& permutation,
+                   float* output) {
+        GetKernels().transpose(input, inputShape, permutation, output);
+    }
+
+    void Im2Col(const float* input,
+                size_t channels,
+                size_t height,
+                size_t width,
+                size_t kernelHeight,
+                size_t kernelWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                size_t outputHeight,
+                size_t outputWidth,
+                float* columns) {
+        GetKernels().im2Col(input, channels, height, width, kernelHeight, kernelWidth, paddingTop,
+                            paddingLeft, strideHeight, strideWidth, dilationHeight, dilationWidth,
+                            outputHeight, outputWidth, columns);
+    }
+
+    void Pool2d(Pool2dKernelType type,
+                const float* input,
+                const std::vector<int32_t>& inputShape,
+                size_t windowHeight,
+                size_t windowWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                float* output,
+                const std::vector<int32_t>& outputShape) {
+        GetKernels().pool2d(type, input, inputShape, windowHeight, windowWidth, paddingTop,
+                            paddingLeft, strideHeight, strideWidth, dilationHeight, dilationWidth,
+                            output, outputShape);
+    }
+
+    void Pad(const float* input,
+             const std::vector<int32_t>& inputShape,
+             const std::vector<int32_t>& paddingBegin,
+             ml::PaddingMode mode,
+             float value,
+             float* output,
+             const std::vector<int32_t>& outputShape) {
+        GetKernels().pad(input, inputShape, paddingBegin, mode, value, output, outputShape);
+    }
+
+    void ReduceMean(const float* input,
+                    const std::vector<int32_t>& inputShape,
+                    const std::vector<bool>& reduced,
+                    float* output) {
+        GetKernels().reduceMean(input, inputShape, reduced, output);
+    }
+
+    void QuantizeLinear(const float* input,
+                        const float* scales,
+                        const int32_t* zeroPoints,
+                        size_t outer,
+                        size_t channels,
+                        size_t inner,
+                        float minValue,
+                        float maxValue,
+                        float* output) {
+        GetKernels().quantizeLinear(input, scales, zeroPoints, outer, channels, inner, minValue,
+                                    maxValue, output);
+    }
+
+    void DequantizeLinear(const float* input,
+                          const float* scales,
+                          const int32_t* zeroPoints,
+                          size_t outer,
+                          size_t channels,
+                          size_t inner,
+                          float* output) {
+        GetKernels().dequantizeLinear(input, scales, zeroPoints, outer, channels, inner, output);
+    }
+
+    void ResampleAxis(ml::InterpolationMode mode,
+                      const float* input,
+                      const std::vector<int32_t>& inputShape,
+                      size_t axis,
+                      int32_t outputSize,
+                      float* output) {
+        GetKernels().resampleAxis(mode, input, inputShape, axis, outputSize, output);
+    }
+
+}}  // namespace webnn_native::reference
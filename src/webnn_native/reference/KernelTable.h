@@ -0,0 +1,59 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_REFERENCE_KERNEL_TABLE_H_
+#define WEBNN_NATIVE_REFERENCE_KERNEL_TABLE_H_
+
+#include "webnn_native/reference/Kernels.h"
+
+namespace webnn_native { namespace reference {
+
+    // The kernels compiled for one instruction set. Kernels.cpp is compiled for the baseline of
+    // the target and again with AVX2 and FMA on x86, the functions of Kernels.h call the table
+    // of the best instruction set that the CPU supports.
+    struct KernelTable {
+        decltype(&ElementWise) elementWise;
+        decltype(&Broadcast) broadcast;
+        decltype(&ScaleShift) scaleShift;
+        decltype(&Relu) relu;
+        decltype(&Clamp) clamp;
+        decltype(&LeakyRelu) leakyRelu;
+        decltype(&HardSwish) hardSwish;
+        decltype(&Sigmoid) sigmoid;
+        decltype(&Tanh) tanh;
+        decltype(&Softmax) softmax;
+        decltype(&Gemm) gemm;
+        decltype(&Transpose) transpose;
+        decltype(&Im2Col) im2Col;
+        decltype(&Pool2d) pool2d;
+        decltype(&Pad) pad;
+        decltype(&ReduceMean) reduceMean;
+        decltype(&QuantizeLinear) quantizeLinear;
+        decltype(&DequantizeLinear) dequantizeLinear;
+        decltype(&ResampleAxis) resampleAxis;
+    };
+
+    namespace baseline {
+        const KernelTable& GetKernelTable();
+    }  // namespace baseline
+
+#if defined(WEBNN_REFERENCE_KERNELS_HAVE_AVX2)
+    namespace avx2 {
+        const KernelTable& GetKernelTable();
+    }  // namespace avx2
+#endif
+
+}}  // namespace webnn_native::reference
+
+#endif  // WEBNN_NATIVE_REFERENCE_KERNEL_TABLE_H_
@@ -0,0 +1,893 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn_native/reference/Kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/Assert.h"
+#include "webnn_native/reference/KernelTable.h"
+
+// The file is compiled once for each instruction set of KernelTable.h, the kernels are defined
+// in the namespace of the instruction set.
+#if defined(WEBNN_REFERENCE_KERNELS_AVX2)
+#    define WEBNN_REFERENCE_KERNELS_ISA avx2
+#else
+#    define WEBNN_REFERENCE_KERNELS_ISA baseline
+#endif
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define WEBNN_REFERENCE_SIMD
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define WEBNN_REFERENCE_SIMD
+#endif
+
+namespace webnn_native { namespace reference { namespace WEBNN_REFERENCE_KERNELS_ISA {
+
+    namespace {
+
+#if defined(__AVX2__)
+        using Vec = __m256;
+        constexpr size_t kLanes = 8;
+        inline Vec Load(const float* p) {
+            return _mm256_loadu_ps(p);
+        }
+        inline void Store(float* p, Vec v) {
+            _mm256_storeu_ps(p, v);
+        }
+        inline Vec Set(float v) {
+            return _mm256_set1_ps(v);
+        }
+        inline Vec Add(Vec a, Vec b) {
+            return _mm256_add_ps(a, b);
+        }
+        inline Vec Sub(Vec a, Vec b) {
+            return _mm256_sub_ps(a, b);
+        }
+        inline Vec Mul(Vec a, Vec b) {
+            return _mm256_mul_ps(a, b);
+        }
+        inline Vec Div(Vec a, Vec b) {
+            return _mm256_div_ps(a, b);
+        }
+        inline Vec Max(Vec a, Vec b) {
+            return _mm256_max_ps(a, b);
+        }
+        inline Vec Min(Vec a, Vec b) {
+            return _mm256_min_ps(a, b);
+        }
+        // a * b + c
+        inline Vec MulAdd(Vec a, Vec b, Vec c) {
+#    if defined(__FMA__)
+            return _mm256_fmadd_ps(a, b, c);
+#    else
+            return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#    endif
+        }
+#elif defined(WEBNN_REFERENCE_SIMD)
+        using Vec = __m128;
+        constexpr size_t kLanes = 4;
+        inline Vec Load(const float* p) {
+            return _mm_loadu_ps(p);
+        }
+        inline void Store(float* p, Vec v) {
+            _mm_storeu_ps(p, v);
+        }
+        inline Vec Set(float v) {
+            return _mm_set1_ps(v);
+        }
+        inline Vec Add(Vec a, Vec b) {
+            return _mm_add_ps(a, b);
+        }
+        inline Vec Sub(Vec a, Vec b) {
+            return _mm_sub_ps(a, b);
+        }
+        inline Vec Mul(Vec a, Vec b) {
+            return _mm_mul_ps(a, b);
+        }
+        inline Vec Div(Vec a, Vec b) {
+            return _mm_div_ps(a, b);
+        }
+        inline Vec Max(Vec a, Vec b) {
+            return _mm_max_ps(a, b);
+        }
+        inline Vec Min(Vec a, Vec b) {
+            return _mm_min_ps(a, b);
+        }
+        inline Vec MulAdd(Vec a, Vec b, Vec c) {
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+        }
+#endif
+
+        struct AddOp {
+            static float Apply(float a, float b) {
+                return a + b;
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Add(a, b);
+            }
+#endif
+        };
+
+        struct SubOp {
+            static float Apply(float a, float b) {
+                return a - b;
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Sub(a, b);
+            }
+#endif
+        };
+
+        struct MulOp {
+            static float Apply(float a, float b) {
+                return a * b;
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Mul(a, b);
+            }
+#endif
+        };
+
+        struct DivOp {
+            static float Apply(float a, float b) {
+                return a / b;
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Div(a, b);
+            }
+#endif
+        };
+
+        struct MaxOp {
+            static float Apply(float a, float b) {
+                return std::max(a, b);
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Max(a, b);
+            }
+#endif
+        };
+
+        struct MinOp {
+            static float Apply(float a, float b) {
+                return std::min(a, b);
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            static Vec Apply(Vec a, Vec b) {
+                return Min(a, b);
+            }
+#endif
+        };
+
+        struct PowOp {
+            static float Apply(float a, float b) {
+                return std::pow(a, b);
+            }
+#if defined(WEBNN_REFERENCE_SIMD)
+            // There is no vector pow, compute the lanes one by one.
+            static Vec Apply(Vec a, Vec b) {
+                float x[kLanes], y[kLanes];
+                Store(x, a);
+                Store(y, b);
+                for (size_t i = 0; i < kLanes; ++i) {
+                    x[i] = std::pow(x[i], y[i]);
+                }
+                return Load(x);
+            }
+#endif
+        };
+
+        size_t SizeOf(const std::vector<int32_t>& shape) {
+            size_t size = 1;
+            for (auto dimension : shape) {
+                size *= dimension;
+            }
+            return size;
+        }
+
+        std::vector<size_t> Strides(const std::vector<int32_t>& shape) {
+            std::vector<size_t> strides(shape.size());
+            size_t stride = 1;
+            for (size_t i = shape.size(); i-- > 0;) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            return strides;
+        }
+
+        // The strides of |shape| broadcasted to |outputShape|, the broadcasted dimensions have
+        // zero stride.
+        std::vector<size_t> BroadcastStrides(const std::vector<int32_t>& shape,
+                                             const std::vector<int32_t>& outputShape) {
+            DAWN_ASSERT(shape.size() <= outputShape.size());
+            const std::vector<size_t> strides = Strides(shape);
+            const size_t skip = outputShape.size() - shape.size();
+            std::vector<size_t> broadcastStrides(outputShape.size(), 0);
+            for (size_t i = 0; i < shape.size(); ++i) {
+                broadcastStrides[skip + i] = shape[i] == 1 ? 0 : strides[i];
+            }
+            return broadcastStrides;
+        }
+
+        // Call |function(aOffset, aBroadcast, bOffset, bBroadcast, outputOffset, size)| for each
+        // innermost row of |outputShape|. A broadcasted row repeats its first element.
+        template <typename Function>
+        void ForEachRow(const std::vector<int32_t>& aShape,
+                        const std::vector<int32_t>& bShape,
+                        const std::vector<int32_t>& outputShape,
+                        Function function) {
+            const size_t total = SizeOf(outputShape);
+            if (total == 0) {
+                return;
+            }
+            if (aShape == outputShape && bShape == outputShape) {
+                function(0, false, 0, false, 0, total);
+                return;
+            }
+            if (aShape == outputShape && SizeOf(bShape) == 1) {
+                function(0, false, 0, true, 0, total);
+                return;
+            }
+            if (bShape == outputShape && SizeOf(aShape) == 1) {
+                function(0, true, 0, false, 0, total);
+                return;
+            }
+            const size_t rank = outputShape.size();
+            const std::vector<size_t> aStrides = BroadcastStrides(aShape, outputShape);
+            const std::vector<size_t> bStrides = BroadcastStrides(bShape, outputShape);
+            const size_t inner = outputShape[rank - 1];
+            const bool aBroadcast = aStrides[rank - 1] == 0;
+            const bool bBroadcast = bStrides[rank - 1] == 0;
+            std::vector<int32_t> index(rank, 0);
+            size_t aOffset = 0, bOffset = 0;
+            for (size_t outputOffset = 0; outputOffset < total; outputOffset += inner) {
+                function(aOffset, aBroadcast, bOffset, bBroadcast, outputOffset, inner);
+                for (size_t d = rank - 1; d-- > 0;) {
+                    aOffset += aStrides[d];
+                    bOffset += bStrides[d];
+                    if (++index[d] < outputShape[d]) {
+                        break;
+                    }
+                    aOffset -= aStrides[d] * outputShape[d];
+                    bOffset -= bStrides[d] * outputShape[d];
+                    index[d] = 0;
+                }
+            }
+        }
+
+        template <typename Op>
+        void ElementWiseRow(const float* a,
+                            bool aBroadcast,
+                            const float* b,
+                            bool bBroadcast,
+                            float* output,
+                            size_t size) {
+            size_t i = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+            const Vec aScalar = Set(a[0]);
+            const Vec bScalar = Set(b[0]);
+            for (; i + kLanes <= size; i += kLanes) {
+                const Vec va = aBroadcast ? aScalar : Load(a + i);
+                const Vec vb = bBroadcast ? bScalar : Load(b + i);
+                Store(output + i, Op::Apply(va, vb));
+            }
+#endif
+            for (; i < size; ++i) {
+                output[i] = Op::Apply(aBroadcast ? a[0] : a[i], bBroadcast ? b[0] : b[i]);
+            }
+        }
+
+        template <typename Op>
+        void ElementWiseImpl(const float* a,
+                             const std::vector<int32_t>& aShape,
+                             const float* b,
+                             const std::vector<int32_t>& bShape,
+                             float* output,
+                             const std::vector<int32_t>& outputShape) {
+            ForEachRow(aShape, bShape, outputShape,
+                       [&](size_t aOffset, bool aBroadcast, size_t bOffset, bool bBroadcast,
+                           size_t outputOffset, size_t size) {
+                           ElementWiseRow<Op>(a + aOffset, aBroadcast, b + bOffset, bBroadcast,
+                                              output + outputOffset, size);
+                       });
+        }
+
+        // The rows of the register block of the gemm micro kernel.
+        constexpr size_t kGemmRows = 4;
+        // The panel of b that is multiplied with all the rows of a, 128 KB.
+        constexpr size_t kGemmBlockK = 128;
+        constexpr size_t kGemmBlockN = 256;
+
+        // c[0:kRows, 0:n] += alpha * a[0:kRows, 0:k] * b[0:k, 0:n], the element (i, p) of a is
+        // a[i * aRowStride + p * aColumnStride].
+        template <size_t kRows>
+        void GemmMicroKernel(size_t n,
+                             size_t k,
+                             float alpha,
+                             const float* a,
+                             size_t aRowStride,
+                             size_t aColumnStride,
+                             const float* b,
+                             size_t ldb,
+                             float* c,
+                             size_t ldc) {
+            size_t j = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+            const Vec va = Set(alpha);
+            for (; j + kLanes <= n; j += kLanes) {
+                Vec sum[kRows];
+                for (size_t r = 0; r < kRows; ++r) {
+                    sum[r] = Set(0.0f);
+                }
+                for (size_t p = 0; p < k; ++p) {
+                    const Vec vb = Load(b + p * ldb + j);
+                    for (size_t r = 0; r < kRows; ++r) {
+                        sum[r] = MulAdd(Set(a[r * aRowStride + p * aColumnStride]), vb, sum[r]);
+                    }
+                }
+                for (size_t r = 0; r < kRows; ++r) {
+                    Store(c + r * ldc + j, MulAdd(va, sum[r], Load(c + r * ldc + j)));
+                }
+            }
+#endif
+            for (; j < n; ++j) {
+                float sum[kRows] = {};
+                for (size_t p = 0; p < k; ++p) {
+                    const float vb = b[p * ldb + j];
+                    for (size_t r = 0; r < kRows; ++r) {
+                        sum[r] += a[r * aRowStride + p * aColumnStride] * vb;
+                    }
+                }
+                for (size_t r = 0; r < kRows; ++r) {
+                    c[r * ldc + j] += alpha * sum[r];
+                }
+            }
+        }
+
+    }  // namespace
+
+    void ElementWise(ElementWiseType type,
+                     const float* a,
+                     const std::vector<int32_t>& aShape,
+                     const float* b,
+                     const std::vector<int32_t>& bShape,
+                     float* output,
+                     const std::vector<int32_t>& outputShape) {
+        switch (type) {
+            case ElementWiseType::kAdd:
+                ElementWiseImpl<AddOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kSub:
+                ElementWiseImpl<SubOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kMul:
+                ElementWiseImpl<MulOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kDiv:
+                ElementWiseImpl<DivOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kMax:
+                ElementWiseImpl<MaxOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kMin:
+                ElementWiseImpl<MinOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            case ElementWiseType::kPow:
+                ElementWiseImpl<PowOp>(a, aShape, b, bShape, output, outputShape);
+                break;
+            default:
+                DAWN_UNREACHABLE();
+        }
+    }
+
+    void Broadcast(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   float* output,
+                   const std::vector<int32_t>& outputShape) {
+        ForEachRow(inputShape, inputShape, outputShape,
+                   [&](size_t offset, bool broadcast, size_t, bool, size_t outputOffset,
+                       size_t size) {
+                       if (broadcast) {
+                           std::fill(output + outputOffset, output + outputOffset + size,
+                                     input[offset]);
+                       } else {
+                           memcpy(output + outputOffset, input + offset, size * sizeof(float));
+                       }
+                   });
+    }
+
+    void ScaleShift(const float* input, float scale, float shift, float* output, size_t size) {
+        size_t i = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+        const Vec vScale = Set(scale);
+        const Vec vShift = Set(shift);
+        for (; i + kLanes <= size; i += kLanes) {
+            Store(output + i, MulAdd(Load(input + i), vScale, vShift));
+        }
+#endif
+        for (; i < size; ++i) {
+            output[i] = input[i] * scale + shift;
+        }
+    }
+
+    void Clamp(float* data, size_t size, float minValue, float maxValue) {
+        size_t i = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+        const Vec vMin = Set(minValue);
+        const Vec vMax = Set(maxValue);
+        for (; i + kLanes <= size; i += kLanes) {
+            Store(data + i, Min(Max(Load(data + i), vMin), vMax));
+        }
+#endif
+        for (; i < size; ++i) {
+            data[i] = std::min(std::max(data[i], minValue), maxValue);
+        }
+    }
+
+    void Relu(float* data, size_t size) {
+        Clamp(data, size, 0.0f, std::numeric_limits<float>::infinity());
+    }
+
+    void LeakyRelu(float* data, size_t size, float alpha) {
+        size_t i = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+        const Vec vAlpha = Set(alpha);
+        const Vec vZero = Set(0.0f);
+        for (; i + kLanes <= size; i += kLanes) {
+            const Vec x = Load(data + i);
+            Store(data + i, MulAdd(vAlpha, Min(x, vZero), Max(x, vZero)));
+        }
+#endif
+        for (; i < size; ++i) {
+            data[i] = data[i] > 0 ? data[i] : alpha * data[i];
+        }
+    }
+
+    void HardSwish(float* data, size_t size) {
+        size_t i = 0;
+#if defined(WEBNN_REFERENCE_SIMD)
+        const Vec vZero = Set(0.0f);
+        const Vec vThree = Set(3.0f);
+        const Vec vSix = Set(6.0f);
+        for (; i + kLanes <= size; i += kLanes) {
+            const Vec x = Load(data + i);
+            Store(data + i, Div(Mul(x, Min(Max(Add(x, vThree), vZero), vSix)), vSix));
+        }
+#endif
+        for (; i < size; ++i) {
+            data[i] = data[i] * std::min(std::max(data[i] + 3.0f, 0.0f), 6.0f) / 6.0f;
+        }
+    }
+
+    void Sigmoid(float* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = 1.0f / (1.0f + std::exp(-data[i]));
+        }
+    }
+
+    void Tanh(float* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = std::tanh(data[i]);
+        }
+    }
+
+    void Softmax(float* data, size_t rows, size_t columns) {
+        for (size_t i = 0; i < rows; ++i) {
+            float* row = data + i * columns;
+            const float maxValue = *std::max_element(row, row + columns);
+            float sum = 0;
+            for (size_t j = 0; j < columns; ++j) {
+                row[j] = std::exp(row[j] - maxValue);
+                sum += row[j];
+            }
+            ScaleShift(row, 1.0f / sum, 0.0f, row, columns);
+        }
+    }
+
+    void Gemm(size_t m,
+              size_t n,
+              size_t k,
+              float alpha,
+              const float* a,
+              bool aTranspose,
+              const float* b,
+              bool bTranspose,
+              float* c) {
+        const size_t aRowStride = aTranspose ? 1 : k;
+        const size_t aColumnStride = aTranspose ? m : 1;
+        // The transposed b is packed block by block so that the micro kernel always reads the
+        // rows of b contiguously.
+        std::vector<float> packed;
+        if (bTranspose) {
+            packed.resize(std::min(k, kGemmBlockK) * std::min(n, kGemmBlockN));
+        }
+        for (size_t k0 = 0; k0 < k; k0 += kGemmBlockK) {
+            const size_t kc = std::min(kGemmBlockK, k - k0);
+            for (size_t j0 = 0; j0 < n; j0 += kGemmBlockN) {
+                const size_t nc = std::min(kGemmBlockN, n - j0);
+                const float* panel = b + k0 * n + j0;
+                size_t ldb = n;
+                if (bTranspose) {
+                    for (size_t p = 0; p < kc; ++p) {
+                        for (size_t j = 0; j < nc; ++j) {
+                            packed[p * nc + j] = b[(j0 + j) * k + k0 + p];
+                        }
+                    }
+                    panel = packed.data();
+                    ldb = nc;
+                }
+                const float* aPanel = a + k0 * aColumnStride;
+                size_t i = 0;
+                for (; i + kGemmRows <= m; i += kGemmRows) {
+                    GemmMicroKernel<kGemmRows>(nc, kc, alpha, aPanel + i * aRowStride,
+                                               aRowStride, aColumnStride, panel, ldb,
+                                               c + i * n + j0, n);
+                }
+                for (; i < m; ++i) {
+                    GemmMicroKernel<1>(nc, kc, alpha, aPanel + i * aRowStride, aRowStride,
+                                       aColumnStride, panel, ldb, c + i * n + j0, n);
+                }
+            }
+        }
+    }
+
+    void Transpose(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   const std::vector<int32_t>& permutation,
+                   float* output) {
+        const size_t rank = inputShape.size();
+        const size_t total = SizeOf(inputShape);
+        if (rank == 0 || total == 0) {
+            if (total != 0) {
+                output[0] = input[0];
+            }
+            return;
+        }
+        const std::vector<size_t> inputStrides = Strides(inputShape);
+        std::vector<int32_t> outputShape(rank);
+        std::vector<size_t> strides(rank);
+        for (size_t i = 0; i < rank; ++i) {
+            outputShape[i] = inputShape[permutation[i]];
+            strides[i] = inputStrides[permutation[i]];
+        }
+        const size_t inner = outputShape[rank - 1];
+        const size_t innerStride = strides[rank - 1];
+        std::vector<int32_t> index(rank, 0);
+        size_t inputOffset = 0;
+        for (size_t outputOffset = 0; outputOffset < total; outputOffset += inner) {
+            if (innerStride == 1) {
+                memcpy(output + outputOffset, input + inputOffset, inner * sizeof(float));
+            } else {
+                for (size_t i = 0; i < inner; ++i) {
+                    output[outputOffset + i] = input[inputOffset + i * innerStride];
+                }
+            }
+            for (size_t d = rank - 1; d-- > 0;) {
+                inputOffset += strides[d];
+                if (++index[d] < outputShape[d]) {
+                    break;
+                }
+                inputOffset -= strides[d] * outputShape[d];
+                index[d] = 0;
+            }
+        }
+    }
+
+    void Im2Col(const float* input,
+                size_t channels,
+                size_t height,
+                size_t width,
+                size_t kernelHeight,
+                size_t kernelWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                size_t outputHeight,
+                size_t outputWidth,
+                float* columns) {
+        for (size_t c = 0; c < channels; ++c) {
+            const float* image = input + c * height * width;
+            for (size_t kh = 0; kh < kernelHeight; ++kh) {
+                for (size_t kw = 0; kw < kernelWidth; ++kw) {
+                    for (size_t oh = 0; oh < outputHeight; ++oh) {
+                        const int64_t ih =
+                            static_cast<int64_t>(oh * strideHeight + kh * dilationHeight) -
+                            paddingTop;
+                        if (ih < 0 || ih >= static_cast<int64_t>(height)) {
+                            std::fill(columns, columns + outputWidth, 0.0f);
+                            columns += outputWidth;
+                            continue;
+                        }
+                        const float* row = image + ih * width;
+                        for (size_t ow = 0; ow < outputWidth; ++ow) {
+                            const int64_t iw =
+                                static_cast<int64_t>(ow * strideWidth + kw * dilationWidth) -
+                                paddingLeft;
+                            *columns++ =
+                                iw < 0 || iw >= static_cast<int64_t>(width) ? 0.0f : row[iw];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void Pool2d(Pool2dKernelType type,
+                const float* input,
+                const std::vector<int32_t>& inputShape,
+                size_t windowHeight,
+                size_t windowWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                float* output,
+                const std::vector<int32_t>& outputShape) {
+        const size_t planes = inputShape[0] * inputShape[1];
+        const int64_t height = inputShape[2], width = inputShape[3];
+        const size_t outputHeight = outputShape[2], outputWidth = outputShape[3];
+        for (size_t plane = 0; plane < planes; ++plane) {
+            const float* image = input + plane * height * width;
+            for (size_t oh = 0; oh < outputHeight; ++oh) {
+                for (size_t ow = 0; ow < outputWidth; ++ow) {
+                    float value = type == Pool2dKernelType::kMax
+                                      ? std::numeric_limits<float>::lowest()
+                                      : 0.0f;
+                    size_t count = 0;
+                    for (size_t kh = 0; kh < windowHeight; ++kh) {
+                        const int64_t ih =
+                            static_cast<int64_t>(oh * strideHeight + kh * dilationHeight) -
+                            paddingTop;
+                        if (ih < 0 || ih >= height) {
+                            continue;
+                        }
+                        for (size_t kw = 0; kw < windowWidth; ++kw) {
+                            const int64_t iw =
+                                static_cast<int64_t>(ow * strideWidth + kw * dilationWidth) -
+                                paddingLeft;
+                            if (iw < 0 || iw >= width) {
+                                continue;
+                            }
+                            const float x = image[ih * width + iw];
+                            switch (type) {
+                                case Pool2dKernelType::kAverage:
+                                    value += x;
+                                    break;
+                                case Pool2dKernelType::kL2:
+                                    value += x * x;
+                                    break;
+                                case Pool2dKernelType::kMax:
+                                    value = std::max(value, x);
+                                    break;
+                            }
+                            ++count;
+                        }
+                    }
+                    if (count == 0) {
+                        value = 0.0f;
+                    } else if (type == Pool2dKernelType::kAverage) {
+                        value /= count;
+                    } else if (type == Pool2dKernelType::kL2) {
+                        value = std::sqrt(value);
+                    }
+                    *output++ = value;
+                }
+            }
+        }
+    }
+
+    void Pad(const float* input,
+             const std::vector<int32_t>& inputShape,
+             const std::vector<int32_t>& paddingBegin,
+             ml::PaddingMode mode,
+             float value,
+             float* output,
+             const std::vector<int32_t>& outputShape) {
+        const size_t rank = inputShape.size();
+        const size_t total = SizeOf(outputShape);
+        const std::vector<size_t> inputStrides = Strides(inputShape);
+        std::vector<int32_t> index(rank, 0);
+        for (size_t outputOffset = 0; outputOffset < total; ++outputOffset) {
+            size_t inputOffset = 0;
+            bool padded = false;
+            for (size_t d = 0; d < rank; ++d) {
+                const int32_t size = inputShape[d];
+                int32_t i = index[d] - paddingBegin[d];
+                if (i < 0 || i >= size) {
+                    switch (mode) {
+                        case ml::PaddingMode::Constant:
+                            padded = true;
+                            break;
+                        case ml::PaddingMode::Edge:
+                            i = i < 0 ? 0 : size - 1;
+                            break;
+                        case ml::PaddingMode::Reflection:
+                            i = i < 0 ? -i : 2 * (size - 1) - i;
+                            break;
+                        case ml::PaddingMode::Symmetric:
+                            i = i < 0 ? -i - 1 : 2 * size - 1 - i;
+                            break;
+                        default:
+                            DAWN_UNREACHABLE();
+                    }
+                }
+                inputOffset += i * inputStrides[d];
+            }
+            output[outputOffset] = padded ? value : input[inputOffset];
+            for (size_t d = rank; d-- > 0;) {
+                if (++index[d] < outputShape[d]) {
+                    break;
+                }
+                index[d] = 0;
+            }
+        }
+    }
+
+    void ReduceMean(const float* input,
+                    const std::vector<int32_t>& inputShape,
+                    const std::vector<bool>& reduced,
+                    float* output) {
+        const size_t rank = inputShape.size();
+        std::vector<int32_t> outputShape(inputShape);
+        size_t count = 1;
+        for (size_t d = 0; d < rank; ++d) {
+            if (reduced[d]) {
+                outputShape[d] = 1;
+                count *= inputShape[d];
+            }
+        }
+        std::vector<size_t> outputStrides = BroadcastStrides(outputShape, inputShape);
+        const size_t outputSize = SizeOf(outputShape);
+        std::fill(output, output + outputSize, 0.0f);
+        const size_t total = SizeOf(inputShape);
+        std::vector<int32_t> index(rank, 0);
+        size_t outputOffset = 0;
+        for (size_t inputOffset = 0; inputOffset < total; ++inputOffset) {
+            output[outputOffset] += input[inputOffset];
+            for (size_t d = rank; d-- > 0;) {
+                outputOffset += outputStrides[d];
+                if (++index[d] < inputShape[d]) {
+                    break;
+                }
+                outputOffset -= outputStrides[d] * inputShape[d];
+                index[d] = 0;
+            }
+        }
+        if (count != 0) {
+            ScaleShift(output, 1.0f / count, 0.0f, output, outputSize);
+        }
+    }
+
+    void QuantizeLinear(const float* input,
+                        const float* scales,
+                        const int32_t* zeroPoints,
+                        size_t outer,
+                        size_t channels,
+                        size_t inner,
+                        float minValue,
+                        float maxValue,
+                        float* output) {
+        for (size_t o = 0; o < outer; ++o) {
+            for (size_t c = 0; c < channels; ++c) {
+                const float scale = scales[c];
+                const float zeroPoint = static_cast<float>(zeroPoints[c]);
+                const size_t offset = (o * channels + c) * inner;
+                for (size_t i = offset; i < offset + inner; ++i) {
+                    const float value = std::nearbyint(input[i] / scale) + zeroPoint;
+                    output[i] = std::min(std::max(value, minValue), maxValue);
+                }
+            }
+        }
+    }
+
+    void DequantizeLinear(const float* input,
+                          const float* scales,
+                          const int32_t* zeroPoints,
+                          size_t outer,
+                          size_t channels,
+                          size_t inner,
+                          float* output) {
+        for (size_t o = 0; o < outer; ++o) {
+            for (size_t c = 0; c < channels; ++c) {
+                const float scale = scales[c];
+                const float zeroPoint = static_cast<float>(zeroPoints[c]);
+                const size_t offset = (o * channels + c) * inner;
+                for (size_t i = offset; i < offset + inner; ++i) {
+                    output[i] = (input[i] - zeroPoint) * scale;
+                }
+            }
+        }
+    }
+
+    void ResampleAxis(ml::InterpolationMode mode,
+                      const float* input,
+                      const std::vector<int32_t>& inputShape,
+                      size_t axis,
+                      int32_t outputSize,
+                      float* output) {
+        size_t outer = 1, inner = 1;
+        for (size_t d = 0; d < axis; ++d) {
+            outer *= inputShape[d];
+        }
+        for (size_t d = axis + 1; d < inputShape.size(); ++d) {
+            inner *= inputShape[d];
+        }
+        const int32_t inputSize = inputShape[axis];
+        const float ratio = static_cast<float>(inputSize) / outputSize;
+        for (size_t o = 0; o < outer; ++o) {
+            const float* src = input + o * inputSize * inner;
+            float* dst = output + o * outputSize * inner;
+            for (int32_t i = 0; i < outputSize; ++i) {
+                float* row = dst + i * inner;
+                if (mode == ml::InterpolationMode::NearestNeighbor) {
+                    const int32_t nearest =
+                        std::min(static_cast<int32_t>(std::floor(i * ratio)), inputSize - 1);
+                    memcpy(row, src + nearest * inner, inner * sizeof(float));
+                    continue;
+                }
+                const float x = std::max((i + 0.5f) * ratio - 0.5f, 0.0f);
+                const int32_t x0 = std::min(static_cast<int32_t>(x), inputSize - 1);
+                const int32_t x1 = std::min(x0 + 1, inputSize - 1);
+                const float weight = x - x0;
+                const float* row0 = src + x0 * inner;
+                const float* row1 = src + x1 * inner;
+                for (size_t j = 0; j < inner; ++j) {
+                    row[j] = row0[j] + (row1[j] - row0[j]) * weight;
+                }
+            }
+        }
+    }
+
+    const KernelTable& GetKernelTable() {
+        static const KernelTable table = {
+            ElementWise,
+            Broadcast,
+            ScaleShift,
+            Relu,
+            Clamp,
+            LeakyRelu,
+            HardSwish,
+            Sigmoid,
+            Tanh,
+            Softmax,
+            Gemm,
+            Transpose,
+            Im2Col,
+            Pool2d,
+            Pad,
+            ReduceMean,
+            QuantizeLinear,
+            DequantizeLinear,
+            ResampleAxis,
+        };
+        return table;
+    }
+
+}}}  // namespace webnn_native::reference::WEBNN_REFERENCE_KERNELS_ISA
@@ -0,0 +1,170 @@
+// Copyright 2021 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_REFERENCE_KERNELS_H_
+#define WEBNN_NATIVE_REFERENCE_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "webnn_native/webnn_platform.h"
+
+// The float32 kernels of the reference backend. The inner loops are vectorized with SSE when the
+// compiler targets it and fall back to scalar code otherwise, the AVX2/FMA build of the kernels is
+// selected at runtime on the x86 CPUs that support it. All the tensors are dense and row-major.
+namespace webnn_native { namespace reference {
+
+    enum class ElementWiseType {
+        kAdd,
+        kSub,
+        kMul,
+        kDiv,
+        kMax,
+        kMin,
+        kPow,
+    };
+
+    enum class Pool2dKernelType {
+        kAverage,
+        kL2,
+        kMax,
+    };
+
+    // out = a op b, |a| and |b| are broadcasted to |outputShape| by the numpy rule.
+    void ElementWise(ElementWiseType type,
+                     const float* a,
+                     const std::vector<int32_t>& aShape,
+                     const float* b,
+                     const std::vector<int32_t>& bShape,
+                     float* output,
+                     const std::vector<int32_t>& outputShape);
+
+    // Broadcast |input| to |outputShape| by the numpy rule.
+    void Broadcast(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   float* output,
+                   const std::vector<int32_t>& outputShape);
+
+    // output = input * scale + shift.
+    void ScaleShift(const float* input, float scale, float shift, float* output, size_t size);
+
+    // The activations are computed in place.
+    void Relu(float* data, size_t size);
+    void Clamp(float* data, size_t size, float minValue, float maxValue);
+    void LeakyRelu(float* data, size_t size, float alpha);
+    void HardSwish(float* data, size_t size);
+    void Sigmoid(float* data, size_t size);
+    void Tanh(float* data, size_t size);
+    // The softmax of each row of a [rows, columns] matrix.
+    void Softmax(float* data, size_t rows, size_t columns);
+
+    // c += alpha * op(a) * op(b), op(a) is [m, k] and op(b) is [k, n]. The loops are blocked so
+    // that a panel of b stays in cache while it's multiplied with all the rows of a.
+    void Gemm(size_t m,
+              size_t n,
+              size_t k,
+              float alpha,
+              const float* a,
+              bool aTranspose,
+              const float* b,
+              bool bTranspose,
+              float* c);
+
+    void Transpose(const float* input,
+                   const std::vector<int32_t>& inputShape,
+                   const std::vector<int32_t>& permutation,
+                   float* output);
+
+    // Lower the [channels, height, width] input of one image to the
+    // [channels * kernelHeight * kernelWidth, outputHeight * outputWidth] matrix of convolution.
+    void Im2Col(const float* input,
+                size_t channels,
+                size_t height,
+                size_t width,
+                size_t kernelHeight,
+                size_t kernelWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                size_t outputHeight,
+                size_t outputWidth,
+                float* columns);
+
+    // The pooling of a nchw input, the padded elements are excluded from the average.
+    void Pool2d(Pool2dKernelType type,
+                const float* input,
+                const std::vector<int32_t>& inputShape,
+                size_t windowHeight,
+                size_t windowWidth,
+                int32_t paddingTop,
+                int32_t paddingLeft,
+                size_t strideHeight,
+                size_t strideWidth,
+                size_t dilationHeight,
+                size_t dilationWidth,
+                float* output,
+                const std::vector<int32_t>& outputShape);
+
+    // |paddingBegin| holds the number of padded elements before each dimension.
+    void Pad(const float* input,
+             const std::vector<int32_t>& inputShape,
+             const std::vector<int32_t>& paddingBegin,
+             ml::PaddingMode mode,
+             float value,
+             float* output,
+             const std::vector<int32_t>& outputShape);
+
+    // Average the dimensions of which |reduced| is true.
+    void ReduceMean(const float* input,
+                    const std::vector<int32_t>& inputShape,
+                    const std::vector<bool>& reduced,
+                    float* output);
+
+    // The linear quantization of a [outer, channels, inner] tensor with a scale and a zero point
+    // for each channel, the values are rounded to the nearest even and saturated to
+    // [minValue, maxValue]. The quantized values are held as floats.
+    void QuantizeLinear(const float* input,
+                        const float* scales,
+                        const int32_t* zeroPoints,
+                        size_t outer,
+                        size_t channels,
+                        size_t inner,
+                        float minValue,
+                        float maxValue,
+                        float* output);
+    // output = (input - zeroPoint) * scale for each channel of a [outer, channels, inner] tensor.
+    void DequantizeLinear(const float* input,
+                          const float* scales,
+                          const int32_t* zeroPoints,
+                          size_t outer,
+                          size_t channels,
+                          size_t inner,
+                          float* output);
+
+    // Resample one dimension of the input to |outputSize|, the linear mode uses the half pixel
+    // coordinate transformation.
+    void ResampleAxis(ml::InterpolationMode mode,
+                      const float* input,
+                      const std::vector<int32_t>& inputShape,
+                      size_t axis,
+                      int32_t outputSize,
+                      float* output);
+
+}}  // namespace webnn_native::reference
+
+#endif  // WEBNN_NATIVE_REFERENCE_KERNELS_H_
@@ -14,16 +14,46 @@
 
 #include "webnn_native/xnnpack/ContextXNN.h"
 
-#include <thread>
+#include <map>
+#include <mutex>
 
 #include "common/Log.h"
 #include "common/RefCounted.h"
+#include "webnn_native/CpuInfo.h"
 #include "webnn_native/xnnpack/GraphXNN.h"
 
 namespace webnn_native { namespace xnnpack {
 
-    ContextBase* Create() {
-        Ref<ContextBase> context = AcquireRef(new Context());
+    namespace {
+
+        std::shared_ptr<pthreadpool> CreateThreadpool(size_t threadCount) {
+            pthreadpool_t threadpool = pthreadpool_create(threadCount);
+            if (threadpool == NULL) {
+                return nullptr;
+            }
+            return std::shared_ptr<pthreadpool>(threadpool, pthreadpool_destroy);
+        }
+
+        // The contexts that share a thread pool get the pool of the same thread count, which is
+        // destroyed with the last of them. The computes of the contexts are serialized on the
+        // pool by pthreadpool.
+        std::shared_ptr<pthreadpool> AcquireSharedThreadpool(size_t threadCount) {
+            static std::mutex mutex;
+            static std::map<size_t, std::weak_ptr<pthreadpool>> threadpools;
+            std::lock_guard<std::mutex> lock(mutex);
+            std::shared_ptr<pthreadpool> threadpool = threadpools[threadCount].lock();
+            if (threadpool == nullptr) {
+                threadpool = CreateThreadpool(threadCount);
+                threadpools[threadCount] = threadpool;
+            }
+            return threadpool;
+        }
+
+    }  // namespace
+
+    ContextBase* Create(MLContextOptions const* options) {
+        Ref<ContextBase> context =
+            AcquireRef(new Context(reinterpret_cast<ContextOptions const*>(options)));
         xnn_status status = reinterpret_cast<Context*>(context.Get())->Init();
         if (status != xnn_status_success) {
             dawn::ErrorLog() << "Failed to init XNNPack:" << status;
@@ -32,7 +62,12 @@ namespace webnn_native { namespace xnnpack {
         return context.Detach();
     }
 
-    Context::Context() {
+    Context::Context(ContextOptions const* options) : ContextBase(options) {
+        // The relu and clamp activations are fused as the output range of the XNNPACK nodes.
+        for (auto type : {OperatorType::BatchNorm, OperatorType::Binary, OperatorType::Conv2d,
+                          OperatorType::Gemm}) {
+            mFusionRegistry.Register(type, {FusedOperator::Clamp, FusedOperator::Relu});
+        }
     }
 
     Context::~Context() {
@@ -41,9 +76,6 @@ namespace webnn_native { namespace xnnpack {
             dawn::ErrorLog() << "xnn_deinitialize failed: " << status;
             return;
         }
-        if (mThreadpool != NULL) {
-            pthreadpool_destroy(mThreadpool);
-        }
     }
 
     xnn_status Context::Init() {
@@ -52,19 +84,28 @@ namespace webnn_native { namespace xnnpack {
             dawn::ErrorLog() << "xnn_initialize failed: " << status;
             return status;
         }
-        // Create a thread pool with as half of the logical processors in the system.
-        mThreadpool = pthreadpool_create(std::thread::hardware_concurrency() / 2);
-        if (mThreadpool == NULL) {
+        // The threads default to the cores available to the process, so that the replicas of a
+        // model in containers with CPU quotas don't oversubscribe the host.
+        ContextOptions options = GetContextOptions();
+        size_t threadCount =
+            options.numThreads != 0 ? options.numThreads : GetAvailableCoreCount();
+        mThreadpool = options.shareThreadPool ? AcquireSharedThreadpool(threadCount)
+                                              : CreateThreadpool(threadCount);
+        if (mThreadpool == nullptr) {
             dawn::ErrorLog() << "pthreadpool_create failed";
             return xnn_status_out_of_memory;
         }
         dawn::InfoLog() << "XNNPACK backend thread numbers: "
-                        << pthreadpool_get_threads_count(mThreadpool);
+                        << pthreadpool_get_threads_count(mThreadpool.get());
         return xnn_status_success;
     }
 
     pthreadpool_t Context::GetThreadpool() {
-        return mThreadpool;
+        return mThreadpool.get();
+    }
+
+    bool Context::SupportsOperator(const OperatorBase* op) const {
+        return Graph::SupportsOperator(op);
     }
 
     GraphBase* Context::CreateGraphImpl() {
@@ -18,22 +18,25 @@
 #include "webnn_native/Context.h"
 
 #include <xnnpack.h>
+#include <memory>
 
 namespace webnn_native { namespace xnnpack {
 
     class Context : public ContextBase {
       public:
-        Context();
+        explicit Context(ContextOptions const* options);
         ~Context() override;
 
         xnn_status Init();
 
         pthreadpool_t GetThreadpool();
 
+        bool SupportsOperator(const OperatorBase* op) const override;
+
       private:
         GraphBase* CreateGraphImpl() override;
 
-        pthreadpool_t mThreadpool;
+        std::shared_ptr<pthreadpool> mThreadpool;
     };
 
 }}  // namespace webnn_native::xnnpack
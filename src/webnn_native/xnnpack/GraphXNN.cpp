@@ -14,21 +14,23 @@
 
 #include "webnn_native/xnnpack/GraphXNN.h"
 
-#include <math.h>
-#include <numeric>
+#include <cmath>
+#include <limits>
+#include <set>
 
 #include "common/Assert.h"
 #include "common/Log.h"
+#include "webnn_native/Bindings.h"
 #include "webnn_native/ErrorData.h"
+#include "webnn_native/Float16.h"
 #include "webnn_native/NamedInputs.h"
 #include "webnn_native/NamedOutputs.h"
 #include "webnn_native/Operand.h"
+#include "webnn_native/ShapeUtils.h"
 #include "webnn_native/xnnpack/ContextXNN.h"
 
 #define FAILED(status) (((xnn_status)(status)) != xnn_status_success)
 
-#define XNNPACK_MAX_VALUE_ID 10000
-
 const char* xnn_status2str(xnn_status v) {
     if (v == xnn_status_success)
         return "success";
@@ -97,8 +99,11 @@ const char* xnn_status2str(xnn_status v) {
 namespace webnn_native { namespace xnnpack {
 
     namespace {
+        // The float16 operands are computed in float32, the inputs, the outputs and the
+        // constants are converted at the boundaries of the subgraph.
         xnn_status GetXnnDataType(ml::OperandType operandType, xnn_datatype& xnnDataType) {
-            if (operandType == ml::OperandType::Float32) {
+            if (operandType == ml::OperandType::Float32 ||
+                operandType == ml::OperandType::Float16) {
                 xnnDataType = xnn_datatype_fp32;
             } else {
                 return xnn_status_invalid_parameter;
@@ -106,582 +111,899 @@ namespace webnn_native { namespace xnnpack {
             return xnn_status_success;
         }
 
-        size_t SizeOfXnnDataType(xnn_datatype dataType) {
-            if (dataType == xnn_datatype_fp32) {
-                return sizeof(float);
-            } else if (dataType == xnn_datatype_fp16) {
-                return sizeof(uint16_t);
-            } else if (dataType == xnn_datatype_qint32) {
-                return sizeof(int32_t);
-            } else if (dataType == xnn_datatype_qint8) {
-                return sizeof(int8_t);
-            }
-            return 0;
-        }
-
-        xnn_status BroadcastDimensions(const std::vector<size_t>& aDims,
-                                       const std::vector<size_t>& bDims,
-                                       std::vector<size_t>& cDims) {
-            cDims.resize(std::max(aDims.size(), bDims.size()));
-            for (size_t i = 0; i < cDims.size(); ++i) {
-                size_t aDim = i < aDims.size() ? aDims[aDims.size() - i - 1] : 1;
-                size_t bDim = i < bDims.size() ? bDims[bDims.size() - i - 1] : 1;
-                size_t cIndex = cDims.size() - i - 1;
-                if (aDim == 1 && bDim != 1) {
-                    cDims[cIndex] = bDim;
-                } else if (aDim != 1 && bDim == 1) {
-                    cDims[cIndex] = aDim;
-                } else if (aDim == bDim) {
-                    cDims[cIndex] = aDim;
-                } else {
+        // XNNPACK defines the values with static dimensions.
+        xnn_status GetXnnDims(const std::vector<int32_t>& shape, std::vector<size_t>& dims) {
+            dims.clear();
+            for (auto dim : shape) {
+                if (dim < 0) {
+                    dawn::ErrorLog() << "XNNPACK only supports the static shape.";
                     return xnn_status_invalid_parameter;
                 }
+                dims.push_back(dim);
             }
             return xnn_status_success;
         }
 
-        size_t GetEffectiveFilterSize(size_t filterSize, size_t dilation) {
-            if (dilation <= 1) {
-                return filterSize;
+        // Transpose the static data, the dimension i of the result is the dimension
+        // permutation[i] of the source.
+        std::vector<float> TransposeData(const float* data,
+                                         const std::vector<size_t>& dims,
+                                         const std::vector<size_t>& permutation,
+                                         std::vector<size_t>& transposedDims) {
+            const size_t rank = dims.size();
+            std::vector<size_t> strides(rank, 1);
+            for (size_t i = rank; i-- > 1;) {
+                strides[i - 1] = strides[i] * dims[i];
+            }
+            transposedDims.resize(rank);
+            std::vector<size_t> transposedStrides(rank);
+            size_t size = 1;
+            for (size_t i = 0; i < rank; ++i) {
+                transposedDims[i] = dims[permutation[i]];
+                transposedStrides[i] = strides[permutation[i]];
+                size *= dims[i];
+            }
+            std::vector<float> transposed(size);
+            std::vector<size_t> index(rank, 0);
+            for (size_t i = 0; i < size; ++i) {
+                size_t offset = 0;
+                for (size_t j = 0; j < rank; ++j) {
+                    offset += index[j] * transposedStrides[j];
+                }
+                transposed[i] = data[offset];
+                for (size_t j = rank; j-- > 0;) {
+                    if (++index[j] < transposedDims[j]) {
+                        break;
+                    }
+                    index[j] = 0;
+                }
+            }
+            return transposed;
+        }
+
+        // XNNPACK fuses the relu and clamp activations by clamping the output.
+        void GetOutputRange(const OperatorBase* activation, float& outputMin, float& outputMax) {
+            outputMin = -std::numeric_limits<float>::infinity();
+            outputMax = +std::numeric_limits<float>::infinity();
+            if (activation == nullptr) {
+                return;
+            }
+            switch (activation->GetFusedOperator()) {
+                case FusedOperator::Clamp: {
+                    auto clamp = static_cast<const op::Clamp*>(activation);
+                    outputMin = clamp->GetMinValue();
+                    outputMax = clamp->GetMaxValue();
+                    break;
+                }
+                case FusedOperator::Relu:
+                    outputMin = 0;
+                    break;
+                default:
+                    DAWN_UNREACHABLE();
             }
-            return filterSize + (filterSize - 1) * (dilation - 1);
         }
 
-        size_t ComputeConv2DOutputSize(size_t input,
-                                       size_t filter,
-                                       size_t padBegin,
-                                       size_t padEnd,
-                                       size_t stride,
-                                       size_t dilation) {
-            size_t effectiveFilter = GetEffectiveFilterSize(filter, dilation);
-            return (input - effectiveFilter + padBegin + padEnd) / stride + 1;
+        bool IsConstant(const OperandBase* operand) {
+            return operand != nullptr &&
+                   operand->Operator()->GetOperatorType() == OperatorType::Constant;
+        }
+
+        // The activations that are the output range of the nodes.
+        bool SupportsActivation(const OperatorBase* activation) {
+            return activation == nullptr || activation->GetFusedOperator() == FusedOperator::Relu ||
+                   (activation->GetFusedOperator() == FusedOperator::Clamp &&
+                    static_cast<const op::Clamp*>(activation)->IsClampByValue());
+        }
+
+        // The axes of reduceMean normalized to the rank of the input.
+        std::set<int32_t> GetReduceAxes(const op::ReduceMean* reduceMean) {
+            const ReduceMeanOptions* options = reduceMean->GetOptions();
+            const int32_t rank = reduceMean->Inputs()[0]->Shape().size();
+            std::set<int32_t> axes;
+            for (uint32_t i = 0; i < options->axesCount; ++i) {
+                int32_t axis = options->axes[i];
+                axes.insert(axis < 0 ? axis + rank : axis);
+            }
+            return axes;
         }
     }  // anonymous namespace
 
-    Graph::Graph(Context* context) : GraphBase(context), mXnnOperator(nullptr) {
+    bool Graph::SupportsOperator(const OperatorBase* op) {
+        // The values are float32, the constants of other types are read at build time, e.g.
+        // the padding of pad. The quantized values aren't defined, so the quantize and the
+        // dequantize are partitioned to the other backends.
+        if (op->GetOperatorType() != OperatorType::Constant) {
+            for (auto& output : op->Outputs()) {
+                if (output->Type() != ml::OperandType::Float32 &&
+                    output->Type() != ml::OperandType::Float16) {
+                    return false;
+                }
+            }
+        }
+        auto inputs = op->Inputs();
+        switch (op->GetOperatorType()) {
+            case OperatorType::BatchNorm: {
+                // The normalization is folded into the scales and the shifts at build time.
+                const BatchNormOptions* options =
+                    static_cast<const op::BatchNorm*>(op)->GetOptions();
+                return IsConstant(inputs[1].Get()) && IsConstant(inputs[2].Get()) &&
+                       (options->scale == nullptr || IsConstant(options->scale)) &&
+                       (options->bias == nullptr || IsConstant(options->bias)) &&
+                       SupportsActivation(options->activation);
+            }
+            case OperatorType::Binary: {
+                auto binary = static_cast<const op::Binary*>(op);
+                switch (binary->GetType()) {
+                    case op::BinaryOpType::kMatMul:
+                        // The 2-D matmul with a constant b is a fully connected node.
+                        if (!IsConstant(inputs[1].Get()) || inputs[0]->Shape().size() != 2 ||
+                            inputs[1]->Shape().size() != 2) {
+                            return false;
+                        }
+                        break;
+                    case op::BinaryOpType::kAdd:
+                    case op::BinaryOpType::kSub:
+                    case op::BinaryOpType::kMul:
+                    case op::BinaryOpType::kDiv:
+                    case op::BinaryOpType::kMax:
+                    case op::BinaryOpType::kMin:
+                        break;
+                    default:
+                        return false;
+                }
+                return SupportsActivation(binary->GetActivation());
+            }
+            case OperatorType::Clamp:
+                return static_cast<const op::Clamp*>(op)->IsClampByValue();
+            case OperatorType::Conv2d: {
+                const Conv2dOptions* options = static_cast<const op::Conv2d*>(op)->GetOptions();
+                return options->inputLayout == ml::InputOperandLayout::Nhwc &&
+                       IsConstant(inputs[1].Get()) && SupportsActivation(options->activation);
+            }
+            case OperatorType::Gemm: {
+                auto gemm = static_cast<const op::Gemm*>(op);
+                const GemmOptions* options = gemm->GetOptions();
+                if (options->aTranspose || options->alpha != 1.0f || !IsConstant(inputs[1].Get())) {
+                    return false;
+                }
+                // The c operand is the bias of [1] or [N].
+                if (options->c != nullptr && options->beta != 0.0f) {
+                    const std::vector<int32_t>& bShape = inputs[1]->Shape();
+                    const size_t outputChannels = options->bTranspose ? bShape[0] : bShape[1];
+                    const size_t cSize = SizeOfShape(inputs[2]->Shape());
+                    if (!IsConstant(inputs[2].Get()) || (cSize != 1 && cSize != outputChannels)) {
+                        return false;
+                    }
+                }
+                return SupportsActivation(gemm->GetActivation());
+            }
+            case OperatorType::Pad:
+                return static_cast<const op::Pad*>(op)->GetOptions()->mode ==
+                           ml::PaddingMode::Constant &&
+                       IsConstant(inputs[1].Get());
+            case OperatorType::Pool2d: {
+                auto pool2d = static_cast<const op::Pool2d*>(op);
+                const Pool2dOptions* options = pool2d->GetOptions();
+                if (options->layout != ml::InputOperandLayout::Nhwc) {
+                    return false;
+                }
+                switch (pool2d->GetType()) {
+                    case op::Pool2dType::kAveragePool2d:
+                        return options->dilations[0] == 1 && options->dilations[1] == 1;
+                    case op::Pool2dType::kMaxPool2d:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+            case OperatorType::ReduceMean:
+                // The mean over the spatial dimensions of nhwc is the global average pooling.
+                return inputs[0]->Shape().size() == 4 &&
+                       GetReduceAxes(static_cast<const op::ReduceMean*>(op)) ==
+                           std::set<int32_t>({1, 2});
+            case OperatorType::Resample: {
+                // The bilinear resize scales the spatial dimensions of nhwc.
+                const std::vector<int32_t>& inputShape = inputs[0]->Shape();
+                const std::vector<int32_t>& outputShape = op->PrimaryOutput()->Shape();
+                return static_cast<const op::Resample*>(op)->GetOptions()->mode ==
+                           ml::InterpolationMode::Linear &&
+                       inputShape.size() == 4 && inputShape[0] == outputShape[0] &&
+                       inputShape[3] == outputShape[3];
+            }
+            case OperatorType::Unary:
+                switch (static_cast<const op::Unary*>(op)->GetType()) {
+                    case op::UnaryOpType::kHardSwish:
+                    case op::UnaryOpType::kLeakyRelu:
+                    case op::UnaryOpType::kRelu:
+                    case op::UnaryOpType::kSigmoid:
+                    case op::UnaryOpType::kSoftmax:
+                        return true;
+                    default:
+                        return false;
+                }
+            case OperatorType::Constant:
+            case OperatorType::Input:
+            case OperatorType::Reshape:
+            case OperatorType::Squeeze:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    Graph::Graph(Context* context) : GraphBase(context), mSubgraph(nullptr), mRuntime(nullptr) {
     }
 
     Graph::~Graph() {
-        if (mXnnOperator) {
-            if (FAILED(xnn_delete_operator(mXnnOperator))) {
-                dawn::ErrorLog() << "xnn_delete_operator failed.";
+        if (mRuntime != nullptr) {
+            if (FAILED(xnn_delete_runtime(mRuntime))) {
+                dawn::ErrorLog() << "xnn_delete_runtime failed.";
+            }
+        }
+        if (mSubgraph != nullptr) {
+            if (FAILED(xnn_delete_subgraph(mSubgraph))) {
+                dawn::ErrorLog() << "xnn_delete_subgraph failed.";
             }
         }
     }
 
     MaybeError Graph::AddConstant(const op::Constant* constant) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::CONSTANT);
-        const OperandDescriptor* desc = constant->GetOperandDescriptor();
-        DAWN_TRY(GetXnnDataType(desc->type, info->dataType));
-        info->dims.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
-        info->buffer.reset(new char[constant->GetByteLength()]);
-        if (info->buffer.get() == nullptr) {
-            return DAWN_OUT_OF_MEMORY_ERROR("");
-        }
-        memcpy(info->buffer.get(), constant->GetBuffer(), constant->GetByteLength());
-        mConstants.push_back(info);
-        mOperandInfoMap.insert(std::make_pair(constant, info));
+        mConstants.insert(std::make_pair(constant->PrimaryOutput(), constant));
         return {};
     }
 
     MaybeError Graph::AddInput(const op::Input* input) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::INPUT);
-        const OperandDescriptor* desc = input->GetOperandDescriptor();
-        DAWN_TRY(GetXnnDataType(desc->type, info->dataType));
-        info->dims.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
-        info->name = input->GetName();
-        mOperandInfoMap.insert(std::make_pair(input, info));
+        mInputs.insert(std::make_pair(input->GetName(), input));
         return {};
     }
 
-    MaybeError Graph::AddOutput(const std::string& name, const OperandBase* op) {
-        std::shared_ptr<OperandInfo>& info = mOperandInfoMap.at(op);
-        if (info->opType == OperandType::INPUT || info->opType == OperandType::CONSTANT) {
-            return DAWN_INTERNAL_ERROR("There is no operator to be created.");
-        }
-        info->name = std::move(name);
+    MaybeError Graph::AddOutput(const std::string& name, const OperandBase* output) {
+        mOutputs.insert(std::make_pair(name, output));
+        return {};
+    }
+
+    MaybeError Graph::AddBatchNorm(const op::BatchNorm* batchNorm) {
+        mOperators.push_back(batchNorm);
         return {};
     }
 
     MaybeError Graph::AddBinary(const op::Binary* binary) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::BINARY);
-        mOperandInfoMap.insert(std::make_pair(binary, info));
-        mOperandsToBuild.push_back(binary);
+        mOperators.push_back(binary);
         return {};
     }
 
     MaybeError Graph::AddClamp(const op::Clamp* clamp) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::CLAMP);
-        mOperandInfoMap.insert(std::make_pair(clamp, info));
-        mOperandsToBuild.push_back(clamp);
+        mOperators.push_back(clamp);
         return {};
     }
 
     MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::CONV2D);
-        mOperandInfoMap.insert(std::make_pair(conv2d, info));
-        mOperandsToBuild.push_back(conv2d);
+        mOperators.push_back(conv2d);
+        return {};
+    }
+
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        mOperators.push_back(gemm);
+        return {};
+    }
+
+    MaybeError Graph::AddLeakyRelu(const op::LeakyRelu* leakyRelu) {
+        mOperators.push_back(leakyRelu);
+        return {};
+    }
+
+    MaybeError Graph::AddPad(const op::Pad* pad) {
+        mOperators.push_back(pad);
         return {};
     }
 
     MaybeError Graph::AddPool2d(const op::Pool2d* pool2d) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::POOL2D);
-        mOperandInfoMap.insert(std::make_pair(pool2d, info));
-        mOperandsToBuild.push_back(pool2d);
+        mOperators.push_back(pool2d);
+        return {};
+    }
+
+    MaybeError Graph::AddReduceMean(const op::ReduceMean* reduceMean) {
+        mOperators.push_back(reduceMean);
+        return {};
+    }
+
+    MaybeError Graph::AddResample(const op::Resample* resample) {
+        mOperators.push_back(resample);
+        return {};
+    }
+
+    MaybeError Graph::AddReshape(const op::Reshape* reshape) {
+        mOperators.push_back(reshape);
+        return {};
+    }
+
+    MaybeError Graph::AddSqueeze(const op::Squeeze* squeeze) {
+        mOperators.push_back(squeeze);
         return {};
     }
 
     MaybeError Graph::AddUnary(const op::Unary* unary) {
-        std::shared_ptr<OperandInfo> info = std::make_shared<OperandInfo>(OperandType::UNARY);
-        mOperandInfoMap.insert(std::make_pair(unary, info));
-        mOperandsToBuild.push_back(unary);
+        mOperators.push_back(unary);
         return {};
     }
 
     MaybeError Graph::Finish() {
-        if (mOperandsToBuild.size() == 0) {
+        if (mOperators.size() == 0) {
             return DAWN_INTERNAL_ERROR("No operators to build.");
         }
-        const OperandBase* op = mOperandsToBuild[0];
-        DAWN_ASSERT(mOperandInfoMap.find(op) != mOperandInfoMap.end());
-        std::shared_ptr<OperandInfo>& info = mOperandInfoMap.at(op);
-        if (mOperandsToBuild.size() == 1) {
-            if (info->opType == OperandType::UNARY) {
-                DAWN_TRY(CreateXnnOp(reinterpret_cast<const op::Unary*>(op)));
-            } else if (info->opType == OperandType::CLAMP) {
-                DAWN_TRY(CreateXnnOp(reinterpret_cast<const op::Clamp*>(op)));
-            } else if (info->opType == OperandType::BINARY) {
-                DAWN_TRY(CreateXnnOp(reinterpret_cast<const op::Binary*>(op)));
-            } else if (info->opType == OperandType::CONV2D) {
-                DAWN_TRY(CreateXnnOp(reinterpret_cast<const op::Conv2d*>(op)));
-            } else if (info->opType == OperandType::POOL2D) {
-                DAWN_TRY(CreateXnnOp(reinterpret_cast<const op::Pool2d*>(op)));
-            } else {
-                return DAWN_UNIMPLEMENTED_ERROR("");
-            }
-        } else if (info->opType == OperandType::CONV2D) {
-            // Try to fuse add and clamp into conv2d
-            const op::Conv2d* conv2d = reinterpret_cast<const op::Conv2d*>(op);
-            if (mOperandsToBuild.size() > 3) {
-                return DAWN_INTERNAL_ERROR("Cannot fuse conv2d subgraph with more than 3 ops.");
-            }
-            const op::Binary* add = nullptr;
-            const op::Clamp* clamp = nullptr;
-            for (auto& operand : mOperandsToBuild) {
-                DAWN_ASSERT(mOperandInfoMap.find(operand) != mOperandInfoMap.end());
-                std::shared_ptr<OperandInfo>& operandInfo = mOperandInfoMap.at(operand);
-                if (operandInfo->opType == OperandType::BINARY &&
-                    reinterpret_cast<const op::Binary*>(operand)->GetType() ==
-                        op::BinaryOpType::kAdd) {
-                    add = reinterpret_cast<const op::Binary*>(operand);
-                } else if (operandInfo->opType == OperandType::CLAMP) {
-                    clamp = reinterpret_cast<const op::Clamp*>(operand);
-                }
+        // The inputs take the first external value ids and the named outputs take the rest.
+        uint32_t externalValueCount = 0;
+        std::set<const OperandBase*> externalOperands;
+        for (auto& input : mInputs) {
+            const OperandBase* operand = input.second->PrimaryOutput();
+            mExternalInputs.insert(std::make_pair(input.first, externalValueCount++));
+            externalOperands.insert(operand);
+            mInputByteLengths[input.first] =
+                SizeOfShape(operand->Shape()) * SizeOfOperandType(operand->Type());
+            if (operand->Type() == ml::OperandType::Float16) {
+                mFloat16Inputs[mExternalInputs.at(input.first)].resize(
+                    SizeOfShape(operand->Shape()));
+            }
+        }
+        for (auto& output : mOutputs) {
+            const OperandBase* operand = output.second;
+            if (mConstants.find(operand) != mConstants.end()) {
+                return DAWN_UNIMPLEMENTED_ERROR("XNNPACK doesn't support a constant output.");
+            }
+            if (!externalOperands.insert(operand).second) {
+                return DAWN_UNIMPLEMENTED_ERROR(
+                    "XNNPACK doesn't support the output of an input or a duplicated output.");
             }
-            if ((mOperandsToBuild.size() == 2 && !add && !clamp) ||
-                (mOperandsToBuild.size() == 3 && (!add || !clamp))) {
-                return DAWN_INTERNAL_ERROR("Failed to fuse conv2d subgraph.");
+            mExternalOutputs.insert(std::make_pair(output.first, externalValueCount));
+            if (operand->Type() == ml::OperandType::Float16) {
+                mFloat16Outputs[externalValueCount].resize(SizeOfShape(operand->Shape()));
             }
-            DAWN_TRY(CreateXnnOp(conv2d, add, clamp));
+            ++externalValueCount;
         }
+
+        DAWN_TRY(xnn_create_subgraph(externalValueCount, 0, &mSubgraph));
+        for (auto& input : mInputs) {
+            DAWN_TRY(DefineValue(input.second->PrimaryOutput()));
+        }
+        for (auto op : mOperators) {
+            // The nodes are only defined for the operators that the context reports, so the
+            // build fails here rather than in the middle of the subgraph.
+            if (!SupportsOperator(op)) {
+                return DAWN_UNIMPLEMENTED_ERROR("XNNPACK doesn't support the operator.");
+            }
+            switch (op->GetOperatorType()) {
+                case OperatorType::BatchNorm:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::BatchNorm*>(op)));
+                    break;
+                case OperatorType::Binary:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Binary*>(op)));
+                    break;
+                case OperatorType::Clamp:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Clamp*>(op)));
+                    break;
+                case OperatorType::Conv2d:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Conv2d*>(op)));
+                    break;
+                case OperatorType::Gemm:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Gemm*>(op)));
+                    break;
+                case OperatorType::Pad:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Pad*>(op)));
+                    break;
+                case OperatorType::Pool2d:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Pool2d*>(op)));
+                    break;
+                case OperatorType::ReduceMean:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::ReduceMean*>(op)));
+                    break;
+                case OperatorType::Resample:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Resample*>(op)));
+                    break;
+                case OperatorType::Reshape:
+                case OperatorType::Squeeze:
+                    DAWN_TRY(DefineReshapeNode(op));
+                    break;
+                case OperatorType::Unary:
+                    DAWN_TRY(DefineXnnNode(static_cast<const op::Unary*>(op)));
+                    break;
+                default:
+                    return DAWN_UNIMPLEMENTED_ERROR("XNNPACK doesn't support the operator.");
+            }
+        }
+
+        for (auto& output : mOutputs) {
+            mOutputBuffers[output.first].resize(SizeOfShape(output.second->Shape()));
+        }
+
+        for (auto& name : GetInputNames()) {
+            mIndexedInputs.push_back(
+                std::make_pair(mExternalInputs.at(name), mInputByteLengths.at(name)));
+        }
+        for (auto& name : GetOutputNames()) {
+            mIndexedOutputs.push_back(
+                {mExternalOutputs.at(name), static_cast<void*>(mOutputBuffers.at(name).data())});
+        }
+        mBoundValues.reserve(mIndexedInputs.size() + mIndexedOutputs.size());
+        mConvertedConstants.clear();
         return {};
     }
 
-    xnn_status Graph::CreateXnnOp(const op::Unary* unary) {
-        DAWN_ASSERT(unary->Inputs().size() == 1);
-        const OperandBase* inputOperand = unary->Inputs()[0].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(inputOperand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& inputInfo = mOperandInfoMap.at(inputOperand);
-        mInputs.push_back(inputInfo);
-        if (inputInfo->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(inputInfo->name, mInputs.size() - 1));
-        }
-        if (unary->GetType() == op::UnaryOpType::kRelu) {
-            XNN_TRY(xnn_create_clamp_nc_f32(1, 1, 1, 0, +std::numeric_limits<float>::infinity(), 0,
-                                            &mXnnOperator));
-            mXnnOperatorType = XnnOpType::clamp_nc_f32;
-        } else {
-            return xnn_status_unsupported_parameter;
+    xnn_status Graph::DefineValue(const OperandBase* operand) {
+        xnn_datatype dataType;
+        XNN_TRY(GetXnnDataType(operand->Type(), dataType));
+        std::vector<size_t> dims;
+        XNN_TRY(GetXnnDims(operand->Shape(), dims));
+        uint32_t externalId = XNN_INVALID_VALUE_ID;
+        uint32_t flags = 0;
+        for (auto& input : mInputs) {
+            if (input.second->PrimaryOutput() == operand) {
+                externalId = mExternalInputs.at(input.first);
+                flags = XNN_VALUE_FLAG_EXTERNAL_INPUT;
+            }
+        }
+        for (auto& output : mOutputs) {
+            if (output.second == operand) {
+                externalId = mExternalOutputs.at(output.first);
+                flags = XNN_VALUE_FLAG_EXTERNAL_OUTPUT;
+            }
         }
-        std::shared_ptr<OperandInfo>& outputInfo = mOperandInfoMap.at(unary);
-        outputInfo->dataType = inputInfo->dataType;
-        outputInfo->dims = inputInfo->dims;
-        mOutputs.push_back(outputInfo);
-        mExternalOutputs.insert(std::make_pair(outputInfo->name, mOutputs.size() - 1));
+        uint32_t id;
+        XNN_TRY(xnn_define_tensor_value(mSubgraph, dataType, dims.size(), dims.data(), nullptr,
+                                        externalId, flags, &id));
+        mValueIds.insert(std::make_pair(operand, id));
         return xnn_status_success;
     }
 
-    xnn_status Graph::CreateXnnOp(const op::Clamp* clamp) {
-        const OperandBase* inputOperand = clamp->Inputs()[0].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(inputOperand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& inputInfo = mOperandInfoMap.at(inputOperand);
-        mInputs.push_back(inputInfo);
-        if (inputInfo->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(inputInfo->name, mInputs.size() - 1));
-        }
-        const ClampOptions* options = clamp->GetOptions();
-        float minValue = -std::numeric_limits<float>::infinity();
-        if (options->minValue != nullptr) {
-            const std::shared_ptr<OperandInfo>& minInfo = mOperandInfoMap.at(options->minValue);
-            if (minInfo->opType != OperandType::CONSTANT) {
-                dawn::ErrorLog() << "XNNPACK only supports clamp by value.";
-                return xnn_status_invalid_parameter;
+    xnn_status Graph::DefineStaticValue(std::vector<size_t> dims,
+                                        std::vector<float> data,
+                                        uint32_t& id) {
+        mStaticData.push_back(std::move(data));
+        XNN_TRY(xnn_define_tensor_value(mSubgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+                                        mStaticData.back().data(), XNN_INVALID_VALUE_ID, 0,
+                                        &id));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineInternalValue(std::vector<size_t> dims, uint32_t& id) {
+        XNN_TRY(xnn_define_tensor_value(mSubgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+                                        nullptr, XNN_INVALID_VALUE_ID, 0, &id));
+        return xnn_status_success;
+    }
+
+    const op::Constant* Graph::GetConstant(const OperandBase* operand) {
+        auto constant = mConstants.find(operand);
+        return constant != mConstants.end() ? constant->second : nullptr;
+    }
+
+    const float* Graph::GetConstantData(const op::Constant* constant) {
+        const OperandBase* operand = constant->PrimaryOutput();
+        if (operand->Type() != ml::OperandType::Float16) {
+            return static_cast<const float*>(constant->GetBuffer());
+        }
+        auto converted = mConvertedConstants.find(constant);
+        if (converted == mConvertedConstants.end()) {
+            std::vector<float> data(SizeOfShape(operand->Shape()));
+            Float16ToFloat32(static_cast<const uint16_t*>(constant->GetBuffer()), data.data(),
+                             data.size());
+            converted = mConvertedConstants.insert(std::make_pair(constant, std::move(data))).first;
+        }
+        return converted->second.data();
+    }
+
+    // The constants are defined when they are used by a node so that the int32 constants read
+    // by the graph, e.g. the padding of pad, are not defined as values.
+    uint32_t Graph::GetValueId(const OperandBase* operand) {
+        if (mValueIds.find(operand) == mValueIds.end()) {
+            const op::Constant* constant = GetConstant(operand);
+            std::vector<size_t> dims;
+            if (constant == nullptr ||
+                (operand->Type() != ml::OperandType::Float32 &&
+                 operand->Type() != ml::OperandType::Float16) ||
+                FAILED(GetXnnDims(operand->Shape(), dims))) {
+                return XNN_INVALID_VALUE_ID;
+            }
+            const float* data = GetConstantData(constant);
+            uint32_t id;
+            if (FAILED(DefineStaticValue(
+                    dims, std::vector<float>(data, data + SizeOfShape(operand->Shape())), id))) {
+                return XNN_INVALID_VALUE_ID;
             }
-            minValue = (reinterpret_cast<float*>(minInfo->buffer.get()))[0];
+            mValueIds.insert(std::make_pair(operand, id));
         }
-        float maxValue = +std::numeric_limits<float>::infinity();
-        if (options->maxValue != nullptr) {
-            const std::shared_ptr<OperandInfo>& maxInfo = mOperandInfoMap.at(options->maxValue);
-            if (maxInfo->opType != OperandType::CONSTANT) {
-                dawn::ErrorLog() << "XNNPACK only supports clamp by value.";
-                return xnn_status_invalid_parameter;
+        return mValueIds.at(operand);
+    }
+
+    xnn_status Graph::DefineXnnNode(const op::BatchNorm* batchNorm) {
+        auto inputs = batchNorm->Inputs();
+        const BatchNormOptions* options = batchNorm->GetOptions();
+        const op::Constant* mean = GetConstant(inputs[1].Get());
+        const op::Constant* variance = GetConstant(inputs[2].Get());
+        const op::Constant* scale =
+            options->scale != nullptr ? GetConstant(options->scale) : nullptr;
+        const op::Constant* bias = options->bias != nullptr ? GetConstant(options->bias) : nullptr;
+        DAWN_ASSERT(mean != nullptr && variance != nullptr &&
+                    (options->scale == nullptr || scale != nullptr) &&
+                    (options->bias == nullptr || bias != nullptr));
+        // The normalization is lowered to multiply and add with the scales and shifts computed
+        // at build time, they are broadcasted along the dimensions after the channel axis.
+        const size_t axis = options->axis;
+        const size_t channels = SizeOfShape(inputs[1]->Shape());
+        std::vector<size_t> dims(inputs[0]->Shape().size() - axis, 1);
+        dims[0] = channels;
+        const float* meanData = GetConstantData(mean);
+        const float* varianceData = GetConstantData(variance);
+        const float* scaleData = scale != nullptr ? GetConstantData(scale) : nullptr;
+        const float* biasData = bias != nullptr ? GetConstantData(bias) : nullptr;
+        std::vector<float> scales(channels), shifts(channels);
+        for (size_t c = 0; c < channels; ++c) {
+            const float scaleValue = scaleData != nullptr ? scaleData[c] : 1.0f;
+            const float biasValue = biasData != nullptr ? biasData[c] : 0.0f;
+            scales[c] = scaleValue / std::sqrt(varianceData[c] + options->epsilon);
+            shifts[c] = biasValue - meanData[c] * scales[c];
+        }
+        uint32_t scalesId, shiftsId, scaledId;
+        XNN_TRY(DefineStaticValue(dims, std::move(scales), scalesId));
+        XNN_TRY(DefineStaticValue(dims, std::move(shifts), shiftsId));
+        std::vector<size_t> outputDims;
+        XNN_TRY(GetXnnDims(batchNorm->PrimaryOutput()->Shape(), outputDims));
+        XNN_TRY(DefineInternalValue(outputDims, scaledId));
+        XNN_TRY(DefineValue(batchNorm->PrimaryOutput()));
+        float outputMin, outputMax;
+        GetOutputRange(options->activation, outputMin, outputMax);
+        XNN_TRY(xnn_define_multiply2(mSubgraph, -std::numeric_limits<float>::infinity(),
+                                     +std::numeric_limits<float>::infinity(),
+                                     GetValueId(inputs[0].Get()), scalesId, scaledId, 0));
+        XNN_TRY(xnn_define_add2(mSubgraph, outputMin, outputMax, scaledId, shiftsId,
+                                GetValueId(batchNorm->PrimaryOutput()), 0));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(const op::Binary* binary) {
+        auto inputs = binary->Inputs();
+        DAWN_ASSERT(inputs.size() == 2);
+        XNN_TRY(DefineValue(binary->PrimaryOutput()));
+        const uint32_t outputId = GetValueId(binary->PrimaryOutput());
+        float outputMin, outputMax;
+        GetOutputRange(binary->GetActivation(), outputMin, outputMax);
+        if (binary->GetType() == op::BinaryOpType::kMatMul) {
+            // The 2-D matmul with a constant b is a fully connected node, XNNPACK expects the
+            // weights in [output_channels, input_channels].
+            const op::Constant* b = GetConstant(inputs[1].Get());
+            DAWN_ASSERT(b != nullptr);
+            std::vector<size_t> bDims, weightsDims;
+            XNN_TRY(GetXnnDims(inputs[1]->Shape(), bDims));
+            std::vector<float> weights =
+                TransposeData(GetConstantData(b), bDims, {1, 0}, weightsDims);
+            uint32_t weightsId;
+            XNN_TRY(DefineStaticValue(weightsDims, std::move(weights), weightsId));
+            XNN_TRY(xnn_define_fully_connected(mSubgraph, outputMin, outputMax,
+                                               GetValueId(inputs[0].Get()), weightsId,
+                                               XNN_INVALID_VALUE_ID, outputId, 0));
+            return xnn_status_success;
+        }
+
+        const uint32_t aId = GetValueId(inputs[0].Get());
+        const uint32_t bId = GetValueId(inputs[1].Get());
+        switch (binary->GetType()) {
+            case op::BinaryOpType::kAdd:
+                XNN_TRY(xnn_define_add2(mSubgraph, outputMin, outputMax, aId, bId, outputId, 0));
+                break;
+            case op::BinaryOpType::kSub:
+                XNN_TRY(
+                    xnn_define_subtract(mSubgraph, outputMin, outputMax, aId, bId, outputId, 0));
+                break;
+            case op::BinaryOpType::kMul:
+                XNN_TRY(
+                    xnn_define_multiply2(mSubgraph, outputMin, outputMax, aId, bId, outputId, 0));
+                break;
+            case op::BinaryOpType::kDiv:
+                XNN_TRY(xnn_define_divide(mSubgraph, outputMin, outputMax, aId, bId, outputId, 0));
+                break;
+            case op::BinaryOpType::kMax:
+            case op::BinaryOpType::kMin: {
+                // The maximum and minimum nodes have no output range, the fused activation is
+                // defined as a clamp node.
+                uint32_t resultId = outputId;
+                if (binary->GetActivation() != nullptr) {
+                    std::vector<size_t> dims;
+                    XNN_TRY(GetXnnDims(binary->PrimaryOutput()->Shape(), dims));
+                    XNN_TRY(DefineInternalValue(dims, resultId));
+                }
+                if (binary->GetType() == op::BinaryOpType::kMax) {
+                    XNN_TRY(xnn_define_maximum2(mSubgraph, aId, bId, resultId, 0));
+                } else {
+                    XNN_TRY(xnn_define_minimum2(mSubgraph, aId, bId, resultId, 0));
+                }
+                if (resultId != outputId) {
+                    XNN_TRY(xnn_define_clamp(mSubgraph, outputMin, outputMax, resultId, outputId,
+                                             0));
+                }
+                break;
             }
-            maxValue = (reinterpret_cast<float*>(maxInfo->buffer.get()))[0];
+            default:
+                DAWN_UNREACHABLE();
         }
-        XNN_TRY(xnn_create_clamp_nc_f32(1, 1, 1, minValue, maxValue, 0, &mXnnOperator));
-        mXnnOperatorType = XnnOpType::clamp_nc_f32;
-        std::shared_ptr<OperandInfo>& outputInfo = mOperandInfoMap.at(clamp);
-        outputInfo->dataType = inputInfo->dataType;
-        outputInfo->dims = inputInfo->dims;
-        mOutputs.push_back(outputInfo);
-        mExternalOutputs.insert(std::make_pair(outputInfo->name, mOutputs.size() - 1));
         return xnn_status_success;
     }
 
-    xnn_status Graph::CreateXnnOp(const op::Binary* binary) {
-        DAWN_ASSERT(binary->Inputs().size() == 2);
-        const OperandBase* input0Operand = binary->Inputs()[0].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(input0Operand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& input0Info = mOperandInfoMap.at(input0Operand);
-        mInputs.push_back(input0Info);
-        if (input0Info->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(input0Info->name, mInputs.size() - 1));
+    xnn_status Graph::DefineXnnNode(const op::Clamp* clamp) {
+        DAWN_ASSERT(clamp->IsClampByValue());
+        XNN_TRY(DefineValue(clamp->PrimaryOutput()));
+        XNN_TRY(xnn_define_clamp(mSubgraph, clamp->GetMinValue(), clamp->GetMaxValue(),
+                                 GetValueId(clamp->Inputs()[0].Get()),
+                                 GetValueId(clamp->PrimaryOutput()), 0));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(const op::Conv2d* conv2d) {
+        auto inputs = conv2d->Inputs();
+        DAWN_ASSERT(inputs.size() == 2 || inputs.size() == 3);
+        const Conv2dOptions* options = conv2d->GetOptions();
+        DAWN_ASSERT(options->inputLayout == ml::InputOperandLayout::Nhwc);
+        const op::Constant* filter = GetConstant(inputs[1].Get());
+        DAWN_ASSERT(filter != nullptr);
+        // The axes of the filter in the order of ohwi.
+        std::vector<size_t> permutation;
+        switch (options->filterLayout) {
+            case ml::FilterOperandLayout::Oihw:
+                permutation = {0, 2, 3, 1};
+                break;
+            case ml::FilterOperandLayout::Hwio:
+                permutation = {3, 0, 1, 2};
+                break;
+            case ml::FilterOperandLayout::Ohwi:
+                permutation = {0, 1, 2, 3};
+                break;
+            case ml::FilterOperandLayout::Ihwo:
+                permutation = {3, 1, 2, 0};
+                break;
+            default:
+                return xnn_status_invalid_parameter;
         }
-        const OperandBase* input1Operand = binary->Inputs()[1].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(input1Operand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& input1Info = mOperandInfoMap.at(input1Operand);
-        mInputs.push_back(input1Info);
-        if (input1Info->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(input1Info->name, mInputs.size() - 1));
+        const std::vector<int32_t>& inputShape = inputs[0]->Shape();
+        std::vector<size_t> filterDims;
+        XNN_TRY(GetXnnDims(inputs[1]->Shape(), filterDims));
+        const size_t inputChannels = inputShape[3];
+        const size_t outputChannels = filterDims[permutation[0]];
+        const uint32_t filterHeight = filterDims[permutation[1]];
+        const uint32_t filterWidth = filterDims[permutation[2]];
+        const size_t groupInputChannels = filterDims[permutation[3]];
+        const uint32_t groups = options->groups;
+        const bool depthwise = groups != 1 && groups == inputChannels && groupInputChannels == 1;
+        if (depthwise) {
+            // For depthwise conv2d, XNNPACK expects the filter laid out like:
+            //   [1, filter_height, filter_width, input_channels * depth_multiplier]
+            permutation = {permutation[3], permutation[1], permutation[2], permutation[0]};
         }
-        const float outputMin = -std::numeric_limits<float>::infinity();
-        const float outputMax = +std::numeric_limits<float>::infinity();
-        if (binary->GetType() == op::BinaryOpType::kAdd) {
-            XNN_TRY(xnn_create_add_nd_f32(outputMin, outputMax, 0, &mXnnOperator));
-            mXnnOperatorType = XnnOpType::add_nd_f32;
-        } else if (binary->GetType() == op::BinaryOpType::kMul) {
-            XNN_TRY(xnn_create_multiply_nd_f32(outputMin, outputMax, 0, &mXnnOperator));
-            mXnnOperatorType = XnnOpType::multiply_nd_f32;
-        } else if (binary->GetType() == op::BinaryOpType::kSub) {
-            XNN_TRY(xnn_create_subtract_nd_f32(outputMin, outputMax, 0, &mXnnOperator));
-            mXnnOperatorType = XnnOpType::subtract_nd_f32;
+        // For regular and grouped conv2d, XNNPACK expects the filter laid out like:
+        //   [output_channels, filter_height, filter_width, group_input_channels]
+        std::vector<size_t> xnnFilterDims;
+        std::vector<float> filterData =
+            TransposeData(GetConstantData(filter), filterDims, permutation, xnnFilterDims);
+        uint32_t filterId;
+        XNN_TRY(DefineStaticValue(xnnFilterDims, std::move(filterData), filterId));
+        const uint32_t biasId =
+            options->bias != nullptr ? GetValueId(inputs[2].Get()) : XNN_INVALID_VALUE_ID;
+
+        const int32_t strideHeight = options->strides[0], strideWidth = options->strides[1];
+        const int32_t dilationHeight = options->dilations[0];
+        const int32_t dilationWidth = options->dilations[1];
+        // WebNN padding: [beginning_height, ending_height, beginning_width, ending_width]
+        int32_t padTop = options->padding[0], padBottom = options->padding[1];
+        int32_t padLeft = options->padding[2], padRight = options->padding[3];
+        if (options->autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputShape[1], filterHeight,
+                                             strideHeight, dilationHeight, padTop, padBottom);
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputShape[2], filterWidth,
+                                             strideWidth, dilationWidth, padLeft, padRight);
+        }
+        float outputMin, outputMax;
+        GetOutputRange(options->activation, outputMin, outputMax);
+        XNN_TRY(DefineValue(conv2d->PrimaryOutput()));
+        const uint32_t inputId = GetValueId(inputs[0].Get());
+        const uint32_t outputId = GetValueId(conv2d->PrimaryOutput());
+        if (depthwise) {
+            XNN_TRY(xnn_define_depthwise_convolution_2d(
+                mSubgraph, padTop, padRight, padBottom, padLeft, filterHeight, filterWidth,
+                strideHeight, strideWidth, dilationHeight, dilationWidth, outputChannels / groups,
+                inputChannels, outputMin, outputMax, inputId, filterId, biasId, outputId, 0));
         } else {
-            return xnn_status_unsupported_parameter;
+            XNN_TRY(xnn_define_convolution_2d(
+                mSubgraph, padTop, padRight, padBottom, padLeft, filterHeight, filterWidth,
+                strideHeight, strideWidth, dilationHeight, dilationWidth, groups,
+                groupInputChannels, outputChannels / groups, outputMin, outputMax, inputId,
+                filterId, biasId, outputId, 0));
         }
-        std::shared_ptr<OperandInfo>& outputInfo = mOperandInfoMap.at(binary);
-        outputInfo->dataType = input0Info->dataType;
-        XNN_TRY(BroadcastDimensions(input0Info->dims, input1Info->dims, outputInfo->dims));
-        mOutputs.push_back(outputInfo);
-        mExternalOutputs.insert(std::make_pair(outputInfo->name, mOutputs.size() - 1));
         return xnn_status_success;
     }
 
-    xnn_status Graph::CreateXnnOp(const op::Pool2d* pool2d) {
-        DAWN_ASSERT(pool2d->Inputs().size() == 1);
-        const OperandBase* inputOperand = pool2d->Inputs()[0].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(inputOperand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& inputInfo = mOperandInfoMap.at(inputOperand);
-        mInputs.push_back(inputInfo);
-        if (inputInfo->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(inputInfo->name, mInputs.size() - 1));
+    xnn_status Graph::DefineXnnNode(const op::Gemm* gemm) {
+        auto inputs = gemm->Inputs();
+        const GemmOptions* options = gemm->GetOptions();
+        const op::Constant* b = GetConstant(inputs[1].Get());
+        DAWN_ASSERT(!options->aTranspose && options->alpha == 1.0f && b != nullptr);
+        // The gemm is a fully connected node, XNNPACK expects the weights in
+        // [output_channels, input_channels] and the bias in [output_channels].
+        std::vector<size_t> bDims, weightsDims;
+        XNN_TRY(GetXnnDims(inputs[1]->Shape(), bDims));
+        const float* bData = GetConstantData(b);
+        std::vector<float> weights =
+            options->bTranspose ? std::vector<float>(bData, bData + bDims[0] * bDims[1])
+                                : TransposeData(bData, bDims, {1, 0}, weightsDims);
+        if (options->bTranspose) {
+            weightsDims = bDims;
+        }
+        uint32_t weightsId;
+        XNN_TRY(DefineStaticValue(weightsDims, std::move(weights), weightsId));
+        uint32_t biasId = XNN_INVALID_VALUE_ID;
+        if (options->c != nullptr && options->beta != 0.0f) {
+            const op::Constant* c = GetConstant(inputs[2].Get());
+            const size_t outputChannels = weightsDims[0];
+            const size_t cSize = SizeOfShape(inputs[2]->Shape());
+            DAWN_ASSERT(c != nullptr && (cSize == 1 || cSize == outputChannels));
+            const float* cData = GetConstantData(c);
+            std::vector<float> bias(outputChannels);
+            for (size_t i = 0; i < outputChannels; ++i) {
+                bias[i] = options->beta * cData[cSize == 1 ? 0 : i];
+            }
+            XNN_TRY(DefineStaticValue({outputChannels}, std::move(bias), biasId));
+        }
+        float outputMin, outputMax;
+        GetOutputRange(gemm->GetActivation(), outputMin, outputMax);
+        XNN_TRY(DefineValue(gemm->PrimaryOutput()));
+        XNN_TRY(xnn_define_fully_connected(mSubgraph, outputMin, outputMax,
+                                           GetValueId(inputs[0].Get()), weightsId, biasId,
+                                           GetValueId(gemm->PrimaryOutput()), 0));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(const op::Pad* pad) {
+        auto inputs = pad->Inputs();
+        const op::Constant* padding = GetConstant(inputs[1].Get());
+        DAWN_ASSERT(pad->GetOptions()->mode == ml::PaddingMode::Constant && padding != nullptr);
+        // The padding is [rank, 2] of [beginning, ending].
+        const int32_t* paddingData = static_cast<const int32_t*>(padding->GetBuffer());
+        const size_t rank = inputs[0]->Shape().size();
+        std::vector<size_t> prePaddings(rank), postPaddings(rank);
+        for (size_t i = 0; i < rank; ++i) {
+            prePaddings[i] = paddingData[2 * i];
+            postPaddings[i] = paddingData[2 * i + 1];
         }
+        XNN_TRY(DefineValue(pad->PrimaryOutput()));
+        XNN_TRY(xnn_define_static_constant_pad(
+            mSubgraph, prePaddings.data(), postPaddings.data(), pad->GetOptions()->value,
+            GetValueId(inputs[0].Get()), GetValueId(pad->PrimaryOutput()), 0));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(const op::Pool2d* pool2d) {
+        DAWN_ASSERT(pool2d->Inputs().size() == 1);
+        const OperandBase* input = pool2d->Inputs()[0].Get();
         const Pool2dOptions* options = pool2d->GetOptions();
-        if (options->layout != ml::InputOperandLayout::Nhwc) {
-            dawn::ErrorLog() << "XNNPACK only supports input layout nhwc.";
-            return xnn_status_invalid_parameter;
-        }
-        uint32_t strideHeight = options->strides[0];
-        uint32_t strideWidth = options->strides[1];
-        uint32_t dilationHeight = options->dilations[0];
-        uint32_t dilationWidth = options->dilations[1];
+        DAWN_ASSERT(options->layout == ml::InputOperandLayout::Nhwc);
         // nhwc
-        size_t inputHeight = inputInfo->dims[1];
-        size_t inputWidth = inputInfo->dims[2];
-        size_t channels = inputInfo->dims[3];
-        uint32_t filterHeight, filterWidth;
+        const int32_t inputHeight = input->Shape()[1];
+        const int32_t inputWidth = input->Shape()[2];
+        int32_t filterHeight = inputHeight, filterWidth = inputWidth;
         if (options->windowDimensions != nullptr) {
             filterHeight = options->windowDimensions[0];
             filterWidth = options->windowDimensions[1];
-        } else {
-            filterHeight = inputHeight;
-            filterWidth = inputWidth;
-        }
-
-        size_t outputHeight, outputWidth;
-        uint32_t padTop, padBottom, padLeft, padRight;
-        if (options->autoPad == ml::AutoPad::Explicit) {
-            // WebNN padding: [beginning_height, ending_height, beginning_width, ending_width]
-            padTop = options->padding[0];
-            padBottom = options->padding[1];
-            padLeft = options->padding[2];
-            padRight = options->padding[3];
-            outputHeight = ComputeConv2DOutputSize(inputHeight, filterHeight, padTop, padBottom,
-                                                   strideHeight, dilationHeight);
-            outputWidth = ComputeConv2DOutputSize(inputWidth, filterWidth, padLeft, padRight,
-                                                  strideWidth, dilationWidth);
-        } else {
-            outputHeight = ceil(inputHeight / strideHeight);
-            outputWidth = ceil(inputWidth / strideWidth);
-            size_t padAlongHeight =
-                std::max(size_t(0), (outputHeight - 1) * strideHeight + filterHeight - inputHeight);
-            size_t padAlongWidth =
-                std::max(size_t(0), (outputWidth - 1) * strideWidth + filterWidth - inputWidth);
-            if (options->autoPad == ml::AutoPad::SameUpper) {
-                padTop = floor(padAlongHeight / 2);
-                padBottom = padAlongHeight - padTop;
-                padLeft = floor(padAlongWidth / 2);
-                padRight = padAlongWidth - padLeft;
-            } else {
-                padBottom = floor(padAlongHeight / 2);
-                padTop = padAlongHeight - padBottom;
-                padRight = floor(padAlongWidth / 2);
-                padLeft = padAlongWidth - padRight;
-            }
+        }
+        const int32_t strideHeight = options->strides[0], strideWidth = options->strides[1];
+        const int32_t dilationHeight = options->dilations[0];
+        const int32_t dilationWidth = options->dilations[1];
+        int32_t padTop = options->padding[0], padBottom = options->padding[1];
+        int32_t padLeft = options->padding[2], padRight = options->padding[3];
+        if (options->autoPad != ml::AutoPad::Explicit) {
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputHeight, filterHeight,
+                                             strideHeight, dilationHeight, padTop, padBottom);
+            ComputeImplicitPaddingForAutoPad(options->autoPad, inputWidth, filterWidth,
+                                             strideWidth, dilationWidth, padLeft, padRight);
         }
 
-        float outputMin = -std::numeric_limits<float>::infinity();
-        float outputMax = +std::numeric_limits<float>::infinity();
-        const uint32_t flags = 0;
+        const float outputMin = -std::numeric_limits<float>::infinity();
+        const float outputMax = +std::numeric_limits<float>::infinity();
+        XNN_TRY(DefineValue(pool2d->PrimaryOutput()));
+        const uint32_t inputId = GetValueId(input);
+        const uint32_t outputId = GetValueId(pool2d->PrimaryOutput());
         if (pool2d->GetType() == op::Pool2dType::kAveragePool2d) {
-            if (dilationHeight != 1 || dilationWidth != 1) {
-                dawn::ErrorLog() << "XNNPACK does not support dilation for averagePool2d.";
-                return xnn_status_invalid_parameter;
-            }
-            XNN_TRY(xnn_create_average_pooling2d_nhwc_f32(
-                padTop, padRight, padBottom, padLeft, filterHeight, filterWidth, strideHeight,
-                strideWidth, channels, channels, channels, outputMin, outputMax, flags,
-                &mXnnOperator));
-            mXnnOperatorType = XnnOpType::average_pooling2d_nhwc_f32;
+            DAWN_ASSERT(dilationHeight == 1 && dilationWidth == 1);
+            XNN_TRY(xnn_define_average_pooling_2d(
+                mSubgraph, padTop, padRight, padBottom, padLeft, filterHeight, filterWidth,
+                strideHeight, strideWidth, outputMin, outputMax, inputId, outputId, 0));
         } else if (pool2d->GetType() == op::Pool2dType::kMaxPool2d) {
-            XNN_TRY(xnn_create_max_pooling2d_nhwc_f32(
-                padTop, padRight, padBottom, padLeft, filterHeight, filterWidth, strideHeight,
-                strideWidth, dilationHeight, dilationWidth, channels, channels, channels, outputMin,
-                outputMax, flags, &mXnnOperator));
-            mXnnOperatorType = XnnOpType::max_pooling2d_nhwc_f32;
+            XNN_TRY(xnn_define_max_pooling_2d(mSubgraph, padTop, padRight, padBottom, padLeft,
+                                              filterHeight, filterWidth, strideHeight,
+                                              strideWidth, dilationHeight, dilationWidth,
+                                              outputMin, outputMax, inputId, outputId, 0));
         } else {
-            dawn::ErrorLog() << "XNNPACK does not support l2Pool2d.";
-            return xnn_status_invalid_parameter;
-        }
-        const std::shared_ptr<OperandInfo> outputInfo = mOperandInfoMap.at(pool2d);
-        outputInfo->dataType = inputInfo->dataType;
-        size_t batchSize = inputInfo->dims[0];
-        // nchw
-        outputInfo->dims = {batchSize, outputHeight, outputWidth, channels};
-        mOutputs.push_back(outputInfo);
-        mExternalOutputs.insert(std::make_pair(outputInfo->name, mOutputs.size() - 1));
+            DAWN_UNREACHABLE();
+        }
         return xnn_status_success;
     }
 
-    xnn_status Graph::CreateXnnOp(const op::Conv2d* conv2d,
-                                  const op::Binary* add,
-                                  const op::Clamp* clamp) {
-        DAWN_ASSERT(conv2d->Inputs().size() == 2);
-        const OperandBase* inputOperand = conv2d->Inputs()[0].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(inputOperand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& inputInfo = mOperandInfoMap.at(inputOperand);
-        mInputs.push_back(inputInfo);
-        if (inputInfo->opType == OperandType::INPUT) {
-            mExternalInputs.insert(std::make_pair(inputInfo->name, mInputs.size() - 1));
-        }
-        const OperandBase* filterOperand = conv2d->Inputs()[1].Get();
-        DAWN_ASSERT(mOperandInfoMap.find(filterOperand) != mOperandInfoMap.end());
-        const std::shared_ptr<OperandInfo>& filterInfo = mOperandInfoMap.at(filterOperand);
-        if (filterInfo->opType != OperandType::CONSTANT) {
-            dawn::ErrorLog() << "filter is not a constant.";
-            return xnn_status_invalid_parameter;
+    xnn_status Graph::DefineXnnNode(const op::ReduceMean* reduceMean) {
+        const OperandBase* input = reduceMean->Inputs()[0].Get();
+        const ReduceMeanOptions* options = reduceMean->GetOptions();
+        // The mean over the spatial dimensions of nhwc is the global average pooling.
+        DAWN_ASSERT(input->Shape().size() == 4 &&
+                    GetReduceAxes(reduceMean) == std::set<int32_t>({1, 2}));
+        XNN_TRY(DefineValue(reduceMean->PrimaryOutput()));
+        const uint32_t outputId = GetValueId(reduceMean->PrimaryOutput());
+        uint32_t pooledId = outputId;
+        const std::vector<int32_t>& inputShape = input->Shape();
+        if (!options->keepDimensions) {
+            std::vector<size_t> pooledDims = {static_cast<size_t>(inputShape[0]), 1, 1,
+                                              static_cast<size_t>(inputShape[3])};
+            XNN_TRY(DefineInternalValue(pooledDims, pooledId));
         }
-        const float* filter = reinterpret_cast<const float*>(filterInfo->buffer.get());
-
-        const Conv2dOptions* options = conv2d->GetOptions();
-        uint32_t groups = options->groups;
-        uint32_t strideHeight = options->strides[0];
-        uint32_t strideWidth = options->strides[1];
-        uint32_t dilationHeight = options->dilations[0];
-        uint32_t dilationWidth = options->dilations[1];
-        size_t inputHeight, inputWidth;
-        uint32_t filterHeight, filterWidth;
-        size_t inputChannels, outputChannels;
-        if (options->inputLayout == ml::InputOperandLayout::Nhwc) {
-            inputHeight = inputInfo->dims[1];
-            inputWidth = inputInfo->dims[2];
-            inputChannels = inputInfo->dims[3];
-            if (groups != 1 && groups == inputChannels) {
-                // For depthwiseConv2d, xnn pack expects the weights layout hwio
-                //   [filter_height, filter_width, input_channels, channel_multiplier]
-                if (options->filterLayout != ml::FilterOperandLayout::Hwio) {
-                    dawn::ErrorLog()
-                        << "XNNPACK only supports filter layout hwio for depthwise conv2d.";
-                    return xnn_status_invalid_parameter;
-                }
-                if (filterInfo->dims[2] != 1) {
-                    dawn::ErrorLog() << "The filter layout is invalid.";
-                    return xnn_status_invalid_parameter;
-                }
-                filterHeight = filterInfo->dims[0];
-                filterWidth = filterInfo->dims[1];
-                outputChannels = filterInfo->dims[3];
-            } else {
-                // For regular conv2d, xnn pack expects weights layed out like:
-                //   [output_channels, filter_height, filter_width, input_channels]
-                if (options->filterLayout != ml::FilterOperandLayout::Ohwi) {
-                    dawn::ErrorLog() << "XNNPACK only supports filter layout ohwi for conv2d.";
-                    return xnn_status_invalid_parameter;
-                }
-                if (filterInfo->dims[3] != inputChannels) {
-                    dawn::ErrorLog() << "The filter layout is invalid.";
-                    return xnn_status_invalid_parameter;
-                }
-                outputChannels = filterInfo->dims[0];
-                filterHeight = filterInfo->dims[1];
-                filterWidth = filterInfo->dims[2];
-            }
-        } else {
-            dawn::ErrorLog() << "XNNPACK only supports input layout nhwc.";
-            return xnn_status_invalid_parameter;
-        }
-        const size_t inputChannelStride = inputChannels;
-        const size_t outputChannelStride = outputChannels;
-        size_t groupInputChannels;
-        size_t groupOutputChannels;
-        uint32_t flags = 0;
-        if (groups == 1) {
-            groupInputChannels = inputChannels;
-            groupOutputChannels = outputChannels;
-        } else if (groups == inputChannels) {
-            groupInputChannels = 1;
-            groupOutputChannels = outputChannels / groups;
-            flags |= XNN_FLAG_DEPTHWISE_CONVOLUTION;
-        } else {
-            // FIXME(nhu): implement the grouped conv2d.
-            dawn::ErrorLog() << "Grouped conv2d is unimplemented.";
-            return xnn_status_unsupported_parameter;
-        }
-
-        size_t outputHeight, outputWidth;
-        uint32_t padTop, padBottom, padLeft, padRight;
-        if (options->autoPad == ml::AutoPad::Explicit) {
-            // WebNN padding: [beginning_height, ending_height, beginning_width, ending_width]
-            padTop = options->padding[0];
-            padBottom = options->padding[1];
-            padLeft = options->padding[2];
-            padRight = options->padding[3];
-            outputHeight = ComputeConv2DOutputSize(inputHeight, filterHeight, padTop, padBottom,
-                                                   strideHeight, dilationHeight);
-            outputWidth = ComputeConv2DOutputSize(inputWidth, filterWidth, padLeft, padRight,
-                                                  strideWidth, dilationWidth);
-        } else {
-            outputHeight = ceil(inputHeight / strideHeight);
-            outputWidth = ceil(inputWidth / strideWidth);
-            size_t padAlongHeight =
-                std::max(size_t(0), (outputHeight - 1) * strideHeight + filterHeight - inputHeight);
-            size_t padAlongWidth =
-                std::max(size_t(0), (outputWidth - 1) * strideWidth + filterWidth - inputWidth);
-            if (options->autoPad == ml::AutoPad::SameUpper) {
-                padTop = floor(padAlongHeight / 2);
-                padBottom = padAlongHeight - padTop;
-                padLeft = floor(padAlongWidth / 2);
-                padRight = padAlongWidth - padLeft;
-            } else {
-                padBottom = floor(padAlongHeight / 2);
-                padTop = padAlongHeight - padBottom;
-                padRight = floor(padAlongWidth / 2);
-                padLeft = padAlongWidth - padRight;
-            }
-        }
-
-        const float* bias = nullptr;
-        if (add) {
-            DAWN_ASSERT(add->Inputs().size() == 2);
-            OperandBase* biasOperand = nullptr;
-            if (conv2d == add->Inputs()[0].Get()) {
-                biasOperand = add->Inputs()[1].Get();
-            } else if (conv2d == add->Inputs()[1].Get()) {
-                biasOperand = add->Inputs()[0].Get();
-            } else {
-                dawn::ErrorLog() << "The add is not fusable.";
-                return xnn_status_invalid_parameter;
-            }
-            DAWN_ASSERT(mOperandInfoMap.find(biasOperand) != mOperandInfoMap.end());
-            const std::shared_ptr<OperandInfo>& biasInfo = mOperandInfoMap.at(biasOperand);
-            if (biasInfo->opType != OperandType::CONSTANT) {
-                dawn::ErrorLog() << "bias is not a constant.";
-                return xnn_status_invalid_parameter;
-            }
-            if (biasInfo->dims.size() != 1 && biasInfo->dims[0] != outputChannels) {
-                dawn::ErrorLog() << "bias dimensions is invalid.";
-                return xnn_status_invalid_parameter;
-            }
-            bias = reinterpret_cast<const float*>(biasInfo->buffer.get());
+        XNN_TRY(xnn_define_global_average_pooling_2d(
+            mSubgraph, -std::numeric_limits<float>::infinity(),
+            +std::numeric_limits<float>::infinity(), GetValueId(input), pooledId, 0));
+        if (pooledId != outputId) {
+            std::vector<size_t> outputDims;
+            XNN_TRY(GetXnnDims(reduceMean->PrimaryOutput()->Shape(), outputDims));
+            XNN_TRY(xnn_define_static_reshape(mSubgraph, outputDims.size(), outputDims.data(),
+                                              pooledId, outputId, 0));
         }
+        return xnn_status_success;
+    }
 
-        float outputMin = -std::numeric_limits<float>::infinity();
-        float outputMax = +std::numeric_limits<float>::infinity();
-        if (clamp) {
-            if (add) {
-                if (add != clamp->Inputs()[0].Get()) {
-                    dawn::ErrorLog() << "The clamp is not fusable.";
-                    return xnn_status_invalid_parameter;
-                }
-            } else {
-                if (conv2d != clamp->Inputs()[0].Get()) {
-                    dawn::ErrorLog() << "The clamp is not fusable.";
-                    return xnn_status_invalid_parameter;
-                }
-            }
-            const ClampOptions* options = clamp->GetOptions();
-            if (options->minValue != nullptr) {
-                const std::shared_ptr<OperandInfo>& minInfo = mOperandInfoMap.at(options->minValue);
-                if (minInfo->opType != OperandType::CONSTANT) {
-                    dawn::ErrorLog() << "XNNPACK only supports clamp by value.";
-                    return xnn_status_invalid_parameter;
-                }
-                outputMin = (reinterpret_cast<float*>(minInfo->buffer.get()))[0];
-            }
-            if (options->maxValue != nullptr) {
-                const std::shared_ptr<OperandInfo>& maxInfo = mOperandInfoMap.at(options->maxValue);
-                if (maxInfo->opType != OperandType::CONSTANT) {
-                    dawn::ErrorLog() << "XNNPACK only supports clamp by value.";
-                    return xnn_status_invalid_parameter;
-                }
-                outputMax = (reinterpret_cast<float*>(maxInfo->buffer.get()))[0];
-            }
-        }
+    xnn_status Graph::DefineXnnNode(const op::Resample* resample) {
+        const OperandBase* input = resample->Inputs()[0].Get();
+        const std::vector<int32_t>& inputShape = input->Shape();
+        const std::vector<int32_t>& outputShape = resample->PrimaryOutput()->Shape();
+        // The bilinear resize of XNNPACK scales the spatial dimensions of nhwc with the half
+        // pixel centers.
+        DAWN_ASSERT(resample->GetOptions()->mode == ml::InterpolationMode::Linear &&
+                    inputShape.size() == 4 && inputShape[0] == outputShape[0] &&
+                    inputShape[3] == outputShape[3]);
+        XNN_TRY(DefineValue(resample->PrimaryOutput()));
+        XNN_TRY(xnn_define_static_resize_bilinear_2d(mSubgraph, outputShape[1], outputShape[2],
+                                                     GetValueId(input),
+                                                     GetValueId(resample->PrimaryOutput()), 0));
+        return xnn_status_success;
+    }
 
-        XNN_TRY(xnn_create_convolution2d_nhwc_f32(
-            padTop, padRight, padBottom, padLeft, filterHeight, filterWidth, strideHeight,
-            strideWidth, dilationHeight, dilationWidth, groups, groupInputChannels,
-            groupOutputChannels, inputChannelStride, outputChannelStride, filter, bias, outputMin,
-            outputMax, flags, &mXnnOperator));
-        mXnnOperatorType = XnnOpType::convolution2d_nhwc_f32;
-        std::shared_ptr<OperandInfo> outputInfo;
-        if (clamp) {
-            outputInfo = mOperandInfoMap.at(clamp);
-        } else if (add) {
-            outputInfo = mOperandInfoMap.at(add);
-        } else {
-            outputInfo = mOperandInfoMap.at(conv2d);
+    xnn_status Graph::DefineXnnNode(const op::Unary* unary) {
+        DAWN_ASSERT(unary->Inputs().size() == 1);
+        XNN_TRY(DefineValue(unary->PrimaryOutput()));
+        const uint32_t inputId = GetValueId(unary->Inputs()[0].Get());
+        const uint32_t outputId = GetValueId(unary->PrimaryOutput());
+        switch (unary->GetType()) {
+            case op::UnaryOpType::kRelu:
+                XNN_TRY(xnn_define_clamp(mSubgraph, 0, +std::numeric_limits<float>::infinity(),
+                                         inputId, outputId, 0));
+                break;
+            case op::UnaryOpType::kHardSwish:
+                XNN_TRY(xnn_define_hardswish(mSubgraph, inputId, outputId, 0));
+                break;
+            case op::UnaryOpType::kLeakyRelu:
+                XNN_TRY(xnn_define_leaky_relu(
+                    mSubgraph, static_cast<const op::LeakyRelu*>(unary)->GetAlpha(), inputId,
+                    outputId, 0));
+                break;
+            case op::UnaryOpType::kSigmoid:
+                XNN_TRY(xnn_define_sigmoid(mSubgraph, inputId, outputId, 0));
+                break;
+            case op::UnaryOpType::kSoftmax:
+                XNN_TRY(xnn_define_softmax(mSubgraph, inputId, outputId, 0));
+                break;
+            default:
+                DAWN_UNREACHABLE();
         }
-        outputInfo->dataType = inputInfo->dataType;
-        size_t batchSize = inputInfo->dims[0];
-        outputInfo->dims = {batchSize, outputHeight, outputWidth, outputChannels};
-        mOutputs.push_back(outputInfo);
-        mExternalOutputs.insert(std::make_pair(outputInfo->name, mOutputs.size() - 1));
         return xnn_status_success;
     }
 
-    size_t Graph::SizeOfOperandInfo(const std::shared_ptr<OperandInfo>& info) {
-        return std::accumulate(info->dims.begin(), info->dims.end(), 1, std::multiplies<size_t>()) *
-               SizeOfXnnDataType(info->dataType);
+    // The reshape and squeeze only change the dimensions.
+    xnn_status Graph::DefineReshapeNode(const OperatorBase* op) {
+        std::vector<size_t> newShape;
+        XNN_TRY(GetXnnDims(op->PrimaryOutput()->Shape(), newShape));
+        XNN_TRY(DefineValue(op->PrimaryOutput()));
+        XNN_TRY(xnn_define_static_reshape(mSubgraph, newShape.size(), newShape.data(),
+                                          GetValueId(op->Inputs()[0].Get()),
+                                          GetValueId(op->PrimaryOutput()), 0));
+        return xnn_status_success;
     }
 
     pthreadpool_t Graph::GetThreadpool() {
@@ -689,110 +1011,108 @@ namespace webnn_native { namespace xnnpack {
     }
 
     MaybeError Graph::CompileImpl() {
+        // The runtime owns the packed weights and the planned intermediate buffers, the static
+        // data of the values is still referenced so it's kept by the graph.
+        uint32_t flags = 0;
+#if defined(XNN_FLAG_HINT_FP16_INFERENCE)
+        // The reduced precision lets XNNPACK rewrite the subgraph to the f16 operators on the
+        // CPUs with the native fp16 arithmetic, e.g. ARMv8.2, it keeps fp32 otherwise.
+        if (GetContext()->GetContextOptions().reducedPrecision) {
+            flags |= XNN_FLAG_HINT_FP16_INFERENCE;
+        }
+#endif
+        DAWN_TRY(xnn_create_runtime_v2(mSubgraph, GetThreadpool(), flags, &mRuntime));
+        DAWN_TRY(xnn_delete_subgraph(mSubgraph));
+        mSubgraph = nullptr;
         return {};
     }
 
+    void Graph::BindFloat16Values(
+        std::vector<xnn_external_value>& values,
+        std::vector<std::pair<const std::vector<float>*, void*>>& float16Outputs) {
+        for (auto& value : values) {
+            auto input = mFloat16Inputs.find(value.id);
+            if (input != mFloat16Inputs.end()) {
+                Float16ToFloat32(static_cast<const uint16_t*>(value.data), input->second.data(),
+                                 input->second.size());
+                value.data = input->second.data();
+                continue;
+            }
+            auto output = mFloat16Outputs.find(value.id);
+            if (output != mFloat16Outputs.end()) {
+                float16Outputs.push_back(std::make_pair(&output->second, value.data));
+                value.data = output->second.data();
+            }
+        }
+    }
+
     MLComputeGraphStatus Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
-        std::vector<const void*> inputBuffers(mInputs.size(), nullptr);
-        for (size_t i = 0; i < mInputs.size(); ++i) {
-            if (mInputs[i]->opType == OperandType::CONSTANT) {
-                inputBuffers[i] = mInputs[i]->buffer.get();
+        std::vector<xnn_external_value> externalValues;
+        for (auto& input : mExternalInputs) {
+            const Input* record = inputs->Get(input.first.c_str());
+            if (record == nullptr) {
+                COMPUTE_ERROR("The input " << input.first << " isn't set.");
             }
+            const ArrayBufferView& resource = record->resource;
+            if (resource.byteLength < mInputByteLengths.at(input.first)) {
+                COMPUTE_ERROR("The buffer of input " << input.first << " is too small.");
+            }
+            externalValues.push_back(
+                {input.second, static_cast<int8_t*>(resource.buffer) + resource.byteOffset});
         }
-        for (auto& input : inputs->GetRecords()) {
-            if (mExternalInputs.find(input.first) == mExternalInputs.end()) {
-                COMPUTE_ERROR("Invalid parameters.");
+        for (auto& output : outputs->GetRecords()) {
+            if (mExternalOutputs.find(output.first) == mExternalOutputs.end()) {
+                COMPUTE_ERROR("The output " << output.first << " isn't found.");
             }
-            size_t index = mExternalInputs.at(input.first);
-            inputBuffers[index] = static_cast<int8_t*>(input.second->resource.buffer) +
-                                  input.second->resource.byteOffset;
+        }
+        for (auto& output : mExternalOutputs) {
+            const ArrayBufferView* record = outputs->Get(output.first.c_str());
+            void* buffer = record != nullptr
+                               ? static_cast<int8_t*>(record->buffer) + record->byteOffset
+                               : static_cast<void*>(mOutputBuffers.at(output.first).data());
+            externalValues.push_back({output.second, buffer});
         }
 
-        std::vector<std::string> outputNames;
-        for (auto& output : outputs->GetRecords()) {
-            outputNames.push_back(output.first);
-        }
-
-        std::vector<void*> outputBuffers(mOutputs.size(), nullptr);
-        for (size_t i = 0; i < outputNames.size(); ++i) {
-            std::string outputName = outputNames[i];
-            size_t outputIndex = mExternalOutputs.at(outputName);
-            const std::shared_ptr<OperandInfo>& outputInfo = mOutputs[outputIndex];
-            std::vector<int32_t> dimensions(outputInfo->dims.begin(), outputInfo->dims.end());
-            size_t bufferLength = SizeOfOperandInfo(outputInfo);
-            if (outputs->GetRecords().find(outputName) != outputs->GetRecords().end()) {
-                const ArrayBufferView* output = outputs->GetRecords().at(outputName);
-                DAWN_ASSERT(output->byteLength >= bufferLength);
-                outputBuffers[outputIndex] =
-                    static_cast<int8_t*>(output->buffer) + output->byteOffset;
-            }
-        }
-
-        if (mXnnOperatorType == XnnOpType::convolution2d_nhwc_f32 ||
-            mXnnOperatorType == XnnOpType::average_pooling2d_nhwc_f32 ||
-            mXnnOperatorType == XnnOpType::max_pooling2d_nhwc_f32) {
-            std::vector<size_t> inputDims = mInputs[0]->dims;
-            if (!inputBuffers[0] || !outputBuffers[0]) {
-                COMPUTE_ERROR("Invalid parameters.");
-            }
-            const float* input = reinterpret_cast<const float*>(inputBuffers[0]);
-            float* output = reinterpret_cast<float*>(outputBuffers[0]);
-            size_t batchSize = inputDims[0];
-            size_t inputHeight = inputDims[1];
-            size_t inputWidth = inputDims[2];
-            if (mXnnOperatorType == XnnOpType::convolution2d_nhwc_f32) {
-                COMPUTE_TRY(xnn_setup_convolution2d_nhwc_f32(mXnnOperator, batchSize, inputHeight,
-                                                             inputWidth, input, output,
-                                                             GetThreadpool()));
-            } else if (mXnnOperatorType == XnnOpType::average_pooling2d_nhwc_f32) {
-                COMPUTE_TRY(xnn_setup_average_pooling2d_nhwc_f32(mXnnOperator, batchSize,
-                                                                 inputHeight, inputWidth, input,
-                                                                 output, GetThreadpool()));
-            } else if (mXnnOperatorType == XnnOpType::max_pooling2d_nhwc_f32) {
-                COMPUTE_TRY(xnn_setup_max_pooling2d_nhwc_f32(mXnnOperator, batchSize, inputHeight,
-                                                             inputWidth, input, output,
-                                                             GetThreadpool()));
-            }
-        } else if (mXnnOperatorType == XnnOpType::clamp_nc_f32) {
-            const std::shared_ptr<OperandInfo>& outputInfo = mOutputs[0];
-            size_t batchSize = std::accumulate(outputInfo->dims.begin(), outputInfo->dims.end(), 1,
-                                               std::multiplies<size_t>());
-            if (!inputBuffers[0] || !outputBuffers[0]) {
-                COMPUTE_ERROR("Invalid parameters.");
-            }
-            const float* input = reinterpret_cast<const float*>(inputBuffers[0]);
-            float* output = reinterpret_cast<float*>(outputBuffers[0]);
-            COMPUTE_TRY(
-                xnn_setup_clamp_nc_f32(mXnnOperator, batchSize, input, output, GetThreadpool()));
-        } else if (mXnnOperatorType == XnnOpType::add_nd_f32 ||
-                   mXnnOperatorType == XnnOpType::multiply_nd_f32 ||
-                   mXnnOperatorType == XnnOpType::subtract_nd_f32) {
-            std::vector<size_t> dims0 = mInputs[0]->dims;
-            std::vector<size_t> dims1 = mInputs[1]->dims;
-            if (!inputBuffers[0] || !inputBuffers[1] || !outputBuffers[0]) {
-                COMPUTE_ERROR("Invalid parameters.");
-            }
-            const float* input0 = reinterpret_cast<const float*>(inputBuffers[0]);
-            const float* input1 = reinterpret_cast<const float*>(inputBuffers[1]);
-            float* output = reinterpret_cast<float*>(outputBuffers[0]);
-            if (mXnnOperatorType == XnnOpType::add_nd_f32) {
-                COMPUTE_TRY(xnn_setup_add_nd_f32(mXnnOperator, dims0.size(), dims0.data(),
-                                                 dims1.size(), dims1.data(), input0, input1, output,
-                                                 GetThreadpool()));
-            } else if (mXnnOperatorType == XnnOpType::multiply_nd_f32) {
-                COMPUTE_TRY(xnn_setup_multiply_nd_f32(mXnnOperator, dims0.size(), dims0.data(),
-                                                      dims1.size(), dims1.data(), input0, input1,
-                                                      output, GetThreadpool()));
-            } else if (mXnnOperatorType == XnnOpType::subtract_nd_f32) {
-                COMPUTE_TRY(xnn_setup_subtract_nd_f32(mXnnOperator, dims0.size(), dims0.data(),
-                                                      dims1.size(), dims1.data(), input0, input1,
-                                                      output, GetThreadpool()));
+        std::vector<std::pair<const std::vector<float>*, void*>> float16Outputs;
+        BindFloat16Values(externalValues, float16Outputs);
+        COMPUTE_TRY(xnn_setup_runtime(mRuntime, externalValues.size(), externalValues.data()));
+        COMPUTE_TRY(xnn_invoke_runtime(mRuntime));
+        for (auto& output : float16Outputs) {
+            Float32ToFloat16(output.first->data(), static_cast<uint16_t*>(output.second),
+                             output.first->size());
+        }
+
+        return MLComputeGraphStatus_Success;
+    }
+
+    MLComputeGraphStatus Graph::ComputeBindingsImpl(BindingsBase* bindings) {
+        mBoundValues.clear();
+        // The bindings are validated to bind all the inputs.
+        for (size_t i = 0; i < mIndexedInputs.size(); ++i) {
+            const ArrayBufferView& resource = bindings->GetInput(i)->resource;
+            if (resource.byteLength < mIndexedInputs[i].second) {
+                COMPUTE_ERROR("The buffer of input " << GetInputNames()[i] << " is too small.");
             }
-        } else {
-            COMPUTE_ERROR("The operator is not supported.");
+            mBoundValues.push_back({mIndexedInputs[i].first,
+                                    static_cast<int8_t*>(resource.buffer) + resource.byteOffset});
+        }
+        for (size_t i = 0; i < mIndexedOutputs.size(); ++i) {
+            xnn_external_value value = mIndexedOutputs[i];
+            const ArrayBufferView* resource = bindings->GetOutput(i);
+            if (resource != nullptr) {
+                value.data = static_cast<int8_t*>(resource->buffer) + resource->byteOffset;
+            }
+            mBoundValues.push_back(value);
         }
 
-        COMPUTE_TRY(xnn_run_operator(mXnnOperator, GetThreadpool()));
+        std::vector<std::pair<const std::vector<float>*, void*>> float16Outputs;
+        BindFloat16Values(mBoundValues, float16Outputs);
+        COMPUTE_TRY(xnn_setup_runtime(mRuntime, mBoundValues.size(), mBoundValues.data()));
+        COMPUTE_TRY(xnn_invoke_runtime(mRuntime));
+        for (auto& output : float16Outputs) {
+            Float32ToFloat16(output.first->data(), static_cast<uint16_t*>(output.second),
+                             output.first->size());
+        }
 
         return MLComputeGraphStatus_Success;
     }
@@ -16,38 +16,59 @@
 #define WEBNN_NATIVE_XNNPACK_GRAPH_XNN_H_
 
 #include <map>
-#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <xnnpack.h>
 
 #include "webnn_native/Graph.h"
 #include "webnn_native/Operand.h"
+#include "webnn_native/ops/BatchNorm.h"
 #include "webnn_native/ops/Binary.h"
 #include "webnn_native/ops/Clamp.h"
 #include "webnn_native/ops/Constant.h"
 #include "webnn_native/ops/Conv2d.h"
+#include "webnn_native/ops/Gemm.h"
 #include "webnn_native/ops/Input.h"
 #include "webnn_native/ops/LeakyRelu.h"
+#include "webnn_native/ops/Pad.h"
 #include "webnn_native/ops/Pool2d.h"
+#include "webnn_native/ops/ReduceMean.h"
+#include "webnn_native/ops/Resample.h"
 #include "webnn_native/ops/Reshape.h"
-#include "webnn_native/ops/Transpose.h"
+#include "webnn_native/ops/Squeeze.h"
 #include "webnn_native/ops/Unary.h"
 #include "webnn_native/xnnpack/ContextXNN.h"
 
 namespace webnn_native { namespace xnnpack {
 
+    // The whole graph is lowered into one XNNPACK subgraph, the runtime created from it plans
+    // the intermediate buffers and runs all the nodes on the pthreadpool of the context.
     class Graph : public GraphBase {
       public:
         explicit Graph(Context* context);
         ~Graph() override;
 
+        // Whether the nodes are defined for the operator. The subgraph is only defined for the
+        // supported operators, so the context reports the same operators to the partitioner.
+        static bool SupportsOperator(const OperatorBase* op);
+
         virtual MaybeError AddConstant(const op::Constant* constant) override;
         virtual MaybeError AddInput(const op::Input* input) override;
         virtual MaybeError AddOutput(const std::string& name, const OperandBase* output) override;
+        virtual MaybeError AddBatchNorm(const op::BatchNorm* batchNorm) override;
         virtual MaybeError AddBinary(const op::Binary* binary) override;
         virtual MaybeError AddClamp(const op::Clamp* clamp) override;
         virtual MaybeError AddConv2d(const op::Conv2d* conv2d) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
+        virtual MaybeError AddLeakyRelu(const op::LeakyRelu* leakyRelu) override;
+        virtual MaybeError AddPad(const op::Pad* pad) override;
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddReduceMean(const op::ReduceMean* reduceMean) override;
+        virtual MaybeError AddResample(const op::Resample* resample) override;
+        virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddSqueeze(const op::Squeeze* squeeze) override;
         virtual MaybeError AddUnary(const op::Unary* unary) override;
         virtual MaybeError Finish() override;
 
@@ -55,51 +76,69 @@ namespace webnn_native { namespace xnnpack {
         MaybeError CompileImpl() override;
         MLComputeGraphStatus ComputeImpl(NamedInputsBase* inputs,
                                          NamedOutputsBase* outputs) override;
-
-        enum OperandType { INPUT, CONSTANT, BINARY, CLAMP, CONV2D, POOL2D, UNARY };
-        struct OperandInfo {
-            OperandInfo(OperandType opType) : opType(opType) {
-            }
-            OperandType opType;
-            std::string name = "";
-            xnn_datatype dataType = xnn_datatype_invalid;
-            std::vector<size_t> dims = {};
-            std::unique_ptr<char> buffer = nullptr;
-        };
+        MLComputeGraphStatus ComputeBindingsImpl(BindingsBase* bindings) override;
 
         pthreadpool_t GetThreadpool();
-        size_t SizeOfOperandInfo(const std::shared_ptr<OperandInfo>& info);
-        xnn_status CreateBuffer(std::shared_ptr<OperandInfo>& info,
-                                const void* data = nullptr,
-                                size_t length = 0);
-        xnn_status CreateXnnOp(const op::Unary* unary);
-        xnn_status CreateXnnOp(const op::Clamp* clamp);
-        xnn_status CreateXnnOp(const op::Binary* binary);
-        xnn_status CreateXnnOp(const op::Pool2d* pool2d);
-        xnn_status CreateXnnOp(const op::Conv2d* conv2d,
-                               const op::Binary* add = nullptr,
-                               const op::Clamp* clamp = nullptr);
-
-        enum XnnOpType {
-            add_nd_f32,
-            clamp_nc_f32,
-            multiply_nd_f32,
-            subtract_nd_f32,
-            convolution2d_nhwc_f32,
-            average_pooling2d_nhwc_f32,
-            max_pooling2d_nhwc_f32
-        };
-        XnnOpType mXnnOperatorType;
-        xnn_operator_t mXnnOperator;
-        std::vector<std::shared_ptr<OperandInfo>> mConstants;
-        std::vector<std::shared_ptr<OperandInfo>> mInputs;
-        std::vector<std::shared_ptr<OperandInfo>> mOutputs;
+
+        // Define the tensor value of an operand, the static data is owned by the graph because
+        // XNNPACK references it until the runtime is deleted.
+        xnn_status DefineValue(const OperandBase* operand);
+        xnn_status DefineStaticValue(std::vector<size_t> dims,
+                                     std::vector<float> data,
+                                     uint32_t& id);
+        xnn_status DefineInternalValue(std::vector<size_t> dims, uint32_t& id);
+        uint32_t GetValueId(const OperandBase* operand);
+        const op::Constant* GetConstant(const OperandBase* operand);
+        // The float32 data of a float constant, the float16 constants are converted once while
+        // the subgraph is defined.
+        const float* GetConstantData(const op::Constant* constant);
+        // Bind the float16 external values to the float32 buffers of the subgraph, the inputs are
+        // converted here and the outputs are returned to be converted after invoking.
+        void BindFloat16Values(
+            std::vector<xnn_external_value>& values,
+            std::vector<std::pair<const std::vector<float>*, void*>>& float16Outputs);
+
+        xnn_status DefineXnnNode(const op::BatchNorm* batchNorm);
+        xnn_status DefineXnnNode(const op::Binary* binary);
+        xnn_status DefineXnnNode(const op::Clamp* clamp);
+        xnn_status DefineXnnNode(const op::Conv2d* conv2d);
+        xnn_status DefineXnnNode(const op::Gemm* gemm);
+        xnn_status DefineXnnNode(const op::Pad* pad);
+        xnn_status DefineXnnNode(const op::Pool2d* pool2d);
+        xnn_status DefineXnnNode(const op::ReduceMean* reduceMean);
+        xnn_status DefineXnnNode(const op::Resample* resample);
+        xnn_status DefineXnnNode(const op::Unary* unary);
+        xnn_status DefineReshapeNode(const OperatorBase* op);
+
+        xnn_subgraph_t mSubgraph;
+        xnn_runtime_t mRuntime;
+
+        // For graph building, the subgraph is defined in Finish() once the named outputs are
+        // known because the external values must be flagged when they are defined.
+        std::vector<const OperatorBase*> mOperators;
+        std::unordered_map<const OperandBase*, const op::Constant*> mConstants;
+        std::map<std::string, const op::Input*> mInputs;
+        std::map<std::string, const OperandBase*> mOutputs;
+
+        std::unordered_map<const OperandBase*, uint32_t> mValueIds;
+        std::vector<std::vector<float>> mStaticData;
+        std::unordered_map<const op::Constant*, std::vector<float>> mConvertedConstants;
         std::map<std::string, uint32_t> mExternalInputs;
+        // The operand shapes may change after the graph is built, e.g. for the dynamic batch.
+        std::map<std::string, size_t> mInputByteLengths;
         std::map<std::string, uint32_t> mExternalOutputs;
+        // The named outputs that are not requested by a compute are written here.
+        std::map<std::string, std::vector<float>> mOutputBuffers;
+        // The float32 buffers of the float16 inputs and outputs by the external value ids.
+        std::map<uint32_t, std::vector<float>> mFloat16Inputs;
+        std::map<uint32_t, std::vector<float>> mFloat16Outputs;
 
-        // For graph building
-        std::vector<const OperandBase*> mOperandsToBuild;
-        std::map<const OperandBase*, std::shared_ptr<OperandInfo>> mOperandInfoMap;
+        // The external values by the indices of the bindings, the input values carry the byte
+        // length to validate and the output values the buffer of an unrequested output.
+        std::vector<std::pair<uint32_t, size_t>> mIndexedInputs;
+        std::vector<xnn_external_value> mIndexedOutputs;
+        // Reused by the computes with bindings, which are not run concurrently.
+        std::vector<xnn_external_value> mBoundValues;
     };
 
 }}  // namespace webnn_native::xnnpack